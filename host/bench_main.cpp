@@ -0,0 +1,39 @@
+// Host benchmark runner for the generative engine.
+//
+// Usage: generative_bench [--iters N] [--label TEXT]
+// Prints one JSON object per benchmark (see generative/bench.h).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "generative/bench.h"
+
+static uint32_t now_ns() {
+    using namespace std::chrono;
+    static const steady_clock::time_point origin = steady_clock::now();
+    return static_cast<uint32_t>(
+        duration_cast<nanoseconds>(steady_clock::now() - origin).count());
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 1000000;
+    const char* label = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--iters") && i + 1 < argc) {
+            iterations = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--label") && i + 1 < argc) {
+            label = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--iters N] [--label TEXT]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const generative::BenchClock clock = { now_ns, 0xFFFFFFFFu, "ns" };
+    generative::RunBenchmarks(clock, iterations, label);
+    return 0;
+}
@@ -0,0 +1,578 @@
+// Unit tests of the generative engine (GenerativeController), run by ctest.
+//
+// Usage: engine_test
+//
+// Each test prints one line, "ok <name>" or "FAIL <name>" followed by the
+// failed checks. Exits with status 1 if any check failed.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "generative/generative_controller.h"
+#include "generative/pattern_index.h"
+#include "grids/pattern_generator.h"
+
+namespace {
+
+using generative::GenerativeController;
+using generative::kNumChannels;
+using generative::kPatternSteps;
+
+const uint32_t kBpmTenths = 1200;
+const uint8_t kPulsesPerStep = grids::kPulsesPerStep;
+const uint32_t kPulsesPerBar = kPulsesPerStep * kPatternSteps;
+
+uint32_t failures = 0;
+bool test_failed = false;
+
+#define CHECK(cond)                                                      \
+    do {                                                                 \
+        if (!(cond)) {                                                   \
+            printf("  %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+            test_failed = true;                                          \
+        }                                                                \
+    } while (0)
+
+void Run(const char* name, void (*test)()) {
+    test_failed = false;
+    test();
+    if (test_failed) {
+        failures++;
+    }
+    printf("%s %s\n", test_failed ? "FAIL" : "ok", name);
+}
+
+bool SamePatterns(const GenerativeController& a, const GenerativeController& b) {
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        const generative::ChannelState& ca = a.channel(i);
+        const generative::ChannelState& cb = b.channel(i);
+        if (ca.trigger_bits != cb.trigger_bits || ca.velocity_bits != cb.velocity_bits ||
+            ca.drum_part != cb.drum_part || ca.x != cb.x || ca.y != cb.y ||
+            ca.density != cb.density) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CopyMasks(const GenerativeController& gen, uint32_t* masks) {
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        masks[i] = gen.TriggerMask(i);
+    }
+}
+
+bool MasksEqual(const GenerativeController& gen, const uint32_t* masks) {
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        if (gen.TriggerMask(i) != masks[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Advance whole pulses on the external clock path
+void Pulses(GenerativeController& gen, uint32_t n) {
+    for (uint32_t i = 0; i < n; ++i) {
+        gen.ClockPulse();
+    }
+}
+
+// Two bars of hits after Init(seed) and a randomize, one mask per pulse.
+// Grids is a global, so controllers run one after the other.
+void RecordHits(GenerativeController& gen, uint32_t seed, uint8_t* masks) {
+    gen.Init(seed, kBpmTenths);
+    gen.Randomize();
+    for (uint32_t i = 0; i < 2 * kPulsesPerBar; ++i) {
+        masks[i] = gen.ClockPulse().gpio_mask;
+    }
+}
+
+// The same seed gives the same patterns and the same hits, another seed
+// different patterns
+void TestDeterminism() {
+    static GenerativeController a;
+    static GenerativeController b;
+    a.Init(42, kBpmTenths);
+    b.Init(42, kBpmTenths);
+    CHECK(SamePatterns(a, b));
+    b.Init(43, kBpmTenths);
+    CHECK(!SamePatterns(a, b));
+
+    static uint8_t first[2 * kPulsesPerBar];
+    static uint8_t second[2 * kPulsesPerBar];
+    RecordHits(a, 42, first);
+    RecordHits(b, 42, second);
+    CHECK(SamePatterns(a, b));
+    CHECK(!memcmp(first, second, sizeof(first)));
+}
+
+// Randomize() keeps every channel within the hit range
+void TestHitRange() {
+    static GenerativeController gen;
+    gen.Init(7, kBpmTenths);
+    const uint8_t ranges[][2] = {{4, 16}, {2, 4}, {8, 12}, {10, 10}};
+    for (const auto& range : ranges) {
+        gen.SetHitRange(range[0], range[1]);
+        bool in_range = true;
+        for (uint32_t round = 0; round < 200; ++round) {
+            gen.Randomize();
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                const uint8_t hits = __builtin_popcount(gen.TriggerMask(i));
+                if (hits < range[0] || hits > range[1]) {
+                    in_range = false;
+                }
+            }
+        }
+        CHECK(in_range);
+    }
+}
+
+// Randomize() keeps to the syncopation and downbeat levels, measured on the
+// masks it plays, and says when no pattern meets them
+void TestFeatureRanges() {
+    static GenerativeController gen;
+    gen.Init(9, kBpmTenths);
+    gen.SetHitRange(4, 16);
+    const uint8_t ranges[][4] = {{1, 3, 1, 3}, {0, 0, 3, 3}, {2, 2, 0, 1}};
+    for (const auto& range : ranges) {
+        gen.SetSyncopationRange(range[0], range[1]);
+        gen.SetDownbeatRange(range[2], range[3]);
+        bool in_range = true;
+        for (uint32_t round = 0; round < 100; ++round) {
+            gen.Randomize();
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                const uint32_t mask = gen.TriggerMask(i);
+                const generative::PatternFeatures f = generative::ComputePatternFeatures(mask);
+                const uint8_t sync = generative::SyncopationLevel(f.syncopation);
+                const uint8_t down = generative::DownbeatLevel(f.downbeat);
+                if (sync < range[0] || sync > range[1] || down < range[2] || down > range[3] ||
+                    f.hits < 4 || f.hits > 16) {
+                    in_range = false;
+                }
+            }
+        }
+        CHECK(in_range && gen.feature_ranges_met());
+    }
+
+    // 16 hits and syncopated: no such pattern, the hit range alone applies
+    gen.SetHitRange(16, 16);
+    gen.SetSyncopationRange(3, 3);
+    gen.SetDownbeatRange(0, 3);
+    gen.Randomize();
+    CHECK(!gen.feature_ranges_met());
+    bool hits_ok = true;
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        hits_ok = hits_ok && __builtin_popcount(gen.TriggerMask(i)) == 16;
+    }
+    CHECK(hits_ok);
+    gen.SetSyncopationRange(0, 3);
+    gen.Randomize();
+    CHECK(gen.feature_ranges_met());
+}
+
+// Randomize() re-initializes Grids but keeps the tap tempo option; Init()
+// turns it off
+void TestTapTempoKept() {
+    static GenerativeController gen;
+    gen.Init(5, kBpmTenths);
+    CHECK(!gen.tap_tempo());
+    gen.SetTapTempo(true);
+    gen.Randomize();
+    CHECK(gen.tap_tempo() && grids::PatternGenerator::tap_tempo());
+    gen.Init(5, kBpmTenths);
+    CHECK(!gen.tap_tempo() && !grids::PatternGenerator::tap_tempo());
+}
+
+// The clock input resolution survives Randomize() too
+void TestClockResolutionKept() {
+    static GenerativeController gen;
+    gen.Init(5, kBpmTenths);
+    CHECK(gen.PulsesPerClock() == 1);
+    gen.SetClockResolution(grids::CLOCK_RESOLUTION_4_PPQN);
+    gen.Randomize();
+    CHECK(gen.PulsesPerClock() == 6);
+    CHECK(grids::PatternGenerator::clock_resolution() == grids::CLOCK_RESOLUTION_4_PPQN);
+    gen.Init(5, kBpmTenths);
+    CHECK(gen.PulsesPerClock() == 1);
+}
+
+// A step every 3 pulses, wrapping after 32; hits match the trigger masks
+void TestStepAdvance() {
+    static GenerativeController gen;
+    gen.Init(3, kBpmTenths);
+    CHECK(gen.step() == 0);
+
+    bool steps_ok = true;
+    bool hits_ok = true;
+    for (uint32_t pulse = 1; pulse <= 3 * kPulsesPerBar; ++pulse) {
+        const generative::FireEvent event = gen.ClockPulse();
+        const uint8_t expected = (pulse / kPulsesPerStep) % kPatternSteps;
+        if (gen.step() != expected || gen.at_step_start() != (pulse % kPulsesPerStep == 0)) {
+            steps_ok = false;
+        }
+        for (uint8_t i = 0; i < kNumChannels; ++i) {
+            const bool due =
+                gen.at_step_start() && ((gen.TriggerMask(i) >> gen.step()) & 1);
+            if (((event.gpio_mask >> i) & 1) != due) {
+                hits_ok = false;
+            }
+        }
+    }
+    CHECK(steps_ok);
+    CHECK(hits_ok);
+}
+
+// Tick() turns elapsed time into pulses at the tempo, carrying the remainder
+void TestPulseAdvance() {
+    static GenerativeController gen;
+    gen.Init(3, kBpmTenths);
+    const uint32_t us_per_pulse = 25000000u / kBpmTenths;  // 20833.3 us at 120 BPM
+    CHECK(gen.UsPerPulse() == us_per_pulse);
+    CHECK(gen.UsToNextPulse() == us_per_pulse + 1);
+
+    // A bar of 1 ms ticks: 96 pulses after exactly 2 s
+    for (uint32_t ms = 0; ms < 2000; ++ms) {
+        gen.Tick(1000);
+    }
+    CHECK(gen.step() == 0);
+    CHECK(gen.at_step_start());
+
+    // Half a pulse does not advance, the other half does
+    gen.Tick(us_per_pulse / 2);
+    CHECK(gen.step() == 0 && gen.at_step_start());
+    gen.Tick(us_per_pulse - us_per_pulse / 2 + 1);
+    CHECK(!gen.at_step_start());
+
+    // Doubling the tempo halves the pulse
+    gen.SetBpm(2 * kBpmTenths);
+    CHECK(gen.UsPerPulse() == us_per_pulse / 2);
+
+    // A tempo change mid-pulse keeps the fraction of the pulse done: 3/4 of
+    // a pulse at 120 BPM, then 300 BPM plays the last 1/4 of 8333 us
+    gen.SetBpm(kBpmTenths);
+    gen.Tick(gen.UsToNextPulse());
+    gen.Tick(us_per_pulse * 3 / 4);
+    gen.SetBpm(3000);
+    CHECK(gen.UsToNextPulse() >= 2083 && gen.UsToNextPulse() <= 2085);
+    gen.SetBpm(400);
+    CHECK(gen.UsToNextPulse() >= 15625 && gen.UsToNextPulse() <= 15630);
+}
+
+// Snapshots play back through a song, switching on bar lines only
+void TestSnapshotSong() {
+    static GenerativeController gen;
+    gen.Init(11, kBpmTenths);
+    uint32_t first[kNumChannels];
+    uint32_t second[kNumChannels];
+    CopyMasks(gen, first);
+    gen.SaveSnapshot(0);
+    gen.Randomize();
+    CopyMasks(gen, second);
+    gen.SaveSnapshot(1);
+    CHECK(!MasksEqual(gen, first));
+
+    const generative::SongEntry song[2] = {{0, 2}, {1, 1}};
+    gen.SetSong(song, 2, true);
+    gen.StartSong();
+    CHECK(gen.song_active());
+
+    // Still the second patterns until the next bar line
+    Pulses(gen, kPulsesPerBar - 1);
+    CHECK(MasksEqual(gen, second));
+    Pulses(gen, 1);
+    CHECK(gen.step() == 0);
+    CHECK(gen.song_position() == 0);
+    CHECK(MasksEqual(gen, first));
+
+    // Entry 0 repeats for two bars, then entry 1, then the loop
+    Pulses(gen, kPulsesPerBar);
+    CHECK(gen.song_position() == 0 && MasksEqual(gen, first));
+    Pulses(gen, kPulsesPerBar);
+    CHECK(gen.song_position() == 1 && MasksEqual(gen, second));
+    Pulses(gen, kPulsesPerBar);
+    CHECK(gen.song_position() == 0 && MasksEqual(gen, first));
+
+    // Stopping keeps the patterns playing
+    gen.StopSong();
+    Pulses(gen, 2 * kPulsesPerBar);
+    CHECK(!gen.song_active() && MasksEqual(gen, first));
+}
+
+// RequestRandomize() mid-bar: the old patterns play up to the bar line or
+// the next step, the new ones from there, and the step count runs on
+void TestRequestRandomize() {
+    static GenerativeController gen;
+    static GenerativeController expected;
+    const uint8_t swaps[] = {generative::kSwapAtBar, generative::kSwapAtStep};
+    for (const uint8_t swap : swaps) {
+        // The Grids engine draws nothing while playing, so a controller
+        // randomized at once after Init() rolls the same new patterns
+        expected.Init(13, kBpmTenths);
+        expected.Randomize();
+        uint32_t next[kNumChannels];
+        CopyMasks(expected, next);
+
+        gen.Init(13, kBpmTenths);
+        uint32_t old[kNumChannels];
+        CopyMasks(gen, old);
+        CHECK(!MasksEqual(gen, next));
+
+        // Middle pulse of step 10
+        const uint32_t request_pulse = 10 * kPulsesPerStep + 1;
+        Pulses(gen, request_pulse);
+        gen.RequestRandomize(swap);
+        CHECK(gen.randomize_pending() && MasksEqual(gen, old));
+
+        const uint32_t swap_pulse =
+            swap == generative::kSwapAtBar ? kPulsesPerBar : 11 * kPulsesPerStep;
+        bool steps_ok = true;
+        bool masks_ok = true;
+        for (uint32_t pulse = request_pulse + 1; pulse <= kPulsesPerBar + kPulsesPerStep;
+             ++pulse) {
+            gen.ClockPulse();
+            if (gen.step() != (pulse / kPulsesPerStep) % kPatternSteps ||
+                gen.at_step_start() != (pulse % kPulsesPerStep == 0)) {
+                steps_ok = false;
+            }
+            if (!MasksEqual(gen, pulse < swap_pulse ? old : next)) {
+                masks_ok = false;
+            }
+        }
+        CHECK(steps_ok);
+        CHECK(masks_ok);
+        CHECK(!gen.randomize_pending());
+    }
+}
+
+// Cell by cell, the way the rules are defined
+uint32_t ReferenceGeneration(uint32_t row, generative::AutomatonRule rule) {
+    uint32_t next = 0;
+    for (int i = 0; i < 32; ++i) {
+        uint8_t n = 0;
+        if (rule.kind == generative::kAutomatonTotalistic) {
+            for (int d = -2; d <= 2; ++d) {
+                n += (row >> ((i + d + 32) % 32)) & 1;
+            }
+        } else {
+            n = ((row >> ((i + 31) % 32)) & 1) << 2 | ((row >> i) & 1) << 1 |
+                ((row >> ((i + 1) % 32)) & 1);
+        }
+        next |= static_cast<uint32_t>((rule.code >> n) & 1) << i;
+    }
+    return next;
+}
+
+// AutomatonGeneration() on known rows, wrapping between steps 31 and 0, and
+// against the cell by cell rules for rows from a fixed seed
+void TestAutomatonGeneration() {
+    using generative::AutomatonGeneration;
+    using generative::AutomatonRule;
+    const AutomatonRule rule90 = {generative::kAutomatonElementary, 90};
+    const AutomatonRule rule30 = {generative::kAutomatonElementary, 30};
+    const AutomatonRule one_alive = {generative::kAutomatonTotalistic, 1 << 1};
+    CHECK(AutomatonGeneration(0x00000001u, rule90) == 0x80000002u);
+    CHECK(AutomatonGeneration(0x80000000u, rule90) == 0x40000001u);
+    CHECK(AutomatonGeneration(0x00000001u, rule30) == 0x80000003u);
+    CHECK(AutomatonGeneration(0x00000001u, one_alive) == 0xC0000007u);
+    CHECK(AutomatonGeneration(0x00000000u, rule90) == 0);
+
+    uint32_t seed = 17;
+    bool same = true;
+    for (uint32_t code = 0; code < 256; ++code) {
+        for (uint8_t i = 0; i < 8; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const AutomatonRule elementary = {generative::kAutomatonElementary,
+                                              static_cast<uint8_t>(code)};
+            const AutomatonRule totalistic = {generative::kAutomatonTotalistic,
+                                              static_cast<uint8_t>(code & 63)};
+            if (AutomatonGeneration(seed, elementary) != ReferenceGeneration(seed, elementary) ||
+                AutomatonGeneration(seed, totalistic) != ReferenceGeneration(seed, totalistic)) {
+                same = false;
+            }
+        }
+    }
+    CHECK(same);
+}
+
+// The Markov engine: nothing learnt keeps the patterns playing; after a
+// fixed bar is learnt, channel 0 plays it back and the silent channels stay
+// silent; Clear() forgets it
+void TestMarkovModel() {
+    static GenerativeController gen;
+    gen.Init(21, kBpmTenths);
+    gen.SetEngine(generative::kEngineMarkov);
+    generative::MarkovModel& markov = gen.markov();
+    markov.Clear();
+    uint32_t before[kNumChannels];
+    CopyMasks(gen, before);
+    Pulses(gen, kPulsesPerBar);
+    CHECK(markov.bars() == 0 && MasksEqual(gen, before));
+
+    // 40 bars of quarter notes on channel 0, the downbeat high
+    const uint32_t quarters = 0x11111111u;
+    for (uint32_t bar = 0; bar < 40; ++bar) {
+        for (uint8_t s = 0; s < kPatternSteps; s += 4) {
+            markov.Observe(0, bar * kPatternSteps + s, s == 0);
+        }
+    }
+    markov.Flush();
+    CHECK(markov.bars() == 40);
+
+    // The chances never quite reach 0 or 1 (about 1 stray step in 320 after
+    // 40 bars): a fixed seed reproduces the bar exactly, and over many draws
+    // nearly every step agrees with it
+    markov.Seed(3);
+    bool learnt = true;
+    for (uint8_t round = 0; round < 4; ++round) {
+        uint32_t velocity;
+        if (markov.Sample(0, false, &velocity) != quarters || velocity != 1) {
+            learnt = false;
+        }
+        if (markov.Sample(1, false, &velocity) != 0) {
+            learnt = false;
+        }
+    }
+    CHECK(learnt);
+    uint32_t stray_steps = 0;
+    for (uint8_t round = 0; round < 64; ++round) {
+        uint32_t velocity;
+        stray_steps += __builtin_popcount(markov.Sample(0, false, &velocity) ^ quarters);
+        stray_steps += __builtin_popcount(markov.Sample(1, false, &velocity));
+    }
+    CHECK(stray_steps * 100 < 64 * 2 * kPatternSteps);
+
+    // The engine draws the next bar from the model
+    Pulses(gen, kPulsesPerBar);
+    CHECK(gen.TriggerMask(0) == quarters && gen.channel(0).velocity_bits == 1);
+    CHECK(gen.TriggerMask(1) == 0);
+
+    markov.Clear();
+    CHECK(markov.bars() == 0);
+    uint32_t velocity;
+    CHECK(markov.Sample(0, false, &velocity) != quarters);
+    CopyMasks(gen, before);
+    Pulses(gen, kPulsesPerBar);
+    CHECK(MasksEqual(gen, before));
+}
+
+// Sum of the rows' fitness, each against the steps two others fire on
+int32_t PopulationFitness(const generative::Evolver& evolver, const uint32_t* rows,
+                          uint8_t count) {
+    int32_t total = 0;
+    for (uint8_t i = 0; i < count; ++i) {
+        uint32_t once = 0;
+        uint32_t crowded = 0;
+        for (uint8_t j = 0; j < count; ++j) {
+            if (j != i) {
+                crowded |= once & rows[j];
+                once |= rows[j];
+            }
+        }
+        total += evolver.Fitness(rows[i], crowded);
+    }
+    return total;
+}
+
+// Selection improves on a population far from the targets and keeps the
+// gain; a slightly worse mutant can win a generation, so the check is on
+// where the run ends up. The same seed gives the same run.
+void TestEvolver() {
+    static generative::Evolver a;
+    static generative::Evolver b;
+    const generative::EvolveTargets targets = {6, 2, 2};
+    a.SetTargets(targets);
+    b.SetTargets(targets);
+    a.Seed(31);
+    b.Seed(31);
+
+    // Solid and silent rows
+    uint32_t rows_a[kNumChannels];
+    uint32_t rows_b[kNumChannels];
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        rows_a[i] = rows_b[i] = (i & 1) ? 0xFFFFFFFFu : 0;
+    }
+    const int32_t start = PopulationFitness(a, rows_a, kNumChannels);
+    int32_t best = start;
+    bool same = true;
+    for (uint8_t generation = 0; generation < 200; ++generation) {
+        a.Generation(rows_a, kNumChannels);
+        b.Generation(rows_b, kNumChannels);
+        same = same && !memcmp(rows_a, rows_b, sizeof(rows_a));
+        const int32_t fitness = PopulationFitness(a, rows_a, kNumChannels);
+        if (fitness > best) {
+            best = fitness;
+        }
+        if (generation == 49) {
+            CHECK(fitness > start);
+        }
+    }
+    const int32_t end = PopulationFitness(a, rows_a, kNumChannels);
+    CHECK(same);
+    CHECK(end > start);
+    // Within the drift slack (5 per row) of the best generation
+    CHECK(end >= best - kNumChannels * 5);
+
+    // Another seed, another run
+    b.Seed(32);
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        rows_b[i] = (i & 1) ? 0xFFFFFFFFu : 0;
+    }
+    for (uint8_t generation = 0; generation < 200; ++generation) {
+        b.Generation(rows_b, kNumChannels);
+    }
+    CHECK(memcmp(rows_a, rows_b, sizeof(rows_a)));
+}
+
+// Turing engine: chance 0 locks every register, so the hits repeat bar after
+// bar; the highest chance flips nearly every step as it comes round
+void TestTuringChance() {
+    static GenerativeController gen;
+    gen.Init(23, kBpmTenths);
+    gen.SetEngine(generative::kEngineTuring);
+    gen.SetTuringChance(0);
+    uint32_t locked[kNumChannels];
+    CopyMasks(gen, locked);
+    static uint8_t first[kPulsesPerBar];
+    static uint8_t second[kPulsesPerBar];
+    for (uint32_t i = 0; i < kPulsesPerBar; ++i) {
+        first[i] = gen.ClockPulse().gpio_mask;
+    }
+    for (uint32_t i = 0; i < kPulsesPerBar; ++i) {
+        second[i] = gen.ClockPulse().gpio_mask;
+    }
+    CHECK(!memcmp(first, second, sizeof(first)));
+    CHECK(MasksEqual(gen, locked));
+
+    gen.SetTuringChance(255);
+    Pulses(gen, kPulsesPerBar);
+    bool flipped = true;
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        if (__builtin_popcount(gen.TriggerMask(i) ^ locked[i]) < kPatternSteps - 4) {
+            flipped = false;
+        }
+    }
+    CHECK(flipped);
+}
+
+}  // namespace
+
+int main() {
+    Run("determinism", TestDeterminism);
+    Run("hit_range", TestHitRange);
+    Run("feature_ranges", TestFeatureRanges);
+    Run("tap_tempo_kept", TestTapTempoKept);
+    Run("clock_resolution_kept", TestClockResolutionKept);
+    Run("step_advance", TestStepAdvance);
+    Run("pulse_advance", TestPulseAdvance);
+    Run("snapshot_song", TestSnapshotSong);
+    Run("request_randomize", TestRequestRandomize);
+    Run("automaton_generation", TestAutomatonGeneration);
+    Run("markov_model", TestMarkovModel);
+    Run("evolver", TestEvolver);
+    Run("turing_chance", TestTuringChance);
+    if (failures) {
+        printf("%u test(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Digest of the complete Grids drum map output.
+//
+// Usage: grids_digest [--threads N]
+//
+// Evaluates PatternGenerator::GetDrumMapLevel() for every x, y (0-255),
+// instrument (0-2) and step (0-31), about 6.3M lookups, and prints a 64-bit
+// FNV-1a digest of the results. Each x column is hashed on its own and the
+// column digests are combined in order, so the result does not depend on the
+// thread count. Exits with status 1 if the digest differs from kGoldenDigest,
+// which was recorded from the reference ReadDrumMap()/U8Mix() implementation.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "grids/pattern_generator.h"
+
+namespace {
+
+const uint64_t kGoldenDigest = 0x70921b1b254e996eull;
+
+const uint64_t kFnvOffset = 0xcbf29ce484222325ull;
+const uint64_t kFnvPrime = 0x100000001b3ull;
+
+inline uint64_t FnvByte(uint64_t hash, uint8_t byte) {
+    return (hash ^ byte) * kFnvPrime;
+}
+
+uint64_t HashColumn(uint8_t x) {
+    uint64_t hash = kFnvOffset;
+    for (uint16_t y = 0; y < 256; ++y) {
+        for (uint8_t instrument = 0; instrument < grids::kNumParts; ++instrument) {
+            for (uint8_t step = 0; step < grids::kStepsPerPattern; ++step) {
+                hash = FnvByte(hash, grids::PatternGenerator::GetDrumMapLevel(
+                    step, instrument, x, static_cast<uint8_t>(y)));
+            }
+        }
+    }
+    return hash;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    unsigned num_threads = std::thread::hardware_concurrency();
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            num_threads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 0));
+        } else {
+            fprintf(stderr, "usage: %s [--threads N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    uint64_t columns[256];
+    std::atomic<unsigned> next_x(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < num_threads; ++t) {
+        workers.emplace_back([&]() {
+            for (unsigned x = next_x++; x < 256; x = next_x++) {
+                columns[x] = HashColumn(static_cast<uint8_t>(x));
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    uint64_t digest = kFnvOffset;
+    for (unsigned x = 0; x < 256; ++x) {
+        for (uint8_t shift = 0; shift < 64; shift += 8) {
+            digest = FnvByte(digest, static_cast<uint8_t>(columns[x] >> shift));
+        }
+    }
+
+    const double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    const bool match = digest == kGoldenDigest;
+    printf("grids drum map digest: %016" PRIx64 " (%s, %u threads, %.1f ms)\n",
+           digest, match ? "matches golden" : "MISMATCH", num_threads, elapsed_ms);
+    if (!match) {
+        printf("expected:              %016" PRIx64 "\n", kGoldenDigest);
+    }
+    return match ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+// Generates src/generative/pattern_dict.cc.
+//
+// Usage: pattern_dict OUTPUT.cc
+//
+// Renders the 32-step trigger mask of every cell of the pattern index grid
+// (see generative/pattern_index.h), deduplicates the masks into a dictionary
+// and writes the dictionary plus one dictionary index per cell. The firmware
+// then fetches a channel's pattern with a single indexed read instead of 32
+// bilinear drum map interpolations.
+//
+// Also reports how many distinct masks the complete drum map yields over all
+// x, y, part and density values (8-bit each), for comparison.
+
+#include <stdio.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "generative/generative_controller.h"
+#include "generative/pattern_index.h"
+#include "grids/pattern_generator.h"
+#include "grids/resources.h"
+
+using namespace generative;
+
+namespace {
+
+uint32_t RenderMask(uint8_t part, uint8_t x, uint8_t y, uint8_t density) {
+    const uint8_t threshold = 255 - density;
+    uint32_t mask = 0;
+    for (uint8_t step = 0; step < kPatternSteps; ++step) {
+        if (grids::PatternGenerator::GetDrumMapLevel(step, part, x, y) > threshold) {
+            mask |= 1u << step;
+        }
+    }
+    return mask;
+}
+
+// Distinct masks over every 8-bit x, y, part and density. For a fixed
+// (part, x, y) the mask only changes where the threshold crosses one of the
+// 32 levels, so each position contributes at most 33 masks.
+size_t CountFullSpaceMasks() {
+    std::unordered_set<uint32_t> masks;
+    uint8_t levels[kPatternSteps];
+    for (uint8_t part = 0; part < grids::kNumParts; ++part) {
+        for (uint16_t x = 0; x < 256; ++x) {
+            for (uint16_t y = 0; y < 256; ++y) {
+                for (uint8_t step = 0; step < kPatternSteps; ++step) {
+                    levels[step] = grids::PatternGenerator::GetDrumMapLevel(
+                        step, part, static_cast<uint8_t>(x), static_cast<uint8_t>(y));
+                }
+                masks.insert(0);
+                for (uint8_t t = 0; t < kPatternSteps; ++t) {
+                    // Threshold just below levels[t]: every step at or above fires
+                    uint32_t mask = 0;
+                    for (uint8_t step = 0; step < kPatternSteps; ++step) {
+                        if (levels[step] >= levels[t] && levels[t] > 0) {
+                            mask |= 1u << step;
+                        }
+                    }
+                    masks.insert(mask);
+                }
+            }
+        }
+    }
+    return masks.size();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s OUTPUT.cc\n", argv[0]);
+        return 2;
+    }
+    const char* out_path = argv[1];
+
+    std::vector<uint32_t> dict;
+    std::unordered_map<uint32_t, uint16_t> dict_slot;
+    std::vector<uint16_t> cell_index(kIndexCells);
+    for (uint16_t cell = 0; cell < kIndexCells; ++cell) {
+        const uint32_t mask = RenderMask(IndexCellPart(cell), IndexCellX(cell),
+                                         IndexCellY(cell), IndexCellDensity(cell));
+        auto it = dict_slot.find(mask);
+        if (it == dict_slot.end()) {
+            it = dict_slot.emplace(mask, static_cast<uint16_t>(dict.size())).first;
+            dict.push_back(mask);
+        }
+        cell_index[cell] = it->second;
+    }
+
+    const size_t node_bytes = 25 * NODE_0_SIZE;
+    const size_t raw_bytes = kIndexCells * sizeof(uint32_t);
+    const size_t dict_bytes = dict.size() * sizeof(uint32_t) + kIndexCells * sizeof(uint16_t);
+    const size_t full_masks = CountFullSpaceMasks();
+
+    FILE* out = fopen(out_path, "w");
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+    fprintf(out,
+            "// Deduplicated trigger mask dictionary of the pattern index grid.\n"
+            "//\n"
+            "// Automatically generated with:\n"
+            "// make pattern-dict\n"
+            "//\n"
+            "// %u cells -> %zu distinct masks, %zu bytes of flash\n"
+            "// (%zu bytes as one mask per cell).\n"
+            "\n"
+            "#include \"generative/pattern_dict.h\"\n"
+            "\n"
+            "namespace generative {\n"
+            "\n"
+            "const uint16_t kPatternDictSize = %zu;\n"
+            "\n"
+            "const uint32_t kPatternDict[] = {\n",
+            kIndexCells, dict.size(), dict_bytes, raw_bytes, dict.size());
+    for (size_t i = 0; i < dict.size(); ++i) {
+        fprintf(out, "%s0x%08x,%s", i % 6 == 0 ? "  " : " ", dict[i],
+                i % 6 == 5 || i + 1 == dict.size() ? "\n" : "");
+    }
+    fprintf(out, "};\n\nconst uint16_t kPatternDictIndex[kIndexCells] = {\n");
+    for (size_t i = 0; i < cell_index.size(); ++i) {
+        fprintf(out, "%s%4u,%s", i % 12 == 0 ? "  " : " ", cell_index[i],
+                i % 12 == 11 ? "\n" : "");
+    }
+    fprintf(out, "};\n\n}  // namespace generative\n");
+    fclose(out);
+
+    printf("grid:      %u cells -> %zu distinct masks\n", kIndexCells, dict.size());
+    printf("flash:     %zu bytes (dictionary + uint16 index) vs %zu bytes (mask per cell)\n",
+           dict_bytes, raw_bytes);
+    printf("drum map:  %zu bytes of node tables\n", node_bytes);
+    printf("full map:  %zu distinct masks over all 8-bit x, y, part, density\n", full_masks);
+    printf("-> %s\n", out_path);
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Generates src/generative/pattern_index.cc.
+//
+// Usage: pattern_indexer [--threads N] OUTPUT.cc
+//
+// Renders the 32-step trigger pattern of every (drum part, x, y, density)
+// cell of the index grid (see generative/pattern_index.h) across all cores,
+// computes its features and writes the cells sorted by syncopation level,
+// downbeat level and hit count, plus the offsets of every bucket, as
+// flash-resident tables. A hit count histogram is printed to stdout.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "generative/generative_controller.h"
+#include "generative/pattern_index.h"
+#include "grids/pattern_generator.h"
+
+using namespace generative;
+
+namespace {
+
+uint32_t RenderCell(uint16_t cell) {
+    const uint8_t part = IndexCellPart(cell);
+    const uint8_t x = IndexCellX(cell);
+    const uint8_t y = IndexCellY(cell);
+    const uint8_t threshold = 255 - IndexCellDensity(cell);
+    uint32_t mask = 0;
+    for (uint8_t step = 0; step < kPatternSteps; ++step) {
+        if (grids::PatternGenerator::GetDrumMapLevel(step, part, x, y) > threshold) {
+            mask |= 1u << step;
+        }
+    }
+    return mask;
+}
+
+struct Row {
+    uint16_t cell;
+    PatternFeatures features;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    unsigned num_threads = std::thread::hardware_concurrency();
+    const char* out_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            num_threads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 0));
+        } else if (argv[i][0] != '-' && !out_path) {
+            out_path = argv[i];
+        } else {
+            out_path = nullptr;
+            break;
+        }
+    }
+    if (!out_path) {
+        fprintf(stderr, "usage: %s [--threads N] OUTPUT.cc\n", argv[0]);
+        return 2;
+    }
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+
+    // Render every cell; the drum map is read-only, so threads share nothing
+    std::vector<Row> rows(kIndexCells);
+    std::atomic<unsigned> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < num_threads; ++t) {
+        workers.emplace_back([&]() {
+            for (unsigned cell = next++; cell < kIndexCells; cell = next++) {
+                rows[cell].cell = static_cast<uint16_t>(cell);
+                rows[cell].features = ComputePatternFeatures(RenderCell(cell));
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    auto bucket_key = [](const Row& row) {
+        return (SyncopationLevel(row.features.syncopation) * kIndexFeatureLevels +
+                DownbeatLevel(row.features.downbeat)) * (kIndexMaxHits + 1) + row.features.hits;
+    };
+    std::stable_sort(rows.begin(), rows.end(), [&](const Row& a, const Row& b) {
+        return bucket_key(a) < bucket_key(b);
+    });
+
+    uint16_t buckets[kIndexFeatureLevels][kIndexFeatureLevels][kIndexMaxHits + 2] = {};
+    uint16_t by_hits[kIndexMaxHits + 1] = {0};
+    for (const Row& row : rows) {
+        buckets[SyncopationLevel(row.features.syncopation)]
+               [DownbeatLevel(row.features.downbeat)][row.features.hits + 1]++;
+        by_hits[row.features.hits]++;
+    }
+    uint16_t offset = 0;
+    for (uint8_t s = 0; s < kIndexFeatureLevels; ++s) {
+        for (uint8_t d = 0; d < kIndexFeatureLevels; ++d) {
+            buckets[s][d][0] = offset;
+            for (uint8_t h = 1; h < kIndexMaxHits + 2; ++h) {
+                buckets[s][d][h] += buckets[s][d][h - 1];
+            }
+            offset = buckets[s][d][kIndexMaxHits + 1];
+        }
+    }
+
+    FILE* out = fopen(out_path, "w");
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+    fprintf(out,
+            "// Pattern index of the Grids drum map.\n"
+            "//\n"
+            "// Automatically generated with:\n"
+            "// make pattern-index\n"
+            "//\n"
+            "// %u cells, %u bytes of flash.\n"
+            "\n"
+            "#include \"generative/pattern_index.h\"\n"
+            "\n"
+            "namespace generative {\n"
+            "\n"
+            "const PatternIndexEntry kPatternIndex[kIndexCells] = {\n",
+            kIndexCells,
+            static_cast<unsigned>(sizeof(PatternIndexEntry) * kIndexCells + sizeof(buckets)));
+    for (size_t i = 0; i < rows.size(); ++i) {
+        fprintf(out, "%s{%5u, %3u, %3u},%s",
+                i % 4 == 0 ? "  " : " ",
+                rows[i].cell, rows[i].features.syncopation, rows[i].features.downbeat,
+                i % 4 == 3 ? "\n" : "");
+    }
+    fprintf(out, "};\n\nconst uint16_t kPatternIndexBuckets[kIndexFeatureLevels][kIndexFeatureLevels]\n"
+                 "                                 [kIndexMaxHits + 2] = {\n");
+    for (uint8_t s = 0; s < kIndexFeatureLevels; ++s) {
+        fprintf(out, "  {\n");
+        for (uint8_t d = 0; d < kIndexFeatureLevels; ++d) {
+            fprintf(out, "    {  // syncopation %u, downbeat %u\n", s, d);
+            for (uint8_t h = 0; h < kIndexMaxHits + 2; ++h) {
+                fprintf(out, "%s%5u,%s", h % 8 == 0 ? "      " : " ", buckets[s][d][h],
+                        h % 8 == 7 || h == kIndexMaxHits + 1 ? "\n" : "");
+            }
+            fprintf(out, "    },\n");
+        }
+        fprintf(out, "  },\n");
+    }
+    fprintf(out, "};\n\n}  // namespace generative\n");
+    fclose(out);
+
+    printf("%u cells rendered on %u threads -> %s\n", kIndexCells, num_threads, out_path);
+    for (uint8_t h = 0; h <= kIndexMaxHits; ++h) {
+        printf("  %2u hits: %4u cells\n", h, by_hits[h]);
+    }
+    return 0;
+}
@@ -0,0 +1,512 @@
+// Offline renderer: GenerativeController output as a Standard MIDI File.
+//
+// Usage: pattern_render [--seed N] [--bpm B] [--bars N] [--script FILE]
+//                       [-o OUT.mid]
+//        pattern_render --seeds COUNT --out-dir DIR [--seed FIRST] [-j N] ...
+//
+// Runs the engine exactly as app.cpp does after start_generative(seed) and
+// writes every trigger as a note: channel i plays note 48 + i, so a file sent
+// back to the board in MIDI mode drives the same solenoid (note % 8). High
+// velocity steps (100 ms pulses) are written with velocity 127, low ones (1 ms)
+// with velocity 1, which MIDI mode turns back into the same pulse widths.
+//
+// The file is format 0 at 960 ticks per quarter note, 40 ticks per 24 PPQN
+// pulse, so every step lands exactly on the grid. Tick 0 is the moment the
+// engine starts; like on the board, step 0 first sounds when the pattern
+// wraps, one bar later. Note lengths are rounded to the nearest tick at the tempo in effect at
+// note on; a solenoid retriggered while still on is released first.
+//
+// The optional script changes parameters at bar boundaries, one command per
+// line, '#' starts a comment:
+//
+//   at <bar> bpm <bpm>          set the tempo (e.g. 132.5)
+//   at <bar> hits <min> <max>   hit range for following randomizes
+//   at <bar> randomize          re-roll all channels now, restarting the bar
+//   at <bar> press [bar|step]   a short key press: new patterns rolled aside
+//                               and swapped in at the next bar line (default)
+//                               or step, the pattern playing on
+//   at <bar> save <slot>        store the current patterns in snapshot 0-7
+//   at <bar> song [loop] <slot>x<bars> ...
+//                               play a chain of snapshots; the first one
+//                               starts on the next bar line (bar + 1)
+//   at <bar> stop               leave song mode, keep the current patterns
+//   at <bar> engine grids       back to fixed patterns
+//   at <bar> engine automaton [<rule> | t<code>]
+//                               evolve each channel every bar from the next
+//                               bar line, by an elementary rule 0-255 or a
+//                               5-cell totalistic code 0-63 (default 90)
+//   at <bar> engine evolve [<density> [<syncopation> [<overlap>]]]
+//                               breed the patterns towards the targets, one
+//                               generation per bar (default 8 2 2)
+//   at <bar> engine turing [<chance>]
+//                               flip each step's bit with chance/256 as it
+//                               comes round (0-255, default 16)
+//
+// With --seeds, COUNT consecutive seeds are rendered to DIR/seed_<seed>.mid.
+// The engine keeps global state (grids::PatternGenerator), so the batch is
+// split across forked worker processes rather than threads.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "generative/generative_controller.h"
+#include "grids/pattern_generator.h"
+
+namespace {
+
+const uint16_t kTicksPerQuarter = 960;
+const uint16_t kTicksPerPulse = kTicksPerQuarter / 24;
+const uint32_t kPulsesPerBar = grids::kPulsesPerStep * generative::kPatternSteps;
+const uint8_t kFirstNote = 48;
+
+enum CommandType {
+    CMD_BPM, CMD_HITS, CMD_RANDOMIZE, CMD_PRESS, CMD_SAVE, CMD_SONG, CMD_STOP, CMD_ENGINE
+};
+
+struct Command {
+    uint32_t bar;
+    CommandType type;
+    uint32_t arg0;
+    uint32_t arg1;
+    std::vector<generative::SongEntry> song;
+};
+
+struct Config {
+    uint32_t seed = 1;
+    uint32_t seeds = 0;  // 0 = single file
+    uint32_t bpm_tenths = 1200;
+    uint32_t bars = 8;
+    const char* out_path = "pattern.mid";
+    const char* out_dir = nullptr;
+    unsigned workers = 0;
+    std::vector<Command> script;
+};
+
+struct MidiEvent {
+    uint32_t tick;
+    uint8_t order;  // at equal ticks: tempo, then note off, then note on
+    uint8_t bytes[6];
+    uint8_t size;
+};
+
+void PutVlq(std::vector<uint8_t>* out, uint32_t value) {
+    uint8_t buf[5];
+    uint8_t n = 0;
+    buf[n++] = value & 0x7F;
+    while (value >>= 7) {
+        buf[n++] = 0x80 | (value & 0x7F);
+    }
+    while (n) {
+        out->push_back(buf[--n]);
+    }
+}
+
+void PutBe(std::vector<uint8_t>* out, uint32_t value, uint8_t bytes) {
+    while (bytes--) {
+        out->push_back(static_cast<uint8_t>(value >> (8 * bytes)));
+    }
+}
+
+MidiEvent Tempo(uint32_t tick, uint32_t bpm_tenths) {
+    const uint32_t us_per_quarter = (600000000u + bpm_tenths / 2) / bpm_tenths;
+    MidiEvent e = {tick, 0, {0xFF, 0x51, 0x03, static_cast<uint8_t>(us_per_quarter >> 16),
+                             static_cast<uint8_t>(us_per_quarter >> 8),
+                             static_cast<uint8_t>(us_per_quarter)}, 6};
+    return e;
+}
+
+MidiEvent Note(uint32_t tick, bool on, uint8_t channel, uint8_t velocity) {
+    MidiEvent e = {tick, static_cast<uint8_t>(on ? 2 : 1),
+                   {static_cast<uint8_t>(on ? 0x90 : 0x80),
+                    static_cast<uint8_t>(kFirstNote + channel), velocity}, 3};
+    return e;
+}
+
+// Renders one seed; returns the number of notes, or -1 if the file can't be written
+long Render(const Config& config, uint32_t seed, const char* path) {
+    generative::GenerativeController gen;
+    gen.Init(seed, config.bpm_tenths);
+
+    uint32_t bpm_tenths = config.bpm_tenths;
+    std::vector<MidiEvent> events;
+    events.push_back(Tempo(0, bpm_tenths));
+
+    bool held[generative::kNumChannels] = {false};
+    uint32_t off_tick[generative::kNumChannels] = {0};  // note off of a held note
+    size_t next_cmd = 0;
+    long notes = 0;
+
+    // Step s of a bar is evaluated on its pulse 3 * s. Script commands take
+    // effect just after a bar's pulse 0, so a randomize (which restarts the
+    // pattern) keeps the steps on the bar grid.
+    const uint32_t total_pulses = config.bars * kPulsesPerBar;
+    for (uint32_t pulse = 1; pulse < total_pulses; ++pulse) {
+        if ((pulse - 1) % kPulsesPerBar == 0) {
+            const uint32_t bar = (pulse - 1) / kPulsesPerBar;
+            for (; next_cmd < config.script.size() && config.script[next_cmd].bar <= bar; ++next_cmd) {
+                const Command& cmd = config.script[next_cmd];
+                const uint32_t tick = bar * kPulsesPerBar * kTicksPerPulse;
+                if (cmd.type == CMD_BPM) {
+                    bpm_tenths = cmd.arg0;
+                    gen.SetBpm(bpm_tenths);
+                    events.push_back(Tempo(tick, bpm_tenths));
+                } else if (cmd.type == CMD_HITS) {
+                    gen.SetHitRange(cmd.arg0, cmd.arg1);
+                } else if (cmd.type == CMD_PRESS) {
+                    gen.RequestRandomize(cmd.arg0);
+                } else if (cmd.type == CMD_SAVE) {
+                    gen.SaveSnapshot(cmd.arg0);
+                } else if (cmd.type == CMD_SONG) {
+                    gen.SetSong(cmd.song.data(), cmd.song.size(), cmd.arg0 != 0);
+                    gen.StartSong();
+                } else if (cmd.type == CMD_STOP) {
+                    gen.StopSong();
+                } else if (cmd.type == CMD_ENGINE) {
+                    gen.SetEngine(cmd.arg0);
+                    if (cmd.arg0 == generative::kEngineAutomaton) {
+                        generative::AutomatonRule rule;
+                        rule.kind = cmd.arg1 >> 8;
+                        rule.code = cmd.arg1 & 0xFF;
+                        gen.SetAutomatonRule(rule);
+                    } else if (cmd.arg0 == generative::kEngineEvolve) {
+                        generative::EvolveTargets targets;
+                        targets.density = cmd.arg1 & 0xFF;
+                        targets.syncopation = (cmd.arg1 >> 8) & 0xFF;
+                        targets.overlap = cmd.arg1 >> 16;
+                        gen.evolver().SetTargets(targets);
+                    } else if (cmd.arg0 == generative::kEngineTuring) {
+                        gen.SetTuringChance(cmd.arg1);
+                    }
+                } else {
+                    gen.Randomize();
+                }
+            }
+        }
+
+        const generative::FireEvent event = gen.Tick(gen.UsToNextPulse());
+        if (!event.gpio_mask) {
+            continue;
+        }
+        const uint32_t tick = pulse * kTicksPerPulse;
+        // Ticks last 25e6 / bpm_tenths / 40 us
+        const double us_per_tick = 25000000.0 / bpm_tenths / kTicksPerPulse;
+        for (uint8_t i = 0; i < generative::kNumChannels; ++i) {
+            if (!(event.gpio_mask & (1 << i))) {
+                continue;
+            }
+            if (held[i]) {
+                events.push_back(Note(std::min(off_tick[i], tick), false, i, 0));
+            }
+            const bool high = event.duration_ms[i] > 1;
+            uint32_t length = static_cast<uint32_t>(event.duration_ms[i] * 1000.0 / us_per_tick + 0.5);
+            length = std::max<uint32_t>(length, 1);
+            events.push_back(Note(tick, true, i, high ? 127 : 1));
+            held[i] = true;
+            off_tick[i] = tick + length;
+            notes++;
+        }
+    }
+    for (uint8_t i = 0; i < generative::kNumChannels; ++i) {
+        if (held[i]) {
+            events.push_back(Note(off_tick[i], false, i, 0));
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const MidiEvent& a, const MidiEvent& b) {
+        return a.tick != b.tick ? a.tick < b.tick : a.order < b.order;
+    });
+    std::vector<uint8_t> track;
+    const char name[] = "miditosolenoid generative";
+    track.push_back(0x00);
+    track.push_back(0xFF);
+    track.push_back(0x03);
+    PutVlq(&track, sizeof(name) - 1);
+    track.insert(track.end(), name, name + sizeof(name) - 1);
+    const uint8_t time_signature[] = {0x00, 0xFF, 0x58, 0x04, 4, 2, 24, 8};
+    track.insert(track.end(), time_signature, time_signature + sizeof(time_signature));
+
+    uint32_t last_tick = 0;
+    for (const MidiEvent& e : events) {
+        PutVlq(&track, e.tick - last_tick);
+        last_tick = e.tick;
+        track.insert(track.end(), e.bytes, e.bytes + e.size);
+    }
+    const uint32_t end_tick = config.bars * kPulsesPerBar * kTicksPerPulse;
+    PutVlq(&track, end_tick > last_tick ? end_tick - last_tick : 0);
+    track.push_back(0xFF);
+    track.push_back(0x2F);
+    track.push_back(0x00);
+
+    std::vector<uint8_t> file;
+    file.insert(file.end(), {'M', 'T', 'h', 'd'});
+    PutBe(&file, 6, 4);
+    PutBe(&file, 0, 2);  // format 0
+    PutBe(&file, 1, 2);  // one track
+    PutBe(&file, kTicksPerQuarter, 2);
+    file.insert(file.end(), {'M', 'T', 'r', 'k'});
+    PutBe(&file, static_cast<uint32_t>(track.size()), 4);
+    file.insert(file.end(), track.begin(), track.end());
+
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return -1;
+    }
+    const bool ok = fwrite(file.data(), 1, file.size(), out) == file.size();
+    if (fclose(out) != 0 || !ok) {
+        perror(path);
+        return -1;
+    }
+    return notes;
+}
+
+uint32_t ParseBpm(const char* s) {
+    return static_cast<uint32_t>(atof(s) * 10 + 0.5);
+}
+
+// "grids", "automaton [<rule> | t<code>]", "evolve [<density> [<syncopation>
+// [<overlap>]]]" or "turing [<chance>]". The automaton rule goes in arg1 as
+// kind << 8 | code, the evolve targets as overlap << 16 | syncopation << 8 |
+// density, the Turing chance as is.
+bool ParseEngine(char** argv, int argc, Command* cmd) {
+    if (!strcmp(argv[0], "grids") && argc == 1) {
+        cmd->arg0 = generative::kEngineGrids;
+        return true;
+    }
+    if (!strcmp(argv[0], "automaton") && argc <= 2) {
+        cmd->arg0 = generative::kEngineAutomaton;
+        cmd->arg1 = 90;
+        if (argc == 2) {
+            const bool totalistic = argv[1][0] == 't';
+            char* end;
+            const unsigned long code = strtoul(argv[1] + (totalistic ? 1 : 0), &end, 0);
+            if (*end || code > (totalistic ? 63u : 255u)) {
+                return false;
+            }
+            cmd->arg1 = (totalistic ? generative::kAutomatonTotalistic << 8 : 0) | code;
+        }
+        return true;
+    }
+    if (!strcmp(argv[0], "evolve") && argc <= 4) {
+        static const unsigned long kDefaults[3] = {8, 2, 2};
+        static const unsigned long kLimits[3] = {16, 12, 15};
+        cmd->arg0 = generative::kEngineEvolve;
+        cmd->arg1 = 0;
+        for (int i = 0; i < 3; ++i) {
+            unsigned long value = kDefaults[i];
+            if (i + 1 < argc) {
+                char* end;
+                value = strtoul(argv[i + 1], &end, 0);
+                if (*end || value > kLimits[i]) {
+                    return false;
+                }
+            }
+            cmd->arg1 |= value << (8 * i);
+        }
+        return true;
+    }
+    if (!strcmp(argv[0], "turing") && argc <= 2) {
+        cmd->arg0 = generative::kEngineTuring;
+        cmd->arg1 = 16;
+        if (argc == 2) {
+            char* end;
+            const unsigned long chance = strtoul(argv[1], &end, 0);
+            if (*end || chance > 255) {
+                return false;
+            }
+            cmd->arg1 = chance;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool LoadScript(const char* path, std::vector<Command>* script) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    char line[256];
+    uint32_t line_no = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), in)) {
+        line_no++;
+        if (char* comment = strchr(line, '#')) {
+            *comment = '\0';
+        }
+        char* argv[24];
+        int argc = 0;
+        for (char* tok = strtok(line, " \t\r\n"); tok && argc < 24; tok = strtok(nullptr, " \t\r\n")) {
+            argv[argc++] = tok;
+        }
+        if (argc == 0) {
+            continue;
+        }
+        Command cmd = {0, CMD_RANDOMIZE, 0, 0, {}};
+        ok = argc >= 3 && !strcmp(argv[0], "at");
+        if (ok) {
+            cmd.bar = strtoul(argv[1], nullptr, 0);
+            if (!strcmp(argv[2], "bpm") && argc == 4) {
+                cmd.type = CMD_BPM;
+                cmd.arg0 = ParseBpm(argv[3]);
+                ok = cmd.arg0 > 0;
+            } else if (!strcmp(argv[2], "hits") && argc == 5) {
+                cmd.type = CMD_HITS;
+                cmd.arg0 = strtoul(argv[3], nullptr, 0);
+                cmd.arg1 = strtoul(argv[4], nullptr, 0);
+            } else if (!strcmp(argv[2], "press") && argc <= 4) {
+                cmd.type = CMD_PRESS;
+                cmd.arg0 = generative::kSwapAtBar;
+                if (argc == 4) {
+                    ok = !strcmp(argv[3], "bar") || !strcmp(argv[3], "step");
+                    if (!strcmp(argv[3], "step")) {
+                        cmd.arg0 = generative::kSwapAtStep;
+                    }
+                }
+            } else if (!strcmp(argv[2], "save") && argc == 4) {
+                cmd.type = CMD_SAVE;
+                cmd.arg0 = strtoul(argv[3], nullptr, 0);
+                ok = cmd.arg0 < generative::kMaxSnapshots;
+            } else if (!strcmp(argv[2], "song") && argc >= 4) {
+                cmd.type = CMD_SONG;
+                int first = 3;
+                if (!strcmp(argv[3], "loop")) {
+                    cmd.arg0 = 1;
+                    first = 4;
+                }
+                for (int a = first; ok && a < argc; ++a) {
+                    unsigned slot, bars;
+                    ok = sscanf(argv[a], "%ux%u", &slot, &bars) == 2 &&
+                         slot < generative::kMaxSnapshots && bars >= 1 && bars <= 255;
+                    cmd.song.push_back({static_cast<uint8_t>(slot), static_cast<uint8_t>(bars)});
+                }
+                ok = ok && !cmd.song.empty() && cmd.song.size() <= generative::kMaxSongEntries;
+            } else if (!strcmp(argv[2], "stop") && argc == 3) {
+                cmd.type = CMD_STOP;
+            } else if (!strcmp(argv[2], "engine") && argc >= 4) {
+                cmd.type = CMD_ENGINE;
+                ok = ParseEngine(argv + 3, argc - 3, &cmd);
+            } else {
+                ok = !strcmp(argv[2], "randomize") && argc == 3;
+            }
+        }
+        if (ok) {
+            script->push_back(cmd);
+        } else {
+            fprintf(stderr, "%s:%u: bad command\n", path, line_no);
+        }
+    }
+    fclose(in);
+    std::stable_sort(script->begin(), script->end(),
+                     [](const Command& a, const Command& b) { return a.bar < b.bar; });
+    return ok;
+}
+
+bool ParseArgs(int argc, char** argv, Config* config) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        } else if (!strcmp(arg, "--seed")) {
+            config->seed = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--seeds")) {
+            config->seeds = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--bpm")) {
+            config->bpm_tenths = ParseBpm(argv[++i]);
+        } else if (!strcmp(arg, "--bars")) {
+            config->bars = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--script")) {
+            if (!LoadScript(argv[++i], &config->script)) {
+                return false;
+            }
+        } else if (!strcmp(arg, "-o")) {
+            config->out_path = argv[++i];
+        } else if (!strcmp(arg, "--out-dir")) {
+            config->out_dir = argv[++i];
+        } else if (!strcmp(arg, "-j")) {
+            config->workers = strtoul(argv[++i], nullptr, 0);
+        } else {
+            return false;
+        }
+    }
+    return config->bpm_tenths > 0 && config->bars > 0 &&
+           (config->seeds == 0 || config->out_dir);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Config config;
+    if (!ParseArgs(argc, argv, &config)) {
+        fprintf(stderr, "usage: %s [--seed N] [--bpm B] [--bars N] [--script FILE] [-o OUT.mid]\n"
+                        "       %s --seeds COUNT --out-dir DIR [--seed FIRST] [-j N] ...\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    if (!config.seeds) {
+        const long notes = Render(config, config.seed, config.out_path);
+        if (notes < 0) {
+            return 1;
+        }
+        printf("seed %u: %u bars at %u.%u BPM, %ld notes -> %s\n", config.seed, config.bars,
+               config.bpm_tenths / 10, config.bpm_tenths % 10, notes, config.out_path);
+        return 0;
+    }
+
+    if (!config.workers) {
+        config.workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    config.workers = std::min(config.workers, config.seeds);
+
+    // Worker w renders every workers-th seed; its exit status counts failures
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<pid_t> pids;
+    for (unsigned w = 0; w < config.workers; ++w) {
+        const pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 2;
+        }
+        if (pid == 0) {
+            int failed = 0;
+            char path[1024];
+            for (uint32_t i = w; i < config.seeds; i += config.workers) {
+                const uint32_t seed = config.seed + i;
+                snprintf(path, sizeof(path), "%s/seed_%u.mid", config.out_dir, seed);
+                if (Render(config, seed, path) < 0) {
+                    failed = 1;
+                }
+            }
+            _exit(failed);
+        }
+        pids.push_back(pid);
+    }
+    unsigned failed_workers = 0;
+    for (pid_t pid : pids) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed_workers++;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    printf("%u seeds (%u-%u) x %u bars -> %s/ on %u workers in %.2f s\n", config.seeds,
+           config.seed, config.seed + config.seeds - 1, config.bars, config.out_dir,
+           config.workers, seconds);
+    if (failed_workers) {
+        fprintf(stderr, "pattern_render: %u workers failed\n", failed_workers);
+        return 1;
+    }
+    return 0;
+}
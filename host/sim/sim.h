@@ -0,0 +1,52 @@
+// Host simulator for the application logic (src/app.cpp).
+//
+// sim_hal.cpp implements hal.h on virtual time: every pin change is recorded
+// with its timestamp, inputs and MIDI packets are injected by the caller, and
+// sim_run_until() drives app_poll() with a configurable loop period model.
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+struct PinEdge {
+    uint64_t t_us;
+    uint8_t pin;
+    bool level;
+};
+
+struct Pulse {
+    uint64_t start_us;
+    uint64_t width_us;   // 0 while the pin is still high
+};
+
+// Main loop model: one app_poll() every period_us, plus a uniformly
+// distributed extra delay of 0..jitter_us (work + USB servicing)
+void sim_set_loop_model(uint32_t period_us, uint32_t jitter_us, uint32_t seed);
+
+// USB host clock: SOFs arrive every host millisecond, which lasts
+// 1000 * (1 + ppm / 1e6) device us
+void sim_set_host_clock(int32_t ppm);
+
+// Echo every pin change to out as it happens (nullptr = silent)
+void sim_set_trace_output(FILE* out);
+
+uint64_t sim_time_us();
+
+// Run the application loop until virtual time reaches t_us
+void sim_run_until(uint64_t t_us);
+
+// Drive an input pin (inputs idle high because of the pull-up)
+void sim_set_input(uint8_t pin, bool level);
+
+// Queue a USB-MIDI packet; the app reads it on its next pass
+void sim_push_midi(const uint8_t packet[4]);
+
+// Recorded pin history
+const std::vector<PinEdge>& sim_trace();
+std::vector<Pulse> sim_pulses(uint8_t pin);
+
+#endif  // SIM_H_
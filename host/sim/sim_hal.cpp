@@ -0,0 +1,267 @@
+// hal.h on virtual time for the host simulator
+
+#include "sim.h"
+
+#include <string.h>
+
+#include <deque>
+
+#include "app.h"
+#include "hal.h"
+
+namespace {
+
+const uint8_t kNumPins = 30;
+
+uint64_t now_us = 0;
+bool pin_level[kNumPins];
+bool pin_is_output[kNumPins];
+
+std::vector<PinEdge> trace;
+FILE* trace_out = nullptr;
+
+struct MidiPacket {
+    uint8_t bytes[4];
+};
+std::deque<MidiPacket> midi_fifo;
+
+// Flash storage partition; erase/program cost the time the RP2040 spends
+// with interrupts off (typical datasheet figures)
+const uint32_t kStorageSize = 256 * 1024;
+const uint32_t kEraseSectorUs = 45000;
+const uint32_t kProgramPageUs = 800;
+uint8_t storage[kStorageSize];
+bool storage_ready = false;
+
+uint8_t* Storage() {
+    if (!storage_ready) {
+        memset(storage, 0xFF, sizeof(storage));
+        storage_ready = true;
+    }
+    return storage;
+}
+
+hal_gpio_edge_callback_t edge_callback[kNumPins];
+
+hal_alarm_callback_t alarm_callback = nullptr;
+bool alarm_armed = false;
+uint64_t alarm_at_us = 0;
+
+// USB SOFs every host millisecond; the device timer runs host_ppm fast
+hal_sof_callback_t sof_callback = nullptr;
+int32_t host_ppm = 0;
+uint64_t sof_count = 0;
+
+uint64_t NextSofUs() {
+    return (sof_count + 1) * (1000000000 + static_cast<int64_t>(host_ppm) * 1000) / 1000000;
+}
+
+uint32_t loop_period_us = 1000;
+uint32_t loop_jitter_us = 0;
+uint32_t jitter_rng = 1;
+
+uint32_t NextJitter() {
+    if (!loop_jitter_us) {
+        return 0;
+    }
+    jitter_rng = jitter_rng * 1664525u + 1013904223u;
+    return (jitter_rng >> 8) % (loop_jitter_us + 1);
+}
+
+}  // namespace
+
+// --- hal.h ---
+
+uint64_t hal_time_us() {
+    return now_us;
+}
+
+void hal_gpio_init_output(uint8_t pin) {
+    pin_is_output[pin] = true;
+    pin_level[pin] = false;
+}
+
+void hal_gpio_init_input_pullup(uint8_t pin) {
+    pin_is_output[pin] = false;
+    pin_level[pin] = true;
+}
+
+void hal_gpio_put(uint8_t pin, bool value) {
+    if (pin >= kNumPins || pin_level[pin] == value) {
+        return;
+    }
+    pin_level[pin] = value;
+    trace.push_back(PinEdge{now_us, pin, value});
+    if (trace_out) {
+        fprintf(trace_out, "[PIN] %llu.%06llu GP%u %u\n",
+                static_cast<unsigned long long>(now_us / 1000000),
+                static_cast<unsigned long long>(now_us % 1000000),
+                pin, value ? 1 : 0);
+    }
+}
+
+bool hal_gpio_get(uint8_t pin) {
+    return pin < kNumPins && pin_level[pin];
+}
+
+void hal_gpio_set_edge_irq(uint8_t pin, hal_gpio_edge_callback_t callback) {
+    if (pin < kNumPins) {
+        edge_callback[pin] = callback;
+    }
+}
+
+void hal_alarm_init(hal_alarm_callback_t callback) {
+    alarm_callback = callback;
+    alarm_armed = false;
+}
+
+void hal_alarm_set(uint64_t at_us) {
+    alarm_at_us = at_us;
+    alarm_armed = alarm_callback != nullptr;
+}
+
+// Single-threaded: app_poll() is never interrupted, the alarm fires between passes
+uint32_t hal_irq_save() {
+    return 0;
+}
+
+void hal_irq_restore(uint32_t state) {
+    (void)state;
+}
+
+void hal_usb_sof_init(hal_sof_callback_t callback) {
+    sof_callback = callback;
+    sof_count = now_us * 1000000 / (1000000000 + static_cast<int64_t>(host_ppm) * 1000);
+}
+
+uint32_t hal_midi_available() {
+    return static_cast<uint32_t>(midi_fifo.size());
+}
+
+bool hal_midi_read(uint8_t packet[4]) {
+    if (midi_fifo.empty()) {
+        return false;
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        packet[i] = midi_fifo.front().bytes[i];
+    }
+    midi_fifo.pop_front();
+    return true;
+}
+
+uint32_t hal_storage_size() {
+    return kStorageSize;
+}
+
+const uint8_t* hal_storage_data() {
+    return Storage();
+}
+
+void hal_storage_erase_sector(uint32_t offset) {
+    memset(Storage() + offset, 0xFF, HAL_STORAGE_SECTOR_SIZE);
+    now_us += kEraseSectorUs;
+}
+
+void hal_storage_program_page(uint32_t offset, const uint8_t data[HAL_STORAGE_PAGE_SIZE]) {
+    // Programming can only clear bits
+    uint8_t* page = Storage() + offset;
+    for (uint32_t i = 0; i < HAL_STORAGE_PAGE_SIZE; ++i) {
+        page[i] &= data[i];
+    }
+    now_us += kProgramPageUs;
+}
+
+// --- sim.h ---
+
+void sim_set_loop_model(uint32_t period_us, uint32_t jitter_us, uint32_t seed) {
+    loop_period_us = period_us ? period_us : 1;
+    loop_jitter_us = jitter_us;
+    jitter_rng = seed;
+}
+
+void sim_set_host_clock(int32_t ppm) {
+    host_ppm = ppm;
+}
+
+void sim_set_trace_output(FILE* out) {
+    trace_out = out;
+}
+
+uint64_t sim_time_us() {
+    return now_us;
+}
+
+// Run the interrupts due before t_us in time order: the alarm, possibly
+// repeatedly, and USB SOFs
+static void RunInterruptsUntil(uint64_t t_us) {
+    while (true) {
+        const bool alarm_due = alarm_armed && alarm_at_us < t_us;
+        const bool sof_due = sof_callback && NextSofUs() < t_us;
+        if (!alarm_due && !sof_due) {
+            return;
+        }
+        if (alarm_due && (!sof_due || alarm_at_us <= NextSofUs())) {
+            alarm_armed = false;
+            if (alarm_at_us > now_us) {
+                now_us = alarm_at_us;
+            }
+            alarm_callback();
+        } else {
+            const uint64_t at_us = NextSofUs();
+            sof_count++;
+            // SOFs missed during a flash write come in as one, late
+            while (NextSofUs() <= now_us) {
+                sof_count++;
+            }
+            if (at_us > now_us) {
+                now_us = at_us;
+            }
+            sof_callback(static_cast<uint16_t>(sof_count & 0x7FF), now_us);
+        }
+    }
+}
+
+void sim_run_until(uint64_t t_us) {
+    while (now_us < t_us) {
+        app_poll();
+        const uint64_t next_pass_us = now_us + loop_period_us + NextJitter();
+        RunInterruptsUntil(next_pass_us);
+        now_us = next_pass_us;
+    }
+}
+
+void sim_set_input(uint8_t pin, bool level) {
+    if (pin < kNumPins && !pin_is_output[pin] && pin_level[pin] != level) {
+        pin_level[pin] = level;
+        if (edge_callback[pin]) {
+            edge_callback[pin](pin, level, now_us);
+        }
+    }
+}
+
+void sim_push_midi(const uint8_t packet[4]) {
+    MidiPacket p;
+    for (uint8_t i = 0; i < 4; ++i) {
+        p.bytes[i] = packet[i];
+    }
+    midi_fifo.push_back(p);
+}
+
+const std::vector<PinEdge>& sim_trace() {
+    return trace;
+}
+
+std::vector<Pulse> sim_pulses(uint8_t pin) {
+    std::vector<Pulse> pulses;
+    for (const PinEdge& edge : trace) {
+        if (edge.pin != pin) {
+            continue;
+        }
+        if (edge.level) {
+            pulses.push_back(Pulse{edge.t_us, 0});
+        } else if (!pulses.empty() && pulses.back().width_us == 0) {
+            pulses.back().width_us = edge.t_us - pulses.back().start_us;
+        }
+    }
+    return pulses;
+}
@@ -0,0 +1,253 @@
+// Deterministic host simulator of the firmware main loop.
+//
+// Usage: miditosolenoid_sim [--seed N] [--period US] [--jitter US] [--host-ppm PPM]
+//                           [--no-trace] [SCRIPT]
+//
+// --host-ppm sets how fast the device timer runs against the USB host clock.
+//
+// Reads a script (default stdin), one command per line, '#' starts a comment.
+// Times are virtual milliseconds since boot and may be fractional.
+//
+//   at <ms> key down|up              press / release the User Key
+//   at <ms> pin <gpio> 0|1           drive an input pin (e.g. clock/reset in)
+//   at <ms> midi <status> <d1> <d2>  inject a USB-MIDI packet (hex bytes)
+//   at <ms> syx <file>               inject the SysEx messages of a .syx file
+//   at <ms> tsmidi <host_ms> <status> <d1> <d2>
+//                                    inject a channel message timestamped with
+//                                    the host time <host_ms> (jitter_buffer.h)
+//   run <ms>                         run the main loop until <ms>
+//   expect pulse <pin> <ms> <width_ms> [tol_ms]
+//                                    a pulse on GP<pin> starts at <ms> and lasts
+//                                    <width_ms>, both within tol_ms (default 1)
+//   expect count <pin> <from_ms> <to_ms> <n>
+//                                    exactly n pulses start in [from, to)
+//
+// Every pin change is printed as "[PIN] <seconds> GP<pin> <level>". The exit
+// status is 1 if any expectation failed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "app.h"
+#include "sim.h"
+#include "usb_clock.h"
+
+namespace {
+
+uint64_t MsToUs(double ms) {
+    return static_cast<uint64_t>(ms * 1000.0 + 0.5);
+}
+
+uint64_t AbsDiff(uint64_t a, uint64_t b) {
+    return a > b ? a - b : b - a;
+}
+
+bool ExpectPulse(uint8_t pin, uint64_t start_us, uint64_t width_us, uint64_t tol_us) {
+    for (const Pulse& p : sim_pulses(pin)) {
+        if (AbsDiff(p.start_us, start_us) <= tol_us &&
+            p.width_us && AbsDiff(p.width_us, width_us) <= tol_us) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t CountPulses(uint8_t pin, uint64_t from_us, uint64_t to_us) {
+    uint32_t n = 0;
+    for (const Pulse& p : sim_pulses(pin)) {
+        if (p.start_us >= from_us && p.start_us < to_us) {
+            n++;
+        }
+    }
+    return n;
+}
+
+// Split a SysEx message into USB-MIDI packets
+void PushSyxMessage(const std::vector<uint8_t>& msg) {
+    for (size_t i = 0; i < msg.size(); i += 3) {
+        const size_t left = msg.size() - i;
+        uint8_t packet[4] = {0x04, 0, 0, 0};
+        if (left <= 3) {
+            packet[0] = static_cast<uint8_t>(0x04 + left);  // CIN 5-7: ends with 1-3 bytes
+        }
+        for (size_t j = 0; j < 3 && j < left; ++j) {
+            packet[1 + j] = msg[i + j];
+        }
+        sim_push_midi(packet);
+    }
+}
+
+bool PushSyxFile(const char* path) {
+    FILE* in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return false;
+    }
+    std::vector<uint8_t> msg;
+    int c;
+    while ((c = fgetc(in)) != EOF) {
+        if (c == 0xF0) {
+            msg.clear();
+        }
+        msg.push_back(static_cast<uint8_t>(c));
+        if (c != 0xF7) {
+            continue;
+        }
+        PushSyxMessage(msg);
+        msg.clear();
+    }
+    fclose(in);
+    return true;
+}
+
+// Returns false on a malformed line
+bool RunCommand(char* line, uint32_t line_no, uint32_t* failures) {
+    char* argv[12];
+    int argc = 0;
+    for (char* tok = strtok(line, " \t\r\n"); tok && argc < 12; tok = strtok(nullptr, " \t\r\n")) {
+        argv[argc++] = tok;
+    }
+    if (argc == 0) {
+        return true;
+    }
+
+    if (!strcmp(argv[0], "at") && argc >= 3) {
+        sim_run_until(MsToUs(atof(argv[1])));
+        if (!strcmp(argv[2], "key") && argc == 4) {
+            // Active-low: pressed pulls the pin to ground
+            sim_set_input(GPIO_USER_KEY, strcmp(argv[3], "down") != 0);
+            return true;
+        }
+        if (!strcmp(argv[2], "pin") && argc == 5) {
+            sim_set_input(static_cast<uint8_t>(atoi(argv[3])), atoi(argv[4]) != 0);
+            return true;
+        }
+        if (!strcmp(argv[2], "midi") && argc == 6) {
+            uint8_t packet[4];
+            packet[1] = static_cast<uint8_t>(strtoul(argv[3], nullptr, 16));
+            packet[2] = static_cast<uint8_t>(strtoul(argv[4], nullptr, 16));
+            packet[3] = static_cast<uint8_t>(strtoul(argv[5], nullptr, 16));
+            packet[0] = packet[1] >> 4;  // cable 0, code index = status nibble
+            sim_push_midi(packet);
+            return true;
+        }
+        if (!strcmp(argv[2], "syx") && argc == 4) {
+            return PushSyxFile(argv[3]);
+        }
+        if (!strcmp(argv[2], "tsmidi") && argc == 7) {
+            const uint32_t host_us = static_cast<uint32_t>(MsToUs(atof(argv[3])));
+            std::vector<uint8_t> msg = {0xF0, 0x7D, 0x4D, 0x10};
+            for (uint8_t i = 0; i < 4; ++i) {
+                msg.push_back((host_us >> (7 * i)) & 0x7F);
+            }
+            msg.push_back(static_cast<uint8_t>(strtoul(argv[4], nullptr, 16)) & 0x7F);
+            msg.push_back(static_cast<uint8_t>(strtoul(argv[5], nullptr, 16)));
+            msg.push_back(static_cast<uint8_t>(strtoul(argv[6], nullptr, 16)));
+            msg.push_back(0xF7);
+            PushSyxMessage(msg);
+            return true;
+        }
+        return false;
+    }
+
+    if (!strcmp(argv[0], "run") && argc == 2) {
+        sim_run_until(MsToUs(atof(argv[1])));
+        return true;
+    }
+
+    if (!strcmp(argv[0], "expect") && argc >= 2) {
+        if (!strcmp(argv[1], "pulse") && (argc == 5 || argc == 6)) {
+            const uint8_t pin = static_cast<uint8_t>(atoi(argv[2]));
+            const uint64_t tol_us = MsToUs(argc == 6 ? atof(argv[5]) : 1.0);
+            if (!ExpectPulse(pin, MsToUs(atof(argv[3])), MsToUs(atof(argv[4])), tol_us)) {
+                printf("[SIM] FAIL line %u: no %sms pulse on GP%u at %sms\n",
+                       line_no, argv[4], pin, argv[3]);
+                (*failures)++;
+            }
+            return true;
+        }
+        if (!strcmp(argv[1], "count") && argc == 6) {
+            const uint8_t pin = static_cast<uint8_t>(atoi(argv[2]));
+            const uint32_t want = static_cast<uint32_t>(atoi(argv[5]));
+            const uint32_t got = CountPulses(pin, MsToUs(atof(argv[3])), MsToUs(atof(argv[4])));
+            if (got != want) {
+                printf("[SIM] FAIL line %u: %u pulses on GP%u in [%s, %s) ms, expected %u\n",
+                       line_no, got, pin, argv[3], argv[4], want);
+                (*failures)++;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    uint32_t seed = 1;
+    uint32_t period_us = 1000;
+    uint32_t jitter_us = 0;
+    int32_t host_ppm = 0;
+    bool trace = true;
+    const char* script_path = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--period") && i + 1 < argc) {
+            period_us = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--jitter") && i + 1 < argc) {
+            jitter_us = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--host-ppm") && i + 1 < argc) {
+            host_ppm = strtol(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--no-trace")) {
+            trace = false;
+        } else if (argv[i][0] != '-' && !script_path) {
+            script_path = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [--seed N] [--period US] [--jitter US] "
+                            "[--host-ppm PPM] [--no-trace] [SCRIPT]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    FILE* script = script_path ? fopen(script_path, "r") : stdin;
+    if (!script) {
+        perror(script_path);
+        return 2;
+    }
+
+    sim_set_loop_model(period_us, jitter_us, seed);
+    sim_set_trace_output(trace ? stdout : nullptr);
+    sim_set_host_clock(host_ppm);
+    app_init();
+    usb_clock_init();
+    app_start(seed);
+
+    char line[256];
+    uint32_t line_no = 0;
+    uint32_t failures = 0;
+    while (fgets(line, sizeof(line), script)) {
+        line_no++;
+        char* comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        if (!RunCommand(line, line_no, &failures)) {
+            fprintf(stderr, "%s:%u: cannot parse command\n",
+                    script_path ? script_path : "<stdin>", line_no);
+            return 2;
+        }
+    }
+    if (script != stdin) {
+        fclose(script);
+    }
+
+    printf("[SIM] %llu ms simulated, %zu pin changes, %u failed expectations\n",
+           static_cast<unsigned long long>(sim_time_us() / 1000),
+           sim_trace().size(), failures);
+    return failures ? 1 : 0;
+}
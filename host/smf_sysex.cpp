@@ -0,0 +1,90 @@
+// Wraps a Standard MIDI File in the SysEx upload messages of smf_upload.h.
+//
+// Usage: smf_sysex IN.mid OUT.syx
+//
+// OUT.syx holds the begin, data and end messages back to back, ready for any
+// SysEx sender, e.g. `amidi -p hw:1 -s OUT.syx -i 10` (leave a few ms between
+// messages: the board stops reading USB while it erases a flash sector).
+// The file is checked with the firmware's own parser first.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "smf_player.h"
+
+namespace {
+
+const uint8_t kChunkBytes = 63;  // 9 groups of 7
+
+void PutU28(std::vector<uint8_t>* out, uint32_t value) {
+    for (uint8_t i = 0; i < 4; ++i) {
+        out->push_back((value >> (7 * i)) & 0x7F);
+    }
+}
+
+void Message(std::vector<uint8_t>* out, uint8_t cmd, uint32_t value) {
+    out->insert(out->end(), {0xF0, 0x7D, 0x4D, cmd});
+    PutU28(out, value);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s IN.mid OUT.syx\n", argv[0]);
+        return 2;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> file;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0) {
+        file.insert(file.end(), buf, buf + n);
+    }
+    fclose(in);
+
+    SmfPlayer player;
+    if (!player.Open(file.data(), static_cast<uint32_t>(file.size()))) {
+        fprintf(stderr, "%s: not a playable MIDI file (format 0/1, PPQN division)\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<uint8_t> syx;
+    uint32_t checksum = 0;
+    Message(&syx, 0x01, static_cast<uint32_t>(file.size()));
+    syx.push_back(0xF7);
+    for (size_t offset = 0; offset < file.size(); offset += kChunkBytes) {
+        Message(&syx, 0x02, static_cast<uint32_t>(offset));
+        const size_t end = std::min(file.size(), offset + kChunkBytes);
+        for (size_t group = offset; group < end; group += 7) {
+            uint8_t msbs = 0;
+            for (size_t i = group; i < end && i < group + 7; ++i) {
+                msbs |= (file[i] >> 7) << (i - group);
+            }
+            syx.push_back(msbs);
+            for (size_t i = group; i < end && i < group + 7; ++i) {
+                syx.push_back(file[i] & 0x7F);
+                checksum += file[i];
+            }
+        }
+        syx.push_back(0xF7);
+    }
+    Message(&syx, 0x03, checksum & 0x0FFFFFFF);
+    syx.push_back(0xF7);
+
+    FILE* out = fopen(argv[2], "wb");
+    if (!out || fwrite(syx.data(), 1, syx.size(), out) != syx.size() || fclose(out) != 0) {
+        perror(argv[2]);
+        return 1;
+    }
+    printf("%s: %zu bytes, %u tracks -> %zu SysEx bytes in %s\n", argv[1], file.size(),
+           player.num_tracks(), syx.size(), argv[2]);
+    return 0;
+}
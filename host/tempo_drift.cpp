@@ -0,0 +1,310 @@
+// Long-run tempo accuracy of GenerativeController in simulated time.
+//
+// Usage: tempo_drift [--hours H] [--bpm-from B] [--bpm-to B] [--bpm-step B]
+//                    [--period US] [--jitter US] [--lookahead US]
+//                    [--max-drift-us US] [--max-jitter-us US] [-j N] [-v]
+//
+// For every BPM in the sweep (default 40.0-300.0 in 0.1 steps) the controller
+// runs for H hours (default 8) of virtual time. The main loop is modelled as
+// passes every --period us (default 1050: the 1 ms sleep plus work) delayed by
+// a pseudo-random 0..--jitter us (default 400). Each pass runs the engine as
+// run_generative() in app.cpp does: Tick(UsToNextPulse()) pulse by pulse
+// while the next pulse falls due within --lookahead us (default 3000, as
+// LOOKAHEAD_US), each step queued for the scheduler at the engine time it is
+// due. A step queued after that time fires at once, on the pass.
+//
+// Each step that fires is compared with the ideal grid, step n at
+// n * 3 pulses * 25e6 / bpm_tenths us after start:
+//   drift   mean lateness over the last hour minus over the first hour
+//   jitter  spread of the lateness: the rounding of the engine time, and
+//           any step the lookahead did not queue in time
+// Exits with status 1 if any BPM exceeds --max-drift-us (default 50) or
+// --max-jitter-us (default 1).
+//
+// The engine keeps global state (grids::PatternGenerator), so the sweep is
+// split across forked worker processes rather than threads.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "generative/generative_controller.h"
+#include "grids/pattern_generator.h"
+
+namespace {
+
+struct Config {
+    double hours = 8.0;
+    uint32_t bpm_from = 400;   // tenths
+    uint32_t bpm_to = 3000;
+    uint32_t bpm_step = 1;
+    uint32_t period_us = 1050;
+    uint32_t jitter_us = 400;
+    uint32_t lookahead_us = 3000;
+    double max_drift_us = 50.0;
+    double max_jitter_us = 1.0;
+    unsigned workers = 0;
+    bool verbose = false;
+};
+
+struct Result {
+    uint32_t bpm_tenths;
+    uint64_t steps;
+    double drift_us;
+    double jitter_us;
+    double max_late_us;
+};
+
+// Time of main loop pass k: a fixed period plus a hashed 0..jitter delay.
+// The delay is below the period, so pass times stay strictly increasing.
+class LoopModel {
+public:
+    LoopModel(uint32_t period_us, uint32_t jitter_us)
+        : period_(period_us), jitter_(std::min(jitter_us, period_us - 1)) {}
+
+    uint64_t PassTime(uint64_t k) const {
+        if (!jitter_) {
+            return k * period_;
+        }
+        uint32_t h = static_cast<uint32_t>(k) * 2654435761u;
+        h ^= h >> 15;
+        h *= 2246822519u;
+        h ^= h >> 13;
+        return k * period_ + h % (jitter_ + 1);
+    }
+
+    // Index of the first pass at or after t_us
+    uint64_t FirstPassAtOrAfter(uint64_t t_us) const {
+        uint64_t k = t_us / period_;
+        k = k ? k - 1 : 0;
+        while (PassTime(k) < t_us) {
+            k++;
+        }
+        return k;
+    }
+
+private:
+    uint64_t period_;
+    uint32_t jitter_;
+};
+
+Result RunBpm(const Config& config, uint32_t bpm_tenths) {
+    const LoopModel loop(config.period_us, config.jitter_us);
+    const uint64_t duration_us = static_cast<uint64_t>(config.hours * 3600e6);
+    const uint64_t hour_us = std::min<uint64_t>(3600000000ull, duration_us / 2);
+
+    generative::GenerativeController gen;
+    gen.Init(1, bpm_tenths);
+
+    const uint64_t start_us = loop.PassTime(0);
+    uint64_t gen_time_us = start_us;  // engine time run up to, as in app.cpp
+    uint64_t pass = 0;
+    uint64_t steps = 0;
+    double max_late = -1e18;
+    double min_late = 1e18;
+    double first_sum = 0.0, last_sum = 0.0;
+    uint64_t first_n = 0, last_n = 0;
+
+    while (gen_time_us - start_us < duration_us) {
+        // The passes in between queue nothing: skip to the one whose
+        // lookahead reaches the next pulse
+        const uint64_t next_us = gen_time_us + gen.UsToNextPulse();
+        if (next_us > config.lookahead_us) {
+            pass = std::max(pass, loop.FirstPassAtOrAfter(next_us - config.lookahead_us));
+        }
+        const uint64_t now_us = loop.PassTime(pass);
+        while (gen_time_us + gen.UsToNextPulse() <= now_us + config.lookahead_us) {
+            const uint32_t to_pulse_us = gen.UsToNextPulse();
+            gen_time_us += to_pulse_us;
+            const uint8_t prev_step = gen.step();
+            gen.Tick(to_pulse_us);
+            if (gen.step() == prev_step) {
+                continue;
+            }
+
+            // Step n is due n * kPulsesPerStep pulses of 25e6 / bpm_tenths us
+            steps++;
+            const uint64_t fire_us = std::max(gen_time_us, now_us);
+            const double ideal_us = static_cast<double>(steps) * grids::kPulsesPerStep
+                                  * 25000000.0 / bpm_tenths;
+            const double elapsed_us = static_cast<double>(fire_us - start_us);
+            const double late = elapsed_us - ideal_us;
+            max_late = std::max(max_late, late);
+            min_late = std::min(min_late, late);
+            if (elapsed_us < hour_us) {
+                first_sum += late;
+                first_n++;
+            } else if (elapsed_us >= duration_us - hour_us) {
+                last_sum += late;
+                last_n++;
+            }
+        }
+        pass++;
+    }
+
+    Result r;
+    r.bpm_tenths = bpm_tenths;
+    r.steps = steps;
+    r.drift_us = (last_n ? last_sum / last_n : 0.0) - (first_n ? first_sum / first_n : 0.0);
+    r.jitter_us = steps ? max_late - min_late : 0.0;
+    r.max_late_us = steps ? max_late : 0.0;
+    return r;
+}
+
+bool ParseArgs(int argc, char** argv, Config* config) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (!strcmp(arg, "-v")) {
+            config->verbose = true;
+        } else if (!has_value) {
+            return false;
+        } else if (!strcmp(arg, "--hours")) {
+            config->hours = atof(argv[++i]);
+        } else if (!strcmp(arg, "--bpm-from")) {
+            config->bpm_from = static_cast<uint32_t>(atof(argv[++i]) * 10 + 0.5);
+        } else if (!strcmp(arg, "--bpm-to")) {
+            config->bpm_to = static_cast<uint32_t>(atof(argv[++i]) * 10 + 0.5);
+        } else if (!strcmp(arg, "--bpm-step")) {
+            config->bpm_step = static_cast<uint32_t>(atof(argv[++i]) * 10 + 0.5);
+        } else if (!strcmp(arg, "--period")) {
+            config->period_us = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--jitter")) {
+            config->jitter_us = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--lookahead")) {
+            config->lookahead_us = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(arg, "--max-drift-us")) {
+            config->max_drift_us = atof(argv[++i]);
+        } else if (!strcmp(arg, "--max-jitter-us")) {
+            config->max_jitter_us = atof(argv[++i]);
+        } else if (!strcmp(arg, "-j")) {
+            config->workers = strtoul(argv[++i], nullptr, 0);
+        } else {
+            return false;
+        }
+    }
+    return config->bpm_from > 0 && config->bpm_step > 0 &&
+           config->bpm_to >= config->bpm_from && config->period_us > 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Config config;
+    if (!ParseArgs(argc, argv, &config)) {
+        fprintf(stderr, "usage: %s [--hours H] [--bpm-from B] [--bpm-to B] [--bpm-step B]\n"
+                        "       [--period US] [--jitter US] [--lookahead US]\n"
+                        "       [--max-drift-us US] [--max-jitter-us US] [-j N] [-v]\n",
+                argv[0]);
+        return 2;
+    }
+    if (!config.workers) {
+        config.workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<uint32_t> bpms;
+    for (uint32_t bpm = config.bpm_from; bpm <= config.bpm_to; bpm += config.bpm_step) {
+        bpms.push_back(bpm);
+    }
+    config.workers = std::min<unsigned>(config.workers, bpms.size());
+
+    // Worker w takes every workers-th BPM and streams Results back over a pipe
+    std::vector<int> pipes;
+    std::vector<pid_t> pids;
+    for (unsigned w = 0; w < config.workers; ++w) {
+        int fds[2];
+        if (pipe(fds) != 0) {
+            perror("pipe");
+            return 2;
+        }
+        const pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 2;
+        }
+        if (pid == 0) {
+            close(fds[0]);
+            for (size_t i = w; i < bpms.size(); i += config.workers) {
+                const Result r = RunBpm(config, bpms[i]);
+                if (write(fds[1], &r, sizeof(r)) != static_cast<ssize_t>(sizeof(r))) {
+                    _exit(1);
+                }
+            }
+            _exit(0);
+        }
+        close(fds[1]);
+        pipes.push_back(fds[0]);
+        pids.push_back(pid);
+    }
+
+    // Drain all pipes together so no worker blocks on a full pipe
+    std::vector<Result> results;
+    std::vector<pollfd> fds;
+    for (int fd : pipes) {
+        fds.push_back(pollfd{fd, POLLIN, 0});
+    }
+    size_t open_fds = fds.size();
+    while (open_fds && poll(fds.data(), fds.size(), -1) > 0) {
+        for (pollfd& p : fds) {
+            if (p.fd < 0 || !p.revents) {
+                continue;
+            }
+            Result r;
+            if (read(p.fd, &r, sizeof(r)) == static_cast<ssize_t>(sizeof(r))) {
+                results.push_back(r);
+            } else {
+                close(p.fd);
+                p.fd = -1;
+                open_fds--;
+            }
+        }
+    }
+    for (pid_t pid : pids) {
+        waitpid(pid, nullptr, 0);
+    }
+    if (results.size() != bpms.size()) {
+        fprintf(stderr, "tempo_drift: %zu of %zu BPMs reported\n", results.size(), bpms.size());
+        return 2;
+    }
+    std::sort(results.begin(), results.end(),
+              [](const Result& a, const Result& b) { return a.bpm_tenths < b.bpm_tenths; });
+
+    const Result* worst_drift = &results[0];
+    const Result* worst_jitter = &results[0];
+    uint32_t failures = 0;
+    for (const Result& r : results) {
+        const bool fail = std::abs(r.drift_us) > config.max_drift_us ||
+                          r.jitter_us > config.max_jitter_us;
+        if (fail) {
+            failures++;
+        }
+        if (config.verbose || fail) {
+            printf("%s bpm=%u.%u steps=%llu drift=%.1fus jitter=%.1fus max_late=%.1fus\n",
+                   fail ? "FAIL" : "    ", r.bpm_tenths / 10, r.bpm_tenths % 10,
+                   static_cast<unsigned long long>(r.steps), r.drift_us, r.jitter_us,
+                   r.max_late_us);
+        }
+        if (std::abs(r.drift_us) > std::abs(worst_drift->drift_us)) worst_drift = &r;
+        if (r.jitter_us > worst_jitter->jitter_us) worst_jitter = &r;
+    }
+
+    printf("%zu BPMs x %.2f h, loop %u us + 0..%u us jitter, %u us lookahead\n",
+           results.size(), config.hours, config.period_us, config.jitter_us,
+           config.lookahead_us);
+    printf("worst drift:  %.1f us at %u.%u BPM (limit %.1f us)\n",
+           worst_drift->drift_us, worst_drift->bpm_tenths / 10, worst_drift->bpm_tenths % 10,
+           config.max_drift_us);
+    printf("worst jitter: %.1f us at %u.%u BPM (limit %.1f us)\n",
+           worst_jitter->jitter_us, worst_jitter->bpm_tenths / 10, worst_jitter->bpm_tenths % 10,
+           config.max_jitter_us);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,1041 @@
+/**
+ * MIDI to Solenoid Controller - application logic
+ *
+ * Four modes:
+ *   1. Generative mode (default): Grids pattern engine drives solenoids autonomously
+ *   2. Hybrid mode: the generative engine keeps running and live MIDI notes
+ *      play over it; the scheduler arbitrates per solenoid (see scheduler.h)
+ *      and live notes can be quantized to the step grid (see quantizer.h)
+ *   3. MIDI mode: USB MIDI Note On/Off -> solenoid pulses; SysEx uploads a
+ *      MIDI file into flash (see smf_upload.h)
+ *   4. Playback mode: the uploaded MIDI file plays in a loop, read in place
+ *      from flash, with the same note -> solenoid mapping as MIDI mode
+ *
+ * In Hybrid and MIDI modes live notes can go through a fixed-latency jitter
+ * buffer, with optional host timestamps (see jitter_buffer.h).
+ *
+ * In Generative and Hybrid modes an external clock on GPIO 10 (reset on
+ * GPIO 11) takes over from the internal tempo at its first edge, until
+ * Generative mode is entered again (see ext_clock.h).
+ *
+ * All solenoid pulses go through the timestamped scheduler: the foreground
+ * loop runs the engines slightly ahead of time and queues each pulse for the
+ * exact microsecond it is due. The engine's clock, reset, bar, accent and
+ * random gate outputs (GPIO 12-16) go out the same way, so other gear can
+ * follow it.
+ *
+ * User Key (GPIO 23, active-low):
+ *   - Short press in Generative/Hybrid mode: randomize patterns, swapped in
+ *     at the next bar line
+ *   - Two or more presses in a row, up to 1.5 s apart, in Generative/Hybrid
+ *     mode with tap tempo on (GEN_TAP_TEMPO, or MIDI CC 106 in Hybrid mode):
+ *     set the tempo; a single press then randomizes once that window has
+ *     passed
+ *   - Long press (>1s): next mode (Generative -> Hybrid -> MIDI -> Playback
+ *     -> Generative); Playback is skipped while no valid file is stored
+ */
+
+#include "app.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ext_clock.h"
+#include "hal.h"
+#include "jitter_buffer.h"
+#include "midi_parser.h"
+#include "profile.h"
+#include "quantizer.h"
+#include "scheduler.h"
+#include "smf_player.h"
+#include "smf_upload.h"
+#include "sysex.h"
+#include "usb_clock.h"
+
+#include "generative/generative_controller.h"
+
+// Set to 1 for detailed generative mode UART logging, 0 for quiet
+#define GEN_VERBOSE 1
+
+// Set to 1 to play a demo song in generative mode: intro, groove, fill and
+// break snapshots chained with bar-quantized switching
+#define GEN_SONG 0
+
+// Set to 1 to run the generative tempo on the USB host's clock (drift
+// estimated from start-of-frame packets, see usb_clock.h), 0 for the RP2040
+// timer alone
+#define GEN_USB_CLOCK 1
+
+// Set to 1 to turn on the Grids tap tempo option at startup: the tempo
+// follows presses of the User Key, and randomize waits to see whether a
+// press is a tap. Off, a press randomizes at once; MIDI CC 106 in Hybrid
+// mode turns it on (64-127) or off (0-63).
+#define GEN_TAP_TEMPO 0
+
+// Pattern engine at startup (generative::Engine): 0 = Grids, 1 = cellular
+// automaton (elementary rule 90 unless changed over MIDI), 2 = Markov chain
+// learnt from MIDI mode playing and the stored file, 3 = evolution towards
+// the targets set over MIDI, 4 = Turing machine shift registers
+#define GEN_ENGINE 0
+
+// Button debounce/long-press timing (ms)
+static const uint32_t DEBOUNCE_MS = 50;
+static const uint32_t LONG_PRESS_MS = 1000;
+
+// User Key edges waiting for the button FSM; a pass sees a handful at most
+static const uint8_t KEY_QUEUE_SIZE = 16;
+
+// Default BPM in tenths (120.0 BPM)
+static const uint32_t DEFAULT_BPM_TENTHS = 1200;
+
+// Tap tempo: presses further apart end the taps (40 BPM); tempo range; taps
+// averaged; an interval more than 1/TAP_OUTLIER_DIV off the average is
+// dropped, two in a row restart the average (the tempo really changed)
+static const uint64_t TAP_MAX_INTERVAL_US = 1500000;
+static const uint32_t TAP_MIN_BPM_TENTHS = 400;
+static const uint32_t TAP_MAX_BPM_TENTHS = 3000;
+static const uint8_t TAP_HISTORY = 4;
+static const uint32_t TAP_OUTLIER_DIV = 4;
+static const uint8_t TAP_CC_ENABLE = 106;
+
+// How far ahead of time engine output is queued. Covers a loop pass plus USB
+// servicing, so pulses are queued before they fall due.
+static const uint32_t LOOKAHEAD_US = 3000;
+
+// Hybrid mode arbitration defaults (SchedRule bits); MIDI CC 20 sets the
+// rules (value 0-3), CC 21 the number of steps muted after a live hit
+static const uint8_t HYBRID_DEFAULT_RULES =
+    SCHED_RULE_LIVE_OVERRIDES | SCHED_RULE_MUTE_AFTER_LIVE;
+static const uint8_t HYBRID_DEFAULT_MUTE_STEPS = 2;
+static const uint8_t HYBRID_CC_RULES = 20;
+static const uint8_t HYBRID_CC_MUTE_STEPS = 21;
+
+// Hybrid mode live note quantizer, off by default; CC 22 sets the mode (0 off,
+// 1 next line, 2 nearest line), CC 23 the grid in steps, CC 24 the strength %
+static const uint8_t QUANTIZE_DEFAULT_DIVISION = 2;  // 1/16 notes
+static const uint8_t QUANTIZE_DEFAULT_STRENGTH = 100;
+static const uint8_t QUANTIZE_CC_MODE = 22;
+static const uint8_t QUANTIZE_CC_DIVISION = 23;
+static const uint8_t QUANTIZE_CC_STRENGTH = 24;
+
+// Jitter buffer delay in ms (0 = off), Hybrid and MIDI modes
+static const uint8_t JITTER_CC_DELAY_MS = 25;
+
+// External clock input resolution (grids::ClockResolution: 0 = 4 PPQN,
+// 1 = 8 PPQN, 2 = 24 PPQN); MIDI CC 26 sets it in Hybrid mode
+static const uint8_t EXT_CLOCK_DEFAULT_RESOLUTION = 2;
+static const uint8_t EXT_CLOCK_CC_RESOLUTION = 26;
+
+// Logic outputs switched on (generative::LogicOutput bits); MIDI CC 27 sets
+// the mask (value 0-31) in Hybrid mode. Reset, bar and accent are triggers;
+// clock and random gate stay high for half their period.
+static const uint8_t LOGIC_DEFAULT_OUTPUTS = (1 << GPIO_LOGIC_COUNT) - 1;
+static const uint8_t LOGIC_CC_OUTPUTS = 27;
+static const uint32_t LOGIC_TRIGGER_US = 5000;
+
+// Where a short press swaps its new patterns in (generative::RandomizeSwap:
+// 0 = next bar line, 1 = next step); MIDI CC 28 sets it in Hybrid mode
+static const uint8_t RANDOMIZE_DEFAULT_SWAP = generative::kSwapAtBar;
+static const uint8_t RANDOMIZE_CC_SWAP = 28;
+
+// The new patterns are printed one line per loop pass once they play. A line
+// is about 100 characters, 8.7 ms at 115200 baud, so the engine is queued this
+// much further ahead first.
+static const uint32_t PATTERN_PRINT_SLOT_US = 10000;
+static const uint8_t PATTERN_PRINT_IDLE = 0xFF;
+
+// Every channel on every step that can be queued at once: engine output up to
+// LOOKAHEAD_US + PATTERN_PRINT_SLOT_US ahead, live notes up to the longest
+// jitter buffer delay (CC 25 at 127 ms), at the fastest tempo
+static const uint32_t JITTER_MAX_DELAY_US = 127000;
+static const uint32_t SCHED_MIN_STEP_US = 600000000 / TAP_MAX_BPM_TENTHS / 4;
+static_assert(((LOOKAHEAD_US + PATTERN_PRINT_SLOT_US + JITTER_MAX_DELAY_US) / SCHED_MIN_STEP_US +
+               2) * (GPIO_COUNT + GPIO_LOGIC_COUNT) <= SCHED_QUEUE_SIZE,
+              "scheduler queue too short for a full lookahead");
+
+// Pattern engine (generative::Engine); MIDI CC 29 selects it in Hybrid mode,
+// CC 30 sets an elementary automaton rule (0-127) and CC 31 a 5-cell
+// totalistic code (0-63)
+static const uint8_t ENGINE_CC_SELECT = 29;
+static const uint8_t ENGINE_CC_AUTOMATON_RULE = 30;
+static const uint8_t ENGINE_CC_AUTOMATON_TOTALISTIC = 31;
+
+// Evolution engine targets (generative::EvolveTargets): CC 102 the hits per
+// bar (0-16), CC 103 the syncopated hits (0-12), CC 104 the cost of a hit
+// another channel shares (0-15)
+static const uint8_t EVOLVE_CC_DENSITY = 102;
+static const uint8_t EVOLVE_CC_SYNCOPATION = 103;
+static const uint8_t EVOLVE_CC_OVERLAP = 104;
+
+// Turing engine: CC 105 sets the chance a step's bit flips as it comes round,
+// value 0-127 for 0-254/256 (0 locks the loop, 64 is random)
+static const uint8_t TURING_CC_CHANCE = 105;
+
+// Markov engine training: MIDI mode notes are recorded on the step grid of
+// the generative tempo, the first note of a recording on a bar line; this many
+// silent bars end a recording. Velocities from MARKOV_HIGH_VELOCITY up are
+// high velocity hits.
+static const uint32_t MARKOV_GAP_BARS = 2;
+static const uint8_t MARKOV_HIGH_VELOCITY = 64;
+
+// The stored MIDI file is learnt a few notes per main loop pass, so an
+// upload or boot never holds up the loop for the whole file
+static const uint8_t MARKOV_FILE_NOTES_PER_POLL = 32;
+
+// LED auto-off deadline (hal_time_us() timestamp, 0 = none)
+static uint64_t led_off_deadline = 0;
+
+// Mode state
+enum AppMode {
+    MODE_GENERATIVE,
+    MODE_HYBRID,
+    MODE_MIDI,
+    MODE_PLAYBACK
+};
+static AppMode mode = MODE_GENERATIVE;
+static generative::GenerativeController gen_controller;
+static uint64_t gen_time_us = 0;        // engine time it has been run up to
+static uint64_t trim_gen_us = 0;        // engine time <-> hal_time_us() anchor
+static uint64_t trim_device_us = 0;
+static int32_t trim_ppb = 0;            // device timer drift applied
+static bool usb_clock_reported = false; // lock state last printed
+static int32_t usb_clock_printed_ppb = 0;
+static uint32_t sched_printed_rejected = 0;  // scheduler_rejected() last printed
+static uint32_t sched_rejected_print_ms = 0;
+static uint8_t hybrid_rules = HYBRID_DEFAULT_RULES;
+static uint8_t hybrid_mute_steps = HYBRID_DEFAULT_MUTE_STEPS;
+static QuantizeSettings quantize = {
+    QUANTIZE_OFF, QUANTIZE_DEFAULT_DIVISION, QUANTIZE_DEFAULT_STRENGTH
+};
+static uint64_t grid_step_us = 0;       // start time of the latest step run
+static uint8_t grid_step = 0;           // and its index
+static SmfPlayer smf_player;
+static uint64_t playback_start_us = 0;  // time 0 of the current loop of the file
+
+// Button state
+// User Key edges timestamped by the GPIO interrupt (single producer, single
+// consumer ring: the interrupt only moves key_queue_head)
+struct KeyEdge {
+    bool pressed;
+    uint64_t at_us;
+};
+static KeyEdge key_queue[KEY_QUEUE_SIZE];
+static volatile uint8_t key_queue_head = 0;
+static volatile uint8_t key_queue_tail = 0;
+
+// Button state, all times from the edge timestamps
+static bool btn_last_raw = false;       // level after the latest edge (true = pressed)
+static bool btn_stable = false;         // debounced state
+static uint64_t btn_change_us = 0;      // latest edge
+static uint64_t btn_burst_us = 0;       // first edge after a quiet spell
+static uint64_t btn_press_start_us = 0; // when the current press began
+static bool btn_handled = false;        // has this press been handled already?
+
+// Tap tempo
+static uint64_t tap_last_us = 0;            // previous press, 0 = none
+static uint32_t tap_intervals[TAP_HISTORY];
+static uint8_t tap_count = 0;
+static uint8_t tap_rejects = 0;
+static uint64_t randomize_at_us = 0;        // deferred randomize, 0 = none
+static uint8_t randomize_swap = RANDOMIZE_DEFAULT_SWAP;
+static uint8_t pattern_print_line = PATTERN_PRINT_IDLE;  // 0 = title, 1-8 = channels
+static uint32_t gen_bpm_tenths = DEFAULT_BPM_TENTHS;
+static uint32_t pending_bpm_tenths = 0;     // applied at the next pulse
+
+// External clock
+static uint8_t ext_clock_resolution = EXT_CLOCK_DEFAULT_RESOLUTION;
+static uint32_t ext_clock_last_edge_us = 0; // edge period the tempo was set from
+static bool ext_clock_following = false;    // the engine runs on the clock
+
+// Logic outputs
+static uint8_t logic_outputs = LOGIC_DEFAULT_OUTPUTS;
+
+// Markov training from MIDI mode
+static uint64_t markov_rec_start_us = 0;    // bar line of step 0, 0 = not recording
+static uint64_t markov_rec_last_us = 0;     // last note recorded
+static SmfPlayer markov_file;               // stored file being learnt
+static bool markov_file_learning = false;
+static uint32_t markov_file_ticks_per_step = 0;
+
+// MIDI mode heartbeat
+static uint32_t heartbeat_count = 0;
+static uint32_t last_print_ms = 0;
+
+static uint64_t timeout_us(uint32_t ms) {
+    return hal_time_us() + static_cast<uint64_t>(ms) * 1000;
+}
+
+static bool deadline_passed(uint64_t deadline, uint64_t now_us) {
+    return deadline != 0 && now_us >= deadline;
+}
+
+static void apply_hybrid_rules() {
+    scheduler_set_rules(hybrid_rules, hybrid_mute_steps * gen_controller.UsPerStep());
+}
+
+// Note -> solenoid mapping of MIDI and Playback modes: note % 8, 1-100 ms
+static uint32_t note_duration_ms(uint8_t velocity) {
+    return 1 + (velocity * 99 / 127);
+}
+
+static bool start_playback() {
+    uint32_t size = 0;
+    const uint8_t* file = smf_stored_file(&size);
+    if (!file || !smf_player.Open(file, size)) {
+        return false;
+    }
+    playback_start_us = hal_time_us() + LOOKAHEAD_US;
+    printf("[SMF] %lu bytes, %u tracks\n", static_cast<unsigned long>(size),
+           smf_player.num_tracks());
+    return true;
+}
+
+#if GEN_SONG
+static void start_demo_song() {
+    // One snapshot per section, rolled from its hit range
+    static const uint8_t section_hits[4][2] = {{2, 4}, {6, 12}, {16, 28}, {1, 2}};
+    for (uint8_t i = 0; i < 4; ++i) {
+        gen_controller.SetHitRange(section_hits[i][0], section_hits[i][1]);
+        gen_controller.Randomize();
+        gen_controller.SaveSnapshot(i);
+    }
+    gen_controller.SetHitRange(4, 16);
+
+    static const generative::SongEntry song[] = {
+        {0, 4}, {1, 8}, {2, 1}, {1, 8}, {2, 1}, {3, 2},
+    };
+    gen_controller.SetSong(song, sizeof(song) / sizeof(song[0]), true);
+    gen_controller.StartSong();
+}
+#endif
+
+// Engine time runs on the host clock when GEN_USB_CLOCK is on: map it to
+// the device timer with the drift estimate, rounded to the nearest us
+static uint64_t gen_to_device_us(uint64_t gen_us) {
+    const int64_t elapsed_us = static_cast<int64_t>(gen_us - trim_gen_us);
+    int64_t trim_x1e9 = elapsed_us * trim_ppb;
+    trim_x1e9 += trim_x1e9 >= 0 ? 500000000 : -500000000;
+    return trim_device_us + elapsed_us + trim_x1e9 / 1000000000;
+}
+
+static void set_clock_trim(int32_t ppb) {
+    trim_device_us = gen_to_device_us(gen_time_us);
+    trim_gen_us = gen_time_us;
+    trim_ppb = ppb;
+}
+
+static void start_generative(uint32_t seed) {
+    gen_controller.Init(seed, gen_bpm_tenths);
+    gen_controller.SetTapTempo(GEN_TAP_TEMPO);
+    gen_controller.SetClockResolution(ext_clock_resolution);
+    ext_clock_set_pulses_per_edge(gen_controller.PulsesPerClock());
+    ext_clock_clear();
+    ext_clock_last_edge_us = 0;
+    ext_clock_following = false;
+#if GEN_SONG
+    start_demo_song();
+#endif
+    gen_time_us = hal_time_us();
+    trim_gen_us = gen_time_us;
+    trim_device_us = gen_time_us;
+    grid_step_us = gen_time_us;
+    grid_step = 0;
+#if GEN_VERBOSE
+    gen_controller.SetVerbose(true);
+#endif
+}
+
+// Queue the solenoid pulses of an engine pulse due at due_us
+static void queue_engine_event(const generative::FireEvent& event, uint64_t due_us) {
+    if (gen_controller.at_step_start()) {
+        grid_step_us = due_us;
+        grid_step = gen_controller.step();
+    }
+    const uint8_t logic_mask = event.logic_mask & logic_outputs;
+    for (uint8_t i = 0; i < GPIO_LOGIC_COUNT; ++i) {
+        if (!(logic_mask & (1 << i))) {
+            continue;
+        }
+        uint32_t duration_us = LOGIC_TRIGGER_US;
+        if ((1 << i) == generative::kLogicClock) {
+            duration_us = gen_controller.clock_out_pulses() * gen_controller.UsPerPulse() / 2;
+        } else if ((1 << i) == generative::kLogicRandom) {
+            duration_us = gen_controller.UsPerStep() / 2;
+        }
+        scheduler_fire(SCHED_LOGIC_CHANNEL + i, SCHED_SOURCE_LOGIC, due_us, duration_us);
+    }
+    if (!event.gpio_mask) {
+        return;
+    }
+    for (uint8_t i = 0; i < GPIO_COUNT; ++i) {
+        if (event.gpio_mask & (1 << i)) {
+            scheduler_fire(i, SCHED_SOURCE_GENERATIVE, due_us,
+                           static_cast<uint32_t>(event.duration_ms[i]) * 1000);
+        }
+    }
+    PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+    gen_controller.LogEvent(event);
+}
+
+// Run the engine up to now + LOOKAHEAD_US and queue each step's pulses for
+// the exact time its pulse falls due
+static void run_generative(uint64_t now_us) {
+    while (gen_to_device_us(gen_time_us + gen_controller.UsToNextPulse()) <=
+           now_us + LOOKAHEAD_US) {
+        generative::FireEvent event;
+        uint64_t due_us;
+        {
+            PROFILE_SCOPE(PROFILE_ZONE_TICK);
+            if (pending_bpm_tenths) {
+                gen_controller.SetBpm(pending_bpm_tenths);
+                pending_bpm_tenths = 0;
+                if (mode == MODE_HYBRID) {
+                    apply_hybrid_rules();  // mute length is in steps
+                }
+            }
+            const uint32_t to_pulse_us = gen_controller.UsToNextPulse();
+            gen_time_us += to_pulse_us;
+            due_us = gen_to_device_us(gen_time_us);
+            event = gen_controller.Tick(to_pulse_us);
+        }
+        queue_engine_event(event, due_us);
+    }
+}
+
+// External clock: run the engine pulse by pulse as the clock edges (and
+// their interpolated pulses) fall due within the lookahead
+static void run_external_clock(uint64_t now_us) {
+    ExtClockEvent clock_event;
+    while (ext_clock_next(now_us + LOOKAHEAD_US, gen_controller.UsPerPulse(), &clock_event)) {
+        if (clock_event.type == EXT_CLOCK_RESET) {
+            gen_controller.Restart();
+            continue;
+        }
+        generative::FireEvent event;
+        {
+            PROFILE_SCOPE(PROFILE_ZONE_TICK);
+            event = gen_controller.ClockPulse();
+        }
+        // Internal timing picks up from here if generative mode restarts
+        gen_time_us = clock_event.at_us;
+        trim_gen_us = gen_time_us;
+        trim_device_us = gen_time_us;
+        queue_engine_event(event, clock_event.at_us);
+    }
+
+    // Follow the clock's tempo (step length for the quantizer and the hybrid
+    // mute) once it moves by more than 1%
+    const uint32_t edge_us = ext_clock_edge_us();
+    const uint32_t diff_us = edge_us > ext_clock_last_edge_us ? edge_us - ext_clock_last_edge_us
+                                                              : ext_clock_last_edge_us - edge_us;
+    if (edge_us && diff_us * 100 > ext_clock_last_edge_us) {
+        ext_clock_last_edge_us = edge_us;
+        // One quarter note is 24 pulses: bpm_tenths = 600e6 / quarter_us,
+        // kept to the tap tempo range like the internal tempo
+        const uint64_t quarter_us = static_cast<uint64_t>(edge_us) * 24 /
+                                    gen_controller.PulsesPerClock();
+        uint64_t bpm_tenths = 600000000ull / quarter_us;
+        if (bpm_tenths < TAP_MIN_BPM_TENTHS) bpm_tenths = TAP_MIN_BPM_TENTHS;
+        if (bpm_tenths > TAP_MAX_BPM_TENTHS) bpm_tenths = TAP_MAX_BPM_TENTHS;
+        gen_controller.SetBpm(static_cast<uint32_t>(bpm_tenths));
+        if (mode == MODE_HYBRID) {
+            apply_hybrid_rules();
+        }
+    }
+}
+
+// Print the patterns of the last randomize, one line per pass, once they
+// have been swapped in
+static void print_randomized_patterns(uint64_t now_us) {
+    if (pattern_print_line == PATTERN_PRINT_IDLE || gen_controller.randomize_pending()) {
+        return;
+    }
+    if (ext_clock_following) {
+        run_external_clock(now_us + PATTERN_PRINT_SLOT_US);
+    } else {
+        run_generative(now_us + PATTERN_PRINT_SLOT_US);
+    }
+    PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+    if (pattern_print_line == 0) {
+        printf("=== PATTERNS RANDOMIZED ===\n");
+    } else {
+        gen_controller.PrintChannel(pattern_print_line - 1);
+    }
+    pattern_print_line++;
+    if (pattern_print_line > generative::kNumChannels) {
+        pattern_print_line = PATTERN_PRINT_IDLE;
+    }
+}
+
+// Learn from the notes of a MIDI mode recording; a note after a long
+// silence starts a new one
+static void markov_record_note(uint8_t note, uint8_t velocity, uint64_t at_us) {
+    if (markov_file_learning) {
+        return;  // the model's bar in progress belongs to the file
+    }
+    const uint32_t step_us = gen_controller.UsPerStep();
+    const uint64_t gap_us = static_cast<uint64_t>(step_us) * generative::kPatternSteps * MARKOV_GAP_BARS;
+    if (!markov_rec_start_us || at_us - markov_rec_last_us > gap_us) {
+        gen_controller.markov().Flush();
+        markov_rec_start_us = at_us;
+    }
+    markov_rec_last_us = at_us;
+    const uint32_t step = static_cast<uint32_t>((at_us - markov_rec_start_us + step_us / 2) / step_us);
+    gen_controller.markov().Observe(note % GPIO_COUNT, step, velocity >= MARKOV_HIGH_VELOCITY);
+}
+
+static void markov_end_recording() {
+    if (!markov_rec_start_us) {
+        return;
+    }
+    markov_rec_start_us = 0;
+    gen_controller.markov().Flush();
+    PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+    printf("[MKV] %u bars learnt\n", gen_controller.markov().bars());
+}
+
+// Start learning the stored MIDI file, on the step grid of its own ticks
+static void markov_learn_file() {
+    markov_end_recording();
+    markov_file_learning = false;
+    uint32_t size = 0;
+    const uint8_t* file = smf_stored_file(&size);
+    if (!file || !markov_file.Open(file, size) || markov_file.division() < 8) {
+        return;
+    }
+    markov_file_ticks_per_step = markov_file.division() / 8;  // 1/32 notes
+    markov_file_learning = true;
+    gen_controller.markov().Flush();
+}
+
+// Learn up to MARKOV_FILE_NOTES_PER_POLL notes of the stored file
+static void markov_learn_file_poll() {
+    if (!markov_file_learning) {
+        return;
+    }
+    generative::MarkovModel& markov = gen_controller.markov();
+    SmfNote note;
+    for (uint8_t i = 0; i < MARKOV_FILE_NOTES_PER_POLL; ++i) {
+        if (!markov_file.Poll(UINT64_MAX, &note)) {
+            markov_file_learning = false;
+            markov.Flush();
+            PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+            printf("[MKV] %u bars learnt, with the stored file\n", markov.bars());
+            return;
+        }
+        const uint32_t step = (markov_file.position_tick() + markov_file_ticks_per_step / 2) /
+                              markov_file_ticks_per_step;
+        markov.Observe(note.note % GPIO_COUNT, step, note.velocity >= MARKOV_HIGH_VELOCITY);
+    }
+}
+
+// Handle a channel message; notes play at due_us (now or later)
+static void handle_midi_packet(const uint8_t packet[4], uint64_t due_us) {
+    MidiEvent msg;
+    if (!midi_parse_packet(packet, &msg)) {
+        return;  // malformed or unsupported packet
+    }
+
+    // Pulse onboard LED on any MIDI message
+    hal_gpio_put(GPIO_LED, 1);
+    led_off_deadline = timeout_us(100);
+
+    if (msg.type == MIDI_EVENT_NOTE_ON) {
+        const uint32_t duration_ms = note_duration_ms(msg.data2);
+        const uint64_t now_us = hal_time_us();
+        uint64_t at_us = due_us > now_us ? due_us : now_us;
+        if (mode == MODE_HYBRID) {
+            at_us = quantize_note(quantize, at_us, now_us, grid_step_us, grid_step,
+                                  gen_controller.UsPerStep());
+        }
+        scheduler_fire(msg.data1 % GPIO_COUNT, SCHED_SOURCE_LIVE, at_us, duration_ms * 1000);
+        if (mode == MODE_MIDI) {
+            markov_record_note(msg.data1, msg.data2, at_us);
+        }
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("MIDI Note On  ch=%u note=%u vel=%u dur=%lums", msg.channel, msg.data1, msg.data2,
+               static_cast<unsigned long>(duration_ms));
+        if (at_us != now_us) {
+            printf(" +%luus", static_cast<unsigned long>(at_us - now_us));
+        }
+        printf("\n");
+    } else if (msg.type == MIDI_EVENT_NOTE_OFF) {
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("MIDI Note Off ch=%u note=%u (ignored)\n", msg.channel, msg.data1);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               (msg.data1 == HYBRID_CC_RULES || msg.data1 == HYBRID_CC_MUTE_STEPS)) {
+        if (msg.data1 == HYBRID_CC_RULES) {
+            hybrid_rules = msg.data2 & (SCHED_RULE_LIVE_OVERRIDES | SCHED_RULE_MUTE_AFTER_LIVE);
+        } else {
+            hybrid_mute_steps = msg.data2;
+        }
+        apply_hybrid_rules();
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[HYB] rules=%u mute=%u steps\n", hybrid_rules, hybrid_mute_steps);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 >= QUANTIZE_CC_MODE && msg.data1 <= QUANTIZE_CC_STRENGTH) {
+        if (msg.data1 == QUANTIZE_CC_MODE) {
+            quantize.mode = msg.data2 <= QUANTIZE_NEAREST ? msg.data2 : QUANTIZE_OFF;
+        } else if (msg.data1 == QUANTIZE_CC_DIVISION) {
+            quantize.division_steps = msg.data2;
+        } else {
+            quantize.strength = msg.data2 > 100 ? 100 : msg.data2;
+        }
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[HYB] quantize mode=%u grid=%u steps strength=%u%%\n", quantize.mode,
+               quantize.division_steps, quantize.strength);
+    } else if ((msg.status & 0xF0) == 0xB0 && msg.data1 == JITTER_CC_DELAY_MS) {
+        jitter_buffer_set_delay(static_cast<uint32_t>(msg.data2) * 1000);
+        jitter_buffer_reset();
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[MIDI] jitter buffer delay=%ums\n", msg.data2);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == EXT_CLOCK_CC_RESOLUTION) {
+        ext_clock_resolution = msg.data2 > 2 ? 2 : msg.data2;
+        gen_controller.SetClockResolution(ext_clock_resolution);
+        ext_clock_set_pulses_per_edge(gen_controller.PulsesPerClock());
+        ext_clock_last_edge_us = 0;
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[CLK] %u pulses per clock edge\n", gen_controller.PulsesPerClock());
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == LOGIC_CC_OUTPUTS) {
+        logic_outputs = msg.data2 & LOGIC_DEFAULT_OUTPUTS;
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[LOGIC] outputs=0x%02X\n", logic_outputs);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == RANDOMIZE_CC_SWAP) {
+        randomize_swap = msg.data2 ? generative::kSwapAtStep : generative::kSwapAtBar;
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[GEN] randomize at next %s\n", randomize_swap ? "step" : "bar");
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == ENGINE_CC_SELECT) {
+        gen_controller.SetEngine(msg.data2);
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[GEN] engine %u\n", gen_controller.engine());
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               (msg.data1 == ENGINE_CC_AUTOMATON_RULE ||
+                msg.data1 == ENGINE_CC_AUTOMATON_TOTALISTIC)) {
+        generative::AutomatonRule rule;
+        rule.kind = msg.data1 == ENGINE_CC_AUTOMATON_RULE ? generative::kAutomatonElementary
+                                                          : generative::kAutomatonTotalistic;
+        rule.code = rule.kind == generative::kAutomatonElementary ? msg.data2 : msg.data2 & 0x3F;
+        gen_controller.SetAutomatonRule(rule);
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[GEN] automaton %s rule %u\n",
+               rule.kind == generative::kAutomatonElementary ? "elementary" : "totalistic",
+               rule.code);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 >= EVOLVE_CC_DENSITY && msg.data1 <= EVOLVE_CC_OVERLAP) {
+        generative::EvolveTargets targets = gen_controller.evolver().targets();
+        if (msg.data1 == EVOLVE_CC_DENSITY) {
+            targets.density = msg.data2;
+        } else if (msg.data1 == EVOLVE_CC_SYNCOPATION) {
+            targets.syncopation = msg.data2;
+        } else {
+            targets.overlap = msg.data2;
+        }
+        gen_controller.evolver().SetTargets(targets);
+        targets = gen_controller.evolver().targets();
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[GEN] evolve density %u syncopation %u overlap %u\n",
+               targets.density, targets.syncopation, targets.overlap);
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == TURING_CC_CHANCE) {
+        gen_controller.SetTuringChance(msg.data2 * 2);
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[GEN] turing chance %u/256\n", gen_controller.turing_chance());
+    } else if (mode == MODE_HYBRID && (msg.status & 0xF0) == 0xB0 &&
+               msg.data1 == TAP_CC_ENABLE) {
+        gen_controller.SetTapTempo(msg.data2 >= 64);
+        tap_last_us = 0;  // the next press starts afresh
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[TAP] tap tempo %s\n", gen_controller.tap_tempo() ? "on" : "off");
+    } else {
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("MIDI Msg     ch=%u status=0x%02X d1=%u d2=%u\n",
+               msg.channel, msg.status, msg.data1, msg.data2);
+    }
+}
+
+// Dispatch a live USB-MIDI packet: channel messages (plain or timestamped
+// SysEx) through the jitter buffer, file uploads if allowed
+static void dispatch_midi_packet(const uint8_t packet[4], bool uploads) {
+    const uint64_t arrival_us = hal_time_us();
+    SysexMessage sysex;
+    if (!sysex_packet(packet, &sysex)) {
+        handle_midi_packet(packet, jitter_buffer_due(arrival_us));
+        return;
+    }
+    if (sysex.cmd == SYSEX_CMD_TIMESTAMPED && sysex.length == 7) {
+        // <host_us> <status & 0x7F> <data1> <data2>: channel messages only
+        const uint8_t status = sysex.body[4] | 0x80;
+        if (status < 0xF0) {
+            const uint8_t inner[4] = {static_cast<uint8_t>(status >> 4), status,
+                                      sysex.body[5], sysex.body[6]};
+            handle_midi_packet(inner, jitter_buffer_due_host(sysex_read_u28(sysex.body),
+                                                             arrival_us));
+        }
+    } else if (uploads) {
+        // The upload rewrites the stored file: stop reading it
+        if (markov_file_learning) {
+            markov_file_learning = false;
+            gen_controller.markov().Flush();
+        }
+        smf_upload_message(sysex);
+        if (sysex.cmd == SYSEX_CMD_UPLOAD_END) {
+            markov_learn_file();
+        }
+    }
+}
+
+// Key edge interrupt: queue the edge for the button FSM
+static void key_edge_irq(uint8_t pin, bool level, uint64_t at_us) {
+    (void)pin;
+    const uint8_t head = key_queue_head;
+    const uint8_t next = (head + 1) % KEY_QUEUE_SIZE;
+    if (next == key_queue_tail) {
+        return;  // full: drop the edge, the FSM resyncs on the next one
+    }
+    key_queue[head].pressed = !level;  // active-low
+    key_queue[head].at_us = at_us;
+    key_queue_head = next;
+}
+
+// One tap interval: reject outliers, average the rest into the pending tempo
+static void tap_interval(uint32_t interval_us) {
+    if (tap_count >= 2) {
+        uint64_t sum = 0;
+        for (uint8_t i = 0; i < tap_count; ++i) {
+            sum += tap_intervals[i];
+        }
+        const uint32_t mean = static_cast<uint32_t>(sum / tap_count);
+        const uint32_t diff = interval_us > mean ? interval_us - mean : mean - interval_us;
+        if (diff > mean / TAP_OUTLIER_DIV && ++tap_rejects < 2) {
+            return;
+        }
+        if (diff > mean / TAP_OUTLIER_DIV) {
+            tap_count = 0;
+        }
+    }
+    tap_rejects = 0;
+
+    // Keep the latest TAP_HISTORY intervals (order does not matter)
+    if (tap_count < TAP_HISTORY) {
+        tap_intervals[tap_count++] = interval_us;
+    } else {
+        memmove(tap_intervals, tap_intervals + 1, (TAP_HISTORY - 1) * sizeof(tap_intervals[0]));
+        tap_intervals[TAP_HISTORY - 1] = interval_us;
+    }
+    uint64_t sum = 0;
+    for (uint8_t i = 0; i < tap_count; ++i) {
+        sum += tap_intervals[i];
+    }
+    // One beat per tap: bpm_tenths = 600e6 / interval_us
+    uint32_t bpm_tenths = static_cast<uint32_t>(600000000ull * tap_count / sum);
+    if (bpm_tenths < TAP_MIN_BPM_TENTHS) bpm_tenths = TAP_MIN_BPM_TENTHS;
+    if (bpm_tenths > TAP_MAX_BPM_TENTHS) bpm_tenths = TAP_MAX_BPM_TENTHS;
+    gen_bpm_tenths = bpm_tenths;
+    pending_bpm_tenths = bpm_tenths;
+    PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+    printf("[TAP] %lu.%lu BPM\n", static_cast<unsigned long>(bpm_tenths / 10),
+           static_cast<unsigned long>(bpm_tenths % 10));
+}
+
+// A short press with tap tempo on: a tap if it follows the previous press
+// closely enough, else a randomize unless a tap follows
+static void tap_press(uint64_t press_us, uint64_t now_us) {
+    if (tap_last_us && press_us > tap_last_us && press_us - tap_last_us <= TAP_MAX_INTERVAL_US) {
+        randomize_at_us = 0;
+        tap_interval(static_cast<uint32_t>(press_us - tap_last_us));
+    } else {
+        randomize_at_us = press_us + TAP_MAX_INTERVAL_US;
+        if (randomize_at_us < now_us) {
+            randomize_at_us = now_us;
+        }
+        tap_count = 0;
+        tap_rejects = 0;
+    }
+    tap_last_us = press_us;
+}
+
+// Debounce: the raw level becomes the stable state once it has held for
+// DEBOUNCE_MS at t_us. A press dates from the first edge of its bounce.
+// Returns 1 for a short press (on release).
+static uint8_t settle_button(uint64_t t_us) {
+    if (btn_last_raw == btn_stable || t_us - btn_change_us < DEBOUNCE_MS * 1000ull) {
+        return 0;
+    }
+    btn_stable = btn_last_raw;
+    if (btn_stable) {
+        btn_press_start_us = btn_burst_us;
+        btn_handled = false;
+        return 0;
+    }
+    if (!btn_handled) {
+        btn_handled = true;
+        return 1;
+    }
+    return 0;
+}
+
+// Process button edges: returns action
+// 0 = no action, 1 = short press, 2 = long press
+// Nothing is read from the pin: only the queued edges and the clock.
+static uint8_t process_button(uint64_t now_us) {
+    while (key_queue_tail != key_queue_head) {
+        const KeyEdge edge = key_queue[key_queue_tail];
+        key_queue_tail = (key_queue_tail + 1) % KEY_QUEUE_SIZE;
+
+        // A press or release that settled before this edge
+        const uint8_t action = settle_button(edge.at_us);
+        if (edge.at_us - btn_change_us >= DEBOUNCE_MS * 1000ull) {
+            btn_burst_us = edge.at_us;
+        }
+        btn_last_raw = edge.pressed;
+        btn_change_us = edge.at_us;
+        if (action) {
+            return action;
+        }
+    }
+
+    const uint8_t action = settle_button(now_us);
+    if (action) {
+        return action;
+    }
+
+    // Button held: check for long press
+    if (btn_stable && !btn_handled &&
+        now_us - btn_press_start_us >= LONG_PRESS_MS * 1000ull) {
+        btn_handled = true;
+        return 2;  // long press
+    }
+    return 0;
+}
+
+void app_init() {
+    // Solenoid GPIOs (2-9)
+    for (uint8_t i = 0; i < GPIO_COUNT; ++i) {
+        hal_gpio_init_output(GPIO_BASE + i);
+    }
+    // Logic outputs (12-16)
+    for (uint8_t i = 0; i < GPIO_LOGIC_COUNT; ++i) {
+        hal_gpio_init_output(GPIO_LOGIC_BASE + i);
+    }
+    scheduler_init();
+
+    // LED
+    hal_gpio_init_output(GPIO_LED);
+
+    // User Key (GPIO 23) - input with pull-up; edges are timestamped by the
+    // interrupt and drive the button FSM
+    hal_gpio_init_input_pullup(GPIO_USER_KEY);
+    hal_gpio_set_edge_irq(GPIO_USER_KEY, key_edge_irq);
+
+    // External clock and reset inputs
+    ext_clock_init(GPIO_CLOCK_IN, GPIO_RESET_IN);
+}
+
+void app_start(uint32_t seed) {
+    mode = MODE_GENERATIVE;
+    gen_controller.SetEngine(GEN_ENGINE);
+    start_generative(seed);
+    markov_learn_file();
+    printf("=== GENERATIVE MODE ON ===\n");
+    gen_controller.PrintPatterns();
+    last_print_ms = static_cast<uint32_t>(hal_time_us() / 1000);
+}
+
+void app_poll() {
+    const uint32_t now_ms = static_cast<uint32_t>(hal_time_us() / 1000);
+
+    // --- Button handling ---
+    uint8_t btn_action = process_button(hal_time_us());
+
+    if (btn_action == 1) {  // short press
+        if (mode == MODE_GENERATIVE || mode == MODE_HYBRID) {
+            if (gen_controller.tap_tempo()) {
+                tap_press(btn_press_start_us, hal_time_us());
+            } else {
+                randomize_at_us = hal_time_us();
+            }
+        }
+    } else if (btn_action == 2) {  // long press
+        randomize_at_us = 0;
+        pattern_print_line = PATTERN_PRINT_IDLE;
+        tap_last_us = 0;
+        scheduler_all_off();
+        scheduler_set_rules(0, 0);
+        hal_gpio_put(GPIO_LED, 0);
+        led_off_deadline = 0;
+        markov_end_recording();
+        if (mode == MODE_GENERATIVE) {
+            // The groove carries on; live notes join in
+            mode = MODE_HYBRID;
+            apply_hybrid_rules();
+            printf("=== HYBRID MODE ===\n");
+        } else if (mode == MODE_HYBRID) {
+            mode = MODE_MIDI;
+            printf("=== MIDI MODE ===\n");
+        } else if (mode == MODE_MIDI && start_playback()) {
+            mode = MODE_PLAYBACK;
+            printf("=== PLAYBACK MODE ===\n");
+        } else {
+            mode = MODE_GENERATIVE;
+            start_generative(static_cast<uint32_t>(hal_time_us()));
+            printf("=== GENERATIVE MODE ===\n");
+            gen_controller.PrintPatterns();
+        }
+    }
+
+    if (deadline_passed(randomize_at_us, hal_time_us())) {
+        randomize_at_us = 0;
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        // Rolled now, played from the next bar line (or step)
+        gen_controller.RequestRandomize(randomize_swap);
+        pattern_print_line = 0;
+        printf("[KEY] short press - randomize at next %s\n", randomize_swap ? "step" : "bar");
+    }
+
+    // --- Mode-specific processing ---
+    if (mode == MODE_GENERATIVE || mode == MODE_HYBRID) {
+        // Queue the generative pulses due within the lookahead, on the
+        // external clock once it has started
+        if (ext_clock_active()) {
+            if (!ext_clock_following) {
+                // The first clock edge plays the bar line
+                ext_clock_following = true;
+                gen_controller.Restart();
+                printf("[CLK] external clock\n");
+            }
+            run_external_clock(hal_time_us());
+        } else {
+            run_generative(hal_time_us());
+        }
+        print_randomized_patterns(hal_time_us());
+
+        // LED beat indicator: blink on beat (every 8 steps)
+        uint8_t step = gen_controller.step();
+        if ((step & 0x07) == 0) {
+            hal_gpio_put(GPIO_LED, 1);
+            led_off_deadline = timeout_us(50);
+        }
+
+        PROFILE_SCOPE(PROFILE_ZONE_MIDI);
+        uint32_t midi_packets = hal_midi_available();
+        if (midi_packets) {
+            if (midi_packets > 32) midi_packets = 32;
+            for (uint32_t i = 0; i < midi_packets; ++i) {
+                uint8_t packet[4] = {0};
+                if (!hal_midi_read(packet)) break;
+                // Hybrid: live notes over the groove. Generative: drain silently
+                // to keep USB healthy.
+                if (mode == MODE_HYBRID) {
+                    dispatch_midi_packet(packet, false);
+                }
+            }
+        }
+    } else if (mode == MODE_MIDI) {
+        // MIDI mode: process incoming MIDI packets
+        PROFILE_SCOPE(PROFILE_ZONE_MIDI);
+        uint32_t midi_packets = hal_midi_available();
+        if (midi_packets) {
+            const uint32_t max_packets = 32;
+            if (midi_packets > max_packets) {
+                midi_packets = max_packets;
+            }
+            for (uint32_t i = 0; i < midi_packets; ++i) {
+                uint8_t packet[4] = {0};
+                if (!hal_midi_read(packet)) break;
+                dispatch_midi_packet(packet, true);
+            }
+        }
+
+        // A recording ends after a silence
+        const uint64_t gap_us = static_cast<uint64_t>(gen_controller.UsPerStep()) *
+                                generative::kPatternSteps * MARKOV_GAP_BARS;
+        if (markov_rec_start_us && hal_time_us() > markov_rec_last_us + gap_us) {
+            markov_end_recording();
+        }
+    } else {
+        // Playback mode: queue every note due within the lookahead at its
+        // exact time, then loop at the end of the file
+        {
+            PROFILE_SCOPE(PROFILE_ZONE_TICK);
+            const uint64_t horizon_us = hal_time_us() + LOOKAHEAD_US;
+            SmfNote note;
+            while (horizon_us >= playback_start_us &&
+                   smf_player.Poll(horizon_us - playback_start_us, &note)) {
+                scheduler_fire(note.note % GPIO_COUNT, SCHED_SOURCE_LIVE,
+                               playback_start_us + smf_player.position_us(),
+                               note_duration_ms(note.velocity) * 1000);
+                hal_gpio_put(GPIO_LED, 1);
+                led_off_deadline = timeout_us(50);
+            }
+            if (smf_player.finished() && smf_player.position_us() > 0) {
+                playback_start_us += smf_player.position_us();
+                smf_player.Rewind();
+            }
+        }
+
+        // Silently drain MIDI to keep USB healthy
+        PROFILE_SCOPE(PROFILE_ZONE_MIDI);
+        uint32_t midi_packets = hal_midi_available();
+        if (midi_packets) {
+            if (midi_packets > 32) midi_packets = 32;
+            for (uint32_t i = 0; i < midi_packets; ++i) {
+                uint8_t packet[4] = {0};
+                if (!hal_midi_read(packet)) break;
+            }
+        }
+    }
+
+    // --- Shared: Markov training on the stored file ---
+    markov_learn_file_poll();
+
+    // --- Shared: host clock drift estimate ---
+    if (usb_clock_update(hal_time_us())) {
+        const int32_t ppb = usb_clock_drift_ppb();
+#if GEN_USB_CLOCK
+        set_clock_trim(ppb);
+#endif
+        // Report the lock, then changes of 1 ppm or more
+        const int32_t change = ppb - usb_clock_printed_ppb;
+        if (usb_clock_locked() && (!usb_clock_reported || change >= 1000 || change <= -1000)) {
+            usb_clock_reported = true;
+            usb_clock_printed_ppb = ppb;
+            PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+            printf("[USB] device timer %+ld ppb vs host clock\n", static_cast<long>(ppb));
+        } else if (!usb_clock_locked() && usb_clock_reported) {
+            usb_clock_reported = false;
+            PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+            printf("[USB] host clock lost\n");
+        }
+    }
+
+    // --- Shared: pulses lost to a full scheduler queue ---
+    const uint32_t rejected = scheduler_rejected();
+    if (rejected != sched_printed_rejected && now_ms - sched_rejected_print_ms >= 1000) {
+        sched_printed_rejected = rejected;
+        sched_rejected_print_ms = now_ms;
+        PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+        printf("[SCHED] %lu pulses rejected, queue full\n", static_cast<unsigned long>(rejected));
+    }
+
+    // --- Shared: LED deadline (solenoids are switched off by the scheduler) ---
+    {
+        PROFILE_SCOPE(PROFILE_ZONE_DEADLINES);
+        if (deadline_passed(led_off_deadline, hal_time_us())) {
+            hal_gpio_put(GPIO_LED, 0);
+            led_off_deadline = 0;
+        }
+    }
+
+    // Heartbeat (MIDI mode only)
+    if (mode == MODE_MIDI) {
+        if (now_ms - last_print_ms >= 1000) {
+            last_print_ms = now_ms;
+            PROFILE_SCOPE(PROFILE_ZONE_PRINTF);
+            printf("Hello World! Count: %lu\n", static_cast<unsigned long>(heartbeat_count++));
+        }
+    }
+}
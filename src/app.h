@@ -0,0 +1,32 @@
+/**
+ * Application logic: button FSM, mode switching, MIDI dispatch and solenoid
+ * deadlines. Talks to the hardware only through hal.h.
+ */
+
+#ifndef APP_H_
+#define APP_H_
+
+#include <stdint.h>
+
+// GPIO assignments
+static const uint8_t GPIO_BASE = 2;
+static const uint8_t GPIO_COUNT = 8;
+static const uint8_t GPIO_LED = 25;
+static const uint8_t GPIO_USER_KEY = 23;
+static const uint8_t GPIO_CLOCK_IN = 10;   // external clock, active-low
+static const uint8_t GPIO_RESET_IN = 11;  // external reset, active-low
+// Logic outputs, in generative::LogicOutput bit order: clock, reset, bar,
+// accent, random gate on GPIO 12-16
+static const uint8_t GPIO_LOGIC_BASE = 12;
+static const uint8_t GPIO_LOGIC_COUNT = 5;
+
+// Configure all pins and switch every output off
+void app_init();
+
+// Enter generative mode with the given RNG seed and print the patterns
+void app_start(uint32_t seed);
+
+// One main loop pass; call about once per millisecond
+void app_poll();
+
+#endif  // APP_H_
@@ -0,0 +1,118 @@
+#include "ext_clock.h"
+
+#include "hal.h"
+
+static const uint8_t EDGE_QUEUE_SIZE = 16;
+
+// Active edges from the interrupt (single producer, single consumer ring)
+static ExtClockEvent edge_queue[EDGE_QUEUE_SIZE];
+static volatile uint8_t edge_head = 0;
+static volatile uint8_t edge_tail = 0;
+
+static uint8_t clock_pin = 0xFF;
+static uint8_t reset_pin = 0xFF;
+static uint8_t pulses_per_edge = 1;
+
+// Current clock edge and the pulses it stands for
+static bool have_edge = false;
+static uint64_t edge_us = 0;
+static uint32_t edge_interval_us = 0;  // 0 = not measured yet
+static uint8_t pulse_index = 0;        // next pulse of the current edge
+
+static void edge_irq(uint8_t pin, bool level, uint64_t at_us) {
+    if (level) {
+        return;  // active-low: only the falling edge counts
+    }
+    const uint8_t head = edge_head;
+    const uint8_t next = (head + 1) % EDGE_QUEUE_SIZE;
+    if (next == edge_tail) {
+        return;  // full: a burst far beyond any clock rate
+    }
+    edge_queue[head].type = pin == clock_pin ? EXT_CLOCK_PULSE : EXT_CLOCK_RESET;
+    edge_queue[head].at_us = at_us;
+    edge_head = next;
+}
+
+void ext_clock_init(uint8_t clock, uint8_t reset) {
+    clock_pin = clock;
+    reset_pin = reset;
+    hal_gpio_init_input_pullup(clock_pin);
+    hal_gpio_init_input_pullup(reset_pin);
+    hal_gpio_set_edge_irq(clock_pin, edge_irq);
+    hal_gpio_set_edge_irq(reset_pin, edge_irq);
+}
+
+void ext_clock_set_pulses_per_edge(uint8_t pulses) {
+    pulses_per_edge = pulses ? pulses : 1;
+    if (pulse_index > pulses_per_edge) {
+        pulse_index = pulses_per_edge;
+    }
+}
+
+bool ext_clock_next(uint64_t horizon_us, uint32_t pulse_us_hint, ExtClockEvent* event) {
+    while (true) {
+        const bool pending = have_edge && pulse_index < pulses_per_edge;
+        uint64_t pulse_due_us = 0;
+        if (pending) {
+            const uint64_t interval_us = edge_interval_us ? edge_interval_us
+                                                          : static_cast<uint64_t>(pulse_us_hint) *
+                                                                pulses_per_edge;
+            pulse_due_us = edge_us + EXT_CLOCK_LATENCY_US +
+                           interval_us * pulse_index / pulses_per_edge;
+        }
+
+        if (edge_tail != edge_head) {
+            const ExtClockEvent edge = edge_queue[edge_tail];
+            const uint64_t edge_due_us = edge.at_us + EXT_CLOCK_LATENCY_US;
+            if (!pending || edge_due_us <= pulse_due_us) {
+                if (edge_due_us > horizon_us) {
+                    return false;
+                }
+                if (edge.type == EXT_CLOCK_PULSE && pending) {
+                    // Early edge: the rest of the previous one catches up
+                    pulse_index++;
+                    event->type = EXT_CLOCK_PULSE;
+                    event->at_us = edge_due_us;
+                    return true;
+                }
+                edge_tail = (edge_tail + 1) % EDGE_QUEUE_SIZE;
+                if (edge.type == EXT_CLOCK_RESET) {
+                    pulse_index = pulses_per_edge;  // what is left is past the reset
+                    event->type = EXT_CLOCK_RESET;
+                    event->at_us = edge_due_us;
+                    return true;
+                }
+                edge_interval_us = have_edge && edge.at_us - edge_us < EXT_CLOCK_TIMEOUT_US
+                                       ? static_cast<uint32_t>(edge.at_us - edge_us)
+                                       : 0;
+                edge_us = edge.at_us;
+                have_edge = true;
+                pulse_index = 0;
+                continue;
+            }
+        }
+
+        if (pending && pulse_due_us <= horizon_us) {
+            pulse_index++;
+            event->type = EXT_CLOCK_PULSE;
+            event->at_us = pulse_due_us;
+            return true;
+        }
+        return false;
+    }
+}
+
+bool ext_clock_active() {
+    return have_edge || edge_tail != edge_head;
+}
+
+uint32_t ext_clock_edge_us() {
+    return edge_interval_us;
+}
+
+void ext_clock_clear() {
+    edge_tail = edge_head;
+    have_edge = false;
+    edge_interval_us = 0;
+    pulse_index = 0;
+}
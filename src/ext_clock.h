@@ -0,0 +1,61 @@
+/**
+ * External clock and reset trigger inputs
+ *
+ * Both inputs are edge interrupts timestamped to the microsecond. Each clock
+ * edge stands for a number of 24 PPQN engine pulses (6, 3 or 1 at 4, 8 or
+ * 24 PPQN). The first pulse falls on the edge; the others are interpolated
+ * evenly over the edge period measured so far. If the next edge comes before
+ * they are all due, the rest catch up on that edge; if it comes late, the
+ * engine waits for it. Either way the engine stays locked to the clock count.
+ *
+ * Pulses are due a fixed EXT_CLOCK_LATENCY_US after the edge they derive
+ * from, so the foreground loop can queue them at their exact time with the
+ * solenoid scheduler: constant latency instead of loop-pass jitter. A reset
+ * edge makes the next clock edge play the bar line.
+ *
+ * Inputs are active-low (a transistor buffer from the rack pulls the pin
+ * down on a high gate), with the internal pull-up.
+ */
+
+#ifndef EXT_CLOCK_H_
+#define EXT_CLOCK_H_
+
+#include <stdint.h>
+
+static const uint32_t EXT_CLOCK_LATENCY_US = 2000;
+
+// Edges further apart than this are a stop and restart: the period is
+// measured again from the restart
+static const uint32_t EXT_CLOCK_TIMEOUT_US = 2000000;
+
+enum ExtClockEventType {
+    EXT_CLOCK_PULSE,
+    EXT_CLOCK_RESET
+};
+
+struct ExtClockEvent {
+    uint8_t type;    // ExtClockEventType
+    uint64_t at_us;  // when it is due (hal_time_us())
+};
+
+// Configure the pins and enable their edge interrupts
+void ext_clock_init(uint8_t clock_pin, uint8_t reset_pin);
+
+// Engine pulses per clock edge (1, 3 or 6 for 24, 8 or 4 PPQN)
+void ext_clock_set_pulses_per_edge(uint8_t pulses);
+
+// Next pulse or reset due by horizon_us, in time order. pulse_us_hint is the
+// pulse length to interpolate with until two edges have been seen.
+bool ext_clock_next(uint64_t horizon_us, uint32_t pulse_us_hint, ExtClockEvent* event);
+
+// A clock edge has come since the last ext_clock_clear(): the engine
+// follows the clock (and stops with it) from then on
+bool ext_clock_active();
+
+// Measured time between clock edges, 0 until known
+uint32_t ext_clock_edge_us();
+
+// Drop queued edges and forget the clock (when another mode takes over)
+void ext_clock_clear();
+
+#endif  // EXT_CLOCK_H_
@@ -0,0 +1,68 @@
+#include "generative/automaton.h"
+
+namespace generative {
+
+namespace {
+
+inline uint32_t RotateLeft(uint32_t x, uint8_t n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+inline uint32_t RotateRight(uint32_t x, uint8_t n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+// All ones if bit n of code is set, else 0
+inline uint32_t RuleMask(uint8_t code, uint8_t n) {
+    return 0u - ((code >> n) & 1u);
+}
+
+// x where want is all ones, ~x where it is 0
+inline uint32_t Match(uint32_t x, uint32_t want) {
+    return ~(x ^ want);
+}
+
+uint32_t Elementary(uint32_t row, uint8_t code) {
+    const uint32_t left = RotateLeft(row, 1);  // bit N holds step N - 1
+    const uint32_t right = RotateRight(row, 1);
+    uint32_t next = 0;
+    for (uint8_t n = 0; n < 8; ++n) {
+        next |= RuleMask(code, n) & Match(left, RuleMask(n, 2)) &
+                Match(row, RuleMask(n, 1)) & Match(right, RuleMask(n, 0));
+    }
+    return next;
+}
+
+uint32_t Totalistic(uint32_t row, uint8_t code) {
+    const uint32_t a = RotateLeft(row, 2);
+    const uint32_t b = RotateLeft(row, 1);
+    const uint32_t c = RotateRight(row, 1);
+    const uint32_t d = RotateRight(row, 2);
+
+    // Bit-sliced count of the five cells, 0-5 = 4 * s2 + 2 * s1 + s0: two
+    // full adders, then the two carries added
+    const uint32_t x0 = a ^ b ^ row;
+    const uint32_t x1 = (a & b) | (row & (a ^ b));
+    const uint32_t s0 = x0 ^ c ^ d;
+    const uint32_t y1 = (x0 & c) | (d & (x0 ^ c));
+    const uint32_t s1 = x1 ^ y1;
+    const uint32_t s2 = x1 & y1;
+
+    uint32_t next = 0;
+    for (uint8_t n = 0; n < 6; ++n) {
+        next |= RuleMask(code, n) & Match(s2, RuleMask(n, 2)) &
+                Match(s1, RuleMask(n, 1)) & Match(s0, RuleMask(n, 0));
+    }
+    return next;
+}
+
+}  // namespace
+
+uint32_t AutomatonGeneration(uint32_t row, AutomatonRule rule) {
+    if (rule.kind == kAutomatonTotalistic) {
+        return Totalistic(row, rule.code);
+    }
+    return Elementary(row, rule.code);
+}
+
+}  // namespace generative
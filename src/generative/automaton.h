@@ -0,0 +1,33 @@
+#ifndef GENERATIVE_AUTOMATON_H_
+#define GENERATIVE_AUTOMATON_H_
+
+#include <stdint.h>
+
+namespace generative {
+
+// Cellular automata on 32-step rings: a channel's trigger pattern is one row
+// of cells (step N in bit N, step 31 next to step 0) and a generation
+// computes every cell at once with whole-word bitwise operations. The
+// neighbours of all cells are the row rotated by one or two steps; the rule
+// is then applied as a sum of products over them, a few dozen instructions
+// per generation with no loop over the cells.
+enum AutomatonKind {
+    // Wolfram rule 0-255: bit (4 * left + 2 * self + right) of the code is
+    // the cell's next state, left being the previous step
+    kAutomatonElementary,
+    // 5-cell totalistic code 0-63: the cell is alive next if bit N of the
+    // code is set, N being the live cells among itself and two on each side
+    kAutomatonTotalistic
+};
+
+struct AutomatonRule {
+    uint8_t kind;  // AutomatonKind
+    uint8_t code;
+};
+
+// Next generation of a row
+uint32_t AutomatonGeneration(uint32_t row, AutomatonRule rule);
+
+}  // namespace generative
+
+#endif  // GENERATIVE_AUTOMATON_H_
@@ -0,0 +1,312 @@
+#include "generative/bench.h"
+
+#include <stdio.h>
+
+#include "generative/automaton.h"
+#include "generative/evolve.h"
+#include "generative/generative_controller.h"
+#include "generative/pattern_dict.h"
+#include "generative/pattern_index.h"
+#include "grids/pattern_generator.h"
+#include "midi_parser.h"
+
+namespace generative {
+
+namespace {
+
+// Calls timed together; keeps every batch well inside the 24-bit SysTick range.
+const uint32_t kBatch = 64;
+
+// Tempo at which every 1 ms Tick() advances exactly one pulse (25e6 / 1000).
+const uint32_t kBpmOnePulsePerTick = 25000;
+
+// Slowest tempo: a pulse every 25 s, so every Tick() is idle.
+const uint32_t kBpmIdle = 1;
+
+volatile uint32_t sink;
+
+class Timer {
+public:
+    explicit Timer(const BenchClock& clock) : clock_(clock), start_(0), overhead_(~0u) {
+        // Cost of reading the counter twice, subtracted from every sample.
+        for (uint8_t i = 0; i < 16; ++i) {
+            Start();
+            uint32_t delta = Elapsed();
+            if (delta < overhead_) overhead_ = delta;
+        }
+    }
+
+    void Start() { start_ = clock_.now(); }
+
+    uint32_t Stop() const {
+        uint32_t delta = Elapsed();
+        return delta > overhead_ ? delta - overhead_ : 0;
+    }
+
+private:
+    uint32_t Elapsed() const { return (clock_.now() - start_) & clock_.mask; }
+
+    const BenchClock& clock_;
+    uint32_t start_;
+    uint32_t overhead_;
+};
+
+void Report(const BenchClock& clock, const char* name, uint64_t total,
+            uint32_t iters, const char* label) {
+    double per_op = iters ? static_cast<double>(total) / iters : 0.0;
+    printf("{\"bench\":\"%s\",\"unit\":\"%s\",\"iters\":%lu,\"per_op\":%.2f",
+           name, clock.unit, static_cast<unsigned long>(iters), per_op);
+    if (label) {
+        printf(",\"label\":\"%s\"", label);
+    }
+    printf("}\n");
+}
+
+void BenchTickIdle(const BenchClock& clock, uint32_t iterations, const char* label) {
+    GenerativeController gen;
+    gen.Init(1, kBpmIdle);
+
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    while (done < iterations) {
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            sink = gen.Tick(1000).gpio_mask;
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    Report(clock, "tick_idle", total, done, label);
+}
+
+void BenchTickPulse(const BenchClock& clock, uint32_t iterations, const char* label,
+                    uint8_t engine, const char* pulse_name, const char* step_name) {
+    GenerativeController gen;
+    gen.Init(1, kBpmOnePulsePerTick);
+    gen.SetEngine(engine);
+
+    // Every call advances one pulse. Only the first pulse of a step evaluates
+    // the channels, which shows up as a change of step().
+    Timer timer(clock);
+    uint64_t pulse_total = 0;
+    uint64_t step_total = 0;
+    uint32_t pulses = 0;
+    uint32_t steps = 0;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        const uint8_t prev_step = gen.step();
+        timer.Start();
+        sink = gen.Tick(1000).gpio_mask;
+        const uint32_t elapsed = timer.Stop();
+        if (gen.step() != prev_step) {
+            step_total += elapsed;
+            steps++;
+        } else {
+            pulse_total += elapsed;
+            pulses++;
+        }
+    }
+    Report(clock, pulse_name, pulse_total, pulses, label);
+    Report(clock, step_name, step_total, steps, label);
+}
+
+void BenchDrumMapLevel(const BenchClock& clock, uint32_t iterations, const char* label) {
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    uint32_t rng = 1;
+    uint32_t acc = 0;
+    while (done < iterations) {
+        // Arguments are drawn before timing so the LCG stays out of the sample.
+        uint8_t args[kBatch][4];
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            args[i][0] = (rng >> 8) % grids::kStepsPerPattern;
+            args[i][1] = (rng >> 13) % grids::kNumParts;
+            args[i][2] = rng >> 16;
+            args[i][3] = rng >> 24;
+        }
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            acc += grids::PatternGenerator::GetDrumMapLevel(
+                args[i][0], args[i][1], args[i][2], args[i][3]);
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    sink = acc;
+    Report(clock, "drum_map_level", total, done, label);
+}
+
+void BenchRandomize(const BenchClock& clock, uint32_t iterations, const char* label) {
+    GenerativeController gen;
+    gen.Init(1, 1200);
+
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    while (done < iterations) {
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            gen.Randomize();
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    Report(clock, "randomize", total, done, label);
+}
+
+// Full render: the 32-step trigger pattern of every channel from a drawn
+// index entry, the lookups RollPatterns() makes (index, then dictionary).
+// render_drum_map renders the same cells from the drum map, a level compare
+// per step, as the pattern index tool does and Randomize() did before the
+// dictionary. Entries are drawn before timing.
+void BenchRender(const BenchClock& clock, uint32_t iterations, const char* label) {
+    Timer timer(clock);
+    uint64_t dict_total = 0;
+    uint64_t map_total = 0;
+    uint32_t done = 0;
+    uint32_t map_done = 0;
+    uint32_t rng = 1;
+    uint32_t acc = 0;
+    while (done < iterations) {
+        // Render i, channel ch takes entry (i + 8 * ch) % kBatch
+        uint16_t entries[kBatch];
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            entries[i] = (rng >> 8) % kIndexCells;
+        }
+
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            for (uint8_t ch = 0; ch < kNumChannels; ++ch) {
+                const uint16_t cell = kPatternIndex[entries[(i + 8 * ch) % kBatch]].cell;
+                acc ^= PatternDictMask(cell);
+            }
+        }
+        dict_total += timer.Stop();
+
+        timer.Start();
+        for (uint8_t ch = 0; ch < kNumChannels; ++ch) {
+            const uint16_t cell = kPatternIndex[entries[8 * ch]].cell;
+            const uint8_t part = IndexCellPart(cell);
+            const uint8_t x = IndexCellX(cell);
+            const uint8_t y = IndexCellY(cell);
+            const uint8_t threshold = 255 - IndexCellDensity(cell);
+            uint32_t mask = 0;
+            for (uint8_t step = 0; step < kPatternSteps; ++step) {
+                if (grids::PatternGenerator::GetDrumMapLevel(step, part, x, y) > threshold) {
+                    mask |= 1u << step;
+                }
+            }
+            acc ^= mask;
+        }
+        map_total += timer.Stop();
+        map_done++;
+        done += kBatch;
+    }
+    sink = acc;
+    Report(clock, "render_patterns", dict_total, done, label);
+    Report(clock, "render_drum_map", map_total, map_done, label);
+}
+
+// One automaton generation of a row, elementary and totalistic rules
+// alternating, each generation fed back in as the next row.
+void BenchAutomaton(const BenchClock& clock, uint32_t iterations, const char* label) {
+    AutomatonRule rules[2];
+    rules[0].kind = kAutomatonElementary;
+    rules[0].code = 110;
+    rules[1].kind = kAutomatonTotalistic;
+    rules[1].code = 0x16;
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    uint32_t row = 0x00010001u;
+    while (done < iterations) {
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            row = AutomatonGeneration(row, rules[i & 1]) | 1u;
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    sink = row;
+    Report(clock, "automaton_generation", total, done, label);
+}
+
+// One evolution generation of 8 rows at the default targets, fed back in.
+void BenchEvolve(const BenchClock& clock, uint32_t iterations, const char* label) {
+    Evolver evolver;
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    uint32_t rows[kNumChannels];
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        rows[i] = 0x01010101u << (i % 8);
+    }
+    while (done < iterations) {
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            evolver.Generation(rows, kNumChannels);
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    sink = rows[0];
+    Report(clock, "evolve_generation", total, done, label);
+}
+
+// USB-MIDI packet decoding over a stream of mostly valid notes mixed with
+// random bytes, the kind of input a misbehaving host can send.
+void BenchMidiParse(const BenchClock& clock, uint32_t iterations, const char* label) {
+    Timer timer(clock);
+    uint64_t total = 0;
+    uint32_t done = 0;
+    uint32_t rng = 1;
+    uint32_t acc = 0;
+    while (done < iterations) {
+        uint8_t packets[kBatch][4];
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            if (rng & 0x80000000u) {
+                packets[i][0] = 0x09;
+                packets[i][1] = 0x90;
+                packets[i][2] = (rng >> 8) & 0x7F;
+                packets[i][3] = (rng >> 16) & 0x7F;
+            } else {
+                packets[i][0] = rng;
+                packets[i][1] = rng >> 8;
+                packets[i][2] = rng >> 16;
+                packets[i][3] = rng >> 24;
+            }
+        }
+        timer.Start();
+        for (uint32_t i = 0; i < kBatch; ++i) {
+            MidiEvent event;
+            midi_parse_packet(packets[i], &event);
+            acc += event.type;
+        }
+        total += timer.Stop();
+        done += kBatch;
+    }
+    sink = acc;
+    Report(clock, "midi_parse_packet", total, done, label);
+}
+
+}  // namespace
+
+void RunBenchmarks(const BenchClock& clock, uint32_t iterations,
+                   const char* label) {
+    BenchTickIdle(clock, iterations, label);
+    BenchTickPulse(clock, iterations, label, kEngineGrids, "tick_pulse", "tick_step");
+    BenchTickPulse(clock, iterations, label, kEngineTuring, "tick_pulse_turing",
+                   "tick_step_turing");
+    BenchDrumMapLevel(clock, iterations, label);
+    BenchRandomize(clock, iterations / 16, label);
+    BenchRender(clock, iterations / 64, label);
+    BenchAutomaton(clock, iterations, label);
+    BenchEvolve(clock, iterations / 16, label);
+    BenchMidiParse(clock, iterations, label);
+}
+
+}  // namespace generative
@@ -0,0 +1,24 @@
+#ifndef GENERATIVE_BENCH_H_
+#define GENERATIVE_BENCH_H_
+
+#include <stdint.h>
+
+namespace generative {
+
+// Free-running counter used to time the benchmarks. The host build counts
+// nanoseconds, the firmware counts CPU cycles (SysTick, 24 bits wide).
+struct BenchClock {
+    uint32_t (*now)();
+    uint32_t mask;       // counter width; deltas are taken modulo mask + 1
+    const char* unit;    // "ns" or "cycles"
+};
+
+// Time the engine hot paths and print one JSON object per line to stdout:
+//   {"bench":"tick_idle","unit":"ns","iters":100000,"per_op":4.21,"label":"..."}
+// label (optional) tags every line, e.g. with the git revision.
+void RunBenchmarks(const BenchClock& clock, uint32_t iterations,
+                   const char* label);
+
+}  // namespace generative
+
+#endif  // GENERATIVE_BENCH_H_
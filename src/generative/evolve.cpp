@@ -0,0 +1,105 @@
+#include "generative/evolve.h"
+
+namespace generative {
+
+namespace {
+
+const uint32_t kGrid = 0x55555555u;      // 1/16 notes: even steps
+const uint32_t kOffBeat = 0x54545454u;   // 1/16 notes other than the beats
+const uint32_t kHalfBar = 0x0000FFFFu;
+
+// Weights of a hit off the density and syncopation targets
+const int16_t kDensityWeight = 4;
+const int16_t kSyncopationWeight = 2;
+
+// A mutant scoring less than this below the row still wins 1 time in 16
+const int16_t kDriftSlack = 5;
+
+const uint8_t kMaxDensity = 16;
+const uint8_t kMaxSyncopation = 12;
+const uint8_t kMaxOverlap = 15;
+
+inline uint32_t RotateLeft(uint32_t x, uint8_t n) {
+    return (x << n) | (x >> ((32 - n) & 31));
+}
+
+inline int16_t Distance(uint8_t a, uint8_t b) {
+    return a > b ? a - b : b - a;
+}
+
+}  // namespace
+
+Evolver::Evolver() : rng_state_(1) {
+    targets_.density = 8;
+    targets_.syncopation = 2;
+    targets_.overlap = 2;
+}
+
+void Evolver::SetTargets(const EvolveTargets& targets) {
+    targets_ = targets;
+    if (targets_.density > kMaxDensity) targets_.density = kMaxDensity;
+    if (targets_.syncopation > kMaxSyncopation) targets_.syncopation = kMaxSyncopation;
+    if (targets_.overlap > kMaxOverlap) targets_.overlap = kMaxOverlap;
+}
+
+int16_t Evolver::Fitness(uint32_t row, uint32_t crowded) const {
+    const uint8_t hits = __builtin_popcount(row);
+    // Bit N of the right rotation is step N + 2, the next 1/16 note
+    const uint8_t syncopated = __builtin_popcount(row & kOffBeat & ~RotateLeft(row, 30));
+    const uint8_t shared = __builtin_popcount(row & crowded);
+    return -(kDensityWeight * Distance(hits, targets_.density) +
+             kSyncopationWeight * Distance(syncopated, targets_.syncopation) +
+             static_cast<int16_t>(targets_.overlap) * shared);
+}
+
+uint32_t Evolver::Mutate(const uint32_t* rows, uint8_t count, uint8_t i) {
+    const uint32_t r = NextRandom();
+    const uint32_t row = rows[i];
+    switch ((count > 1 ? r : 0) & 3) {
+        case 2:
+            return RotateLeft(row, (r & 4) ? 2 : 30);
+        case 3: {
+            const uint32_t other = rows[(i + 1 + (r >> 8) % (count - 1)) % count];
+            const uint32_t mask = RotateLeft(kHalfBar, ((r >> 16) % 16) * 2);
+            return (row & ~mask) | (other & mask);
+        }
+        default:
+            return row ^ (1u << (((r >> 8) % 16) * 2));
+    }
+}
+
+void Evolver::Generation(uint32_t* rows, uint8_t count) {
+    for (uint8_t i = 0; i < count; ++i) {
+        // Steps two or more other channels fire on, counted bit-sliced
+        uint32_t once = 0;
+        uint32_t crowded = 0;
+        for (uint8_t j = 0; j < count; ++j) {
+            if (j != i) {
+                crowded |= once & rows[j];
+                once |= rows[j];
+            }
+        }
+        uint32_t best = rows[i];
+        int16_t best_score = Fitness(best, crowded);
+        for (uint8_t c = 0; c < kCandidates; ++c) {
+            const uint32_t candidate = Mutate(rows, count, i) & (rows[i] | kGrid);
+            const int16_t score = Fitness(candidate, crowded);
+            // Now and then a tie or a slightly worse mutant wins too, so the
+            // rows keep drifting instead of settling on a local best
+            const uint32_t draw = NextRandom();
+            const int16_t slack = !(draw & 0xF00) ? kDriftSlack : !(draw & 0x3000) ? 1 : 0;
+            if (score + slack > best_score) {
+                best = candidate;
+                best_score = score;
+            }
+        }
+        rows[i] = best;
+    }
+}
+
+uint32_t Evolver::NextRandom() {
+    rng_state_ = rng_state_ * 1664525u + 1013904223u;
+    return rng_state_ >> 8;
+}
+
+}  // namespace generative
@@ -3,21 +3,67 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "generative/pattern_dict.h"
+#include "generative/pattern_index.h"
 #include "grids/pattern_generator.h"
 #include "avrlib/random.h"
 
 namespace generative {
 
+// One 24 PPQN pulse lasts 60e6 us / (24 * bpm) = 25e6 / bpm_tenths us. Time is
+// accumulated in us x bpm_tenths so the pulse grid has no rounding error.
+static const uint32_t kPulsePhase = 25000000u;
+
+// Longest elapsed time taken into account per Tick() (keeps the phase in
+// 32 bits at 300 BPM); a longer stall just delays the pattern.
+static const uint32_t kMaxElapsedUs = 1000000u;
+
+// Clock output: 4 PPQN
+static const uint8_t kDefaultClockOutPulses = 6;
+
+// Turing engine: default flip chance (in 1/256) and the register bit, counted
+// from the playing step, that sets the velocity of a hit
+static const uint8_t kDefaultTuringChance = 16;
+static const uint8_t kTuringVelocityTap = kPatternSteps / 2;
+
 GenerativeController::GenerativeController()
-    : verbose_(false),
+    : live_bank_(0),
+      verbose_(false),
+      min_hits_(4),
+      max_hits_(16),
+      min_syncopation_(0),
+      max_syncopation_(kIndexFeatureLevels - 1),
+      min_downbeat_(0),
+      max_downbeat_(kIndexFeatureLevels - 1),
+      feature_ranges_met_(true),
       bpm_tenths_(1200),
       us_per_pulse_(0),
-      us_accumulator_(0),
+      pulse_phase_(0),
       current_step_(0),
       pulse_in_step_(0),
       step_evaluated_(false),
+      clock_out_pulses_(kDefaultClockOutPulses),
+      reset_pending_(true),
+      tap_tempo_(false),
+      clock_resolution_(grids::CLOCK_RESOLUTION_24_PPQN),
+      engine_(kEngineGrids),
+      turing_chance_(kDefaultTuringChance),
+      randomize_pending_(false),
+      randomize_swap_at_(kSwapAtBar),
+      song_length_(0),
+      song_loop_(false),
+      song_active_(false),
+      song_pos_(0),
+      song_bars_left_(0),
+      song_staged_(false),
+      song_staged_pos_(0),
       rng_state_(0x12345678) {
+    automaton_rule_.kind = kAutomatonElementary;
+    automaton_rule_.code = 90;
     memset(channels_, 0, sizeof(channels_));
+    memset(shadow_, 0, sizeof(shadow_));
+    memset(snapshots_, 0, sizeof(snapshots_));
+    memset(song_, 0, sizeof(song_));
 }
 
 uint32_t GenerativeController::SimpleRand() {
@@ -29,27 +75,23 @@ void GenerativeController::Init(uint32_t seed, uint32_t bpm_tenths) {
     rng_state_ = seed;
     bpm_tenths_ = bpm_tenths;
 
-    // Initialize the Grids pattern generator
-    grids::PatternGenerator::Init();
+    // Own sequences for the Markov sampler and the evolution engine, so the
+    // Grids patterns of a seed stay the same
+    markov_.Seed(seed ^ 0x9E3779B9u);
+    evolver_.Seed(seed ^ 0x7F4A7C15u);
 
-    // Seed the avrlib RNG used by Grids internally
-    avrlib::Random::Seed(SimpleRand());
-
-    // Set default Grids settings
-    grids::PatternGeneratorSettings* settings =
-        grids::PatternGenerator::mutable_settings();
-    settings->options.drums.x = 128;
-    settings->options.drums.y = 128;
-    settings->options.drums.randomness = 0;
-    for (int i = 0; i < grids::kNumParts; ++i) {
-        settings->density[i] = 128;
-    }
+    // Grids options back to their defaults
+    tap_tempo_ = false;
+    clock_resolution_ = grids::CLOCK_RESOLUTION_24_PPQN;
+    ResetGrids();
 
     // Reset timing
-    us_accumulator_ = 0;
+    pulse_phase_ = 0;
     current_step_ = 0;
     pulse_in_step_ = 0;
     step_evaluated_ = false;
+    reset_pending_ = true;
+    song_active_ = false;
     UpdateUsPerPulse();
 
     // Randomize channel assignments
@@ -57,43 +99,198 @@ void GenerativeController::Init(uint32_t seed, uint32_t bpm_tenths) {
 }
 
 void GenerativeController::SetBpm(uint32_t bpm_tenths) {
+    // pulse_phase_ is the fraction of the current pulse already done (out of
+    // kPulsePhase) whatever the tempo, so it stays as it is: the rest of the
+    // pulse plays at the new tempo. Scaling it would keep the elapsed time
+    // instead and could push it past a whole pulse.
     bpm_tenths_ = bpm_tenths;
     UpdateUsPerPulse();
 }
 
+void GenerativeController::SetTapTempo(bool enabled) {
+    tap_tempo_ = enabled;
+    grids::PatternGenerator::set_tap_tempo(enabled);
+}
+
 void GenerativeController::UpdateUsPerPulse() {
     // 24 PPQN: us_per_pulse = 60_000_000 / (bpm * 24)
     // With bpm in tenths: us_per_pulse = 600_000_000 / (bpm_tenths * 24)
     // = 25_000_000 / bpm_tenths
     if (bpm_tenths_ > 0) {
-        us_per_pulse_ = 25000000u / bpm_tenths_;
+        us_per_pulse_ = kPulsePhase / bpm_tenths_;
     }
 }
 
-void GenerativeController::Randomize() {
+void GenerativeController::SetEngine(uint8_t engine) {
+    if (engine > kEngineTuring) {
+        engine = kEngineGrids;
+    }
+    engine_ = engine;
+}
+
+void GenerativeController::EvolveBar() {
+    ChannelState* channels = channels_[live_bank_];
+    switch (engine_) {
+        case kEngineAutomaton:
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                uint32_t row = AutomatonGeneration(channels[i].trigger_bits, automaton_rule_);
+                if (row == 0 || row == ~0u) {
+                    row = SimpleRand() & SimpleRand();  // about 8 hits
+                }
+                channels[i].trigger_bits = row;
+            }
+            break;
+        case kEngineMarkov:
+            if (!markov_.bars()) {
+                break;  // nothing learnt yet: keep playing
+            }
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                ChannelState& ch = channels[i];
+                const bool last_hit = (ch.trigger_bits >> (kPatternSteps - 1)) & 1;
+                ch.trigger_bits = markov_.Sample(i, last_hit, &ch.velocity_bits);
+                ch.velocity_step = 0;
+            }
+            break;
+        case kEngineEvolve: {
+            uint32_t rows[kNumChannels];
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                rows[i] = channels[i].trigger_bits;
+            }
+            evolver_.Generation(rows, kNumChannels);
+            for (uint8_t i = 0; i < kNumChannels; ++i) {
+                channels[i].trigger_bits = rows[i];
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void GenerativeController::TuringStep() {
+    // The register does not move: the step going round it is the rotation,
+    // so trigger_bits stays in step order for TriggerMask() and the dumps
+    const uint32_t step_bit = 1u << current_step_;
+    const uint8_t tap = (current_step_ + kTuringVelocityTap) % kPatternSteps;
     for (uint8_t i = 0; i < kNumChannels; ++i) {
-        ChannelState& ch = channels_[i];
-        ch.drum_part = SimpleRand() % 3;  // BD, SD, or HH
-        ch.x = SimpleRand() & 0xFF;
-        ch.y = SimpleRand() & 0xFF;
-        ch.density = 100 + (SimpleRand() % 100); // 100-199 range for moderate density
+        ChannelState& ch = channels_[live_bank_][i];
+        if ((SimpleRand() >> 24) < turing_chance_) {
+            ch.trigger_bits ^= step_bit;
+        }
+        if (ch.trigger_bits & step_bit) {
+            const uint32_t velocity_bit = 1u << ch.velocity_step;
+            if ((ch.trigger_bits >> tap) & 1) {
+                ch.velocity_bits |= velocity_bit;
+            } else {
+                ch.velocity_bits &= ~velocity_bit;
+            }
+        }
+    }
+}
+
+void GenerativeController::SetHitRange(uint8_t min_hits, uint8_t max_hits) {
+    if (max_hits > kIndexMaxHits) max_hits = kIndexMaxHits;
+    if (min_hits > max_hits) min_hits = max_hits;
+    min_hits_ = min_hits;
+    max_hits_ = max_hits;
+}
+
+void GenerativeController::SetSyncopationRange(uint8_t min_level, uint8_t max_level) {
+    if (max_level >= kIndexFeatureLevels) max_level = kIndexFeatureLevels - 1;
+    min_syncopation_ = min_level < max_level ? min_level : max_level;
+    max_syncopation_ = max_level;
+}
+
+void GenerativeController::SetDownbeatRange(uint8_t min_level, uint8_t max_level) {
+    if (max_level >= kIndexFeatureLevels) max_level = kIndexFeatureLevels - 1;
+    min_downbeat_ = min_level < max_level ? min_level : max_level;
+    max_downbeat_ = max_level;
+}
+
+// Indexed cells within the hit range and the syncopation and downbeat levels
+uint16_t GenerativeController::CountCells(uint8_t min_sync, uint8_t max_sync, uint8_t min_down,
+                                          uint8_t max_down) const {
+    uint16_t count = 0;
+    for (uint8_t s = min_sync; s <= max_sync; ++s) {
+        for (uint8_t d = min_down; d <= max_down; ++d) {
+            count += kPatternIndexBuckets[s][d][max_hits_ + 1] - kPatternIndexBuckets[s][d][min_hits_];
+        }
+    }
+    return count;
+}
+
+// The nth of those cells, n < CountCells()
+uint16_t GenerativeController::FindCell(uint8_t min_sync, uint8_t max_sync, uint8_t min_down,
+                                        uint8_t max_down, uint16_t n) const {
+    for (uint8_t s = min_sync; s <= max_sync; ++s) {
+        for (uint8_t d = min_down; d <= max_down; ++d) {
+            const uint16_t first = kPatternIndexBuckets[s][d][min_hits_];
+            const uint16_t count = kPatternIndexBuckets[s][d][max_hits_ + 1] - first;
+            if (n < count) {
+                return kPatternIndex[first + n].cell;
+            }
+            n -= count;
+        }
+    }
+    return kPatternIndex[0].cell;
+}
+
+void GenerativeController::RollPatterns(ChannelState* channels) {
+    // Every bucket in range is a contiguous run of the index, so a uniform
+    // draw costs at most kIndexFeatureLevels^2 offset reads
+    uint8_t min_sync = min_syncopation_, max_sync = max_syncopation_;
+    uint8_t min_down = min_downbeat_, max_down = max_downbeat_;
+    uint16_t count = CountCells(min_sync, max_sync, min_down, max_down);
+    feature_ranges_met_ = count > 0;
+    if (!count) {
+        // No pattern meets the feature ranges: the hit range alone
+        min_sync = min_down = 0;
+        max_sync = max_down = kIndexFeatureLevels - 1;
+        count = CountCells(min_sync, max_sync, min_down, max_down);
+        if (verbose_) {
+            printf("[GEN] no pattern meets the syncopation/downbeat ranges\n");
+        }
+    }
+
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        ChannelState& ch = channels[i];
+        uint16_t cell;
+        if (count) {
+            cell = FindCell(min_sync, max_sync, min_down, max_down, SimpleRand() % count);
+        } else {
+            cell = kPatternIndex[SimpleRand() % kIndexCells].cell;  // empty hit range: whole map
+        }
+        ch.drum_part = IndexCellPart(cell);  // BD, SD, or HH
+        ch.x = IndexCellX(cell);
+        ch.y = IndexCellY(cell);
+        ch.density = IndexCellDensity(cell);
+        ch.trigger_bits = PatternDictMask(cell);
 
         // Generate random 32-bit velocity pattern
         ch.velocity_bits = SimpleRand();
 
         ch.velocity_step = 0;
     }
+}
+
+void GenerativeController::Randomize() {
+    RollPatterns(channels_[live_bank_]);
+    randomize_pending_ = false;
 
     // Reset step position on randomize
     current_step_ = 0;
     pulse_in_step_ = 0;
     step_evaluated_ = false;
+    ResetGrids();
+}
+
+void GenerativeController::ResetGrids() {
     grids::PatternGenerator::Init();
 
-    // Re-seed Grids RNG
+    // Seed the avrlib RNG used by Grids internally
     avrlib::Random::Seed(SimpleRand());
 
-    // Restore Grids settings
+    // Grids settings, and the options its Init() loads the defaults of
     grids::PatternGeneratorSettings* settings =
         grids::PatternGenerator::mutable_settings();
     settings->options.drums.x = 128;
@@ -102,24 +299,159 @@ void GenerativeController::Randomize() {
     for (int i = 0; i < grids::kNumParts; ++i) {
         settings->density[i] = 128;
     }
+    grids::PatternGenerator::set_tap_tempo(tap_tempo_);
+    grids::PatternGenerator::set_clock_resolution(clock_resolution_);
+}
+
+void GenerativeController::RequestRandomize(uint8_t swap_at) {
+    // Not read by the pulse path until the flag is set
+    randomize_pending_ = false;
+    RollPatterns(shadow_);
+    randomize_swap_at_ = swap_at;
+    randomize_pending_ = true;
+}
+
+void GenerativeController::SaveSnapshot(uint8_t slot) {
+    if (slot >= kMaxSnapshots) {
+        return;
+    }
+    memcpy(snapshots_[slot], channels_[live_bank_], sizeof(snapshots_[slot]));
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        snapshots_[slot][i].velocity_step = 0;
+    }
+}
 
-    if (verbose_) {
-        PrintPatterns();
+void GenerativeController::SetSong(const SongEntry* entries, uint8_t length, bool loop) {
+    song_active_ = false;
+    song_length_ = 0;
+    song_loop_ = loop;
+    for (uint8_t i = 0; i < length && i < kMaxSongEntries; ++i) {
+        song_[i].snapshot = entries[i].snapshot < kMaxSnapshots ? entries[i].snapshot : 0;
+        song_[i].repeats = entries[i].repeats ? entries[i].repeats : 1;
+        song_length_++;
     }
 }
 
-FireEvent GenerativeController::Tick() {
-    FireEvent event;
+void GenerativeController::StartSong() {
+    if (!song_length_) {
+        return;
+    }
+    song_active_ = false;
+    StageSongEntry(0);
+    song_pos_ = 0;
+    song_bars_left_ = 0;  // switch to entry 0 at the next bar line
+    song_active_ = true;
+}
+
+void GenerativeController::StageSongEntry(uint8_t pos) {
+    memcpy(channels_[live_bank_ ^ 1], snapshots_[song_[pos].snapshot],
+           sizeof(channels_[0]));
+    song_staged_pos_ = pos;
+    song_staged_ = true;
+}
+
+void GenerativeController::SongBarLine() {
+    if (song_bars_left_) {
+        song_bars_left_--;
+        return;
+    }
+    if (!song_staged_) {
+        song_active_ = false;  // chain done, the last entry plays on
+        return;
+    }
+    live_bank_ ^= 1;
+    song_pos_ = song_staged_pos_;
+    song_bars_left_ = song_[song_pos_].repeats - 1;
+    song_staged_ = false;
+}
+
+void GenerativeController::ClearEvent(FireEvent& event) {
     event.gpio_mask = 0;
     memset(event.duration_ms, 0, sizeof(event.duration_ms));
+    event.logic_mask = 0;
+}
+
+FireEvent GenerativeController::Tick(uint32_t elapsed_us) {
+    FireEvent event;
+    ClearEvent(event);
+
+    if (elapsed_us > kMaxElapsedUs) {
+        elapsed_us = kMaxElapsedUs;
+    }
+    pulse_phase_ += elapsed_us * bpm_tenths_;
+
+    while (pulse_phase_ >= kPulsePhase) {
+        pulse_phase_ -= kPulsePhase;
+        AdvancePulse(event);
+    }
+    return event;
+}
+
+FireEvent GenerativeController::ClockPulse() {
+    FireEvent event;
+    ClearEvent(event);
+    pulse_phase_ = 0;
+    AdvancePulse(event);
+    return event;
+}
+
+void GenerativeController::Restart() {
+    // Park Grids on the last pulse of step 31, so the next pulse wraps to
+    // step 0 and evaluates it
+    grids::PatternGenerator::Reset();
+    grids::PatternGenerator::set_step(kPatternSteps - 1);
+    grids::PatternGenerator::TickClock(grids::kPulsesPerStep - 1);
+    current_step_ = kPatternSteps - 1;
+    pulse_in_step_ = grids::kPulsesPerStep - 1;
+    step_evaluated_ = true;
+    reset_pending_ = true;
+    pulse_phase_ = 0;
+}
+
+void GenerativeController::SetClockResolution(uint8_t resolution) {
+    grids::PatternGenerator::set_clock_resolution(resolution);
+    clock_resolution_ = grids::PatternGenerator::clock_resolution();
+}
+
+uint8_t GenerativeController::PulsesPerClock() const {
+    switch (clock_resolution_) {
+        case grids::CLOCK_RESOLUTION_4_PPQN:
+            return 6;
+        case grids::CLOCK_RESOLUTION_8_PPQN:
+            return 3;
+        default:
+            return 1;
+    }
+}
+
+void GenerativeController::SetClockOutPulses(uint8_t pulses) {
+    const uint8_t bar_pulses = kPatternSteps * grids::kPulsesPerStep;
+    if (pulses < 1) {
+        pulses = 1;
+    } else if (pulses > bar_pulses) {
+        pulses = bar_pulses;
+    }
+    while (bar_pulses % pulses) {
+        pulses--;
+    }
+    clock_out_pulses_ = pulses;
+}
 
-    us_accumulator_ += 1000;  // 1 ms per tick
+uint32_t GenerativeController::UsToNextPulse() const {
+    if (!bpm_tenths_) {
+        return kMaxElapsedUs;
+    }
+    return (kPulsePhase - pulse_phase_ + bpm_tenths_ - 1) / bpm_tenths_;
+}
 
-    if (us_accumulator_ < us_per_pulse_) {
-        return event;
+uint32_t GenerativeController::UsPerStep() const {
+    if (!bpm_tenths_) {
+        return kMaxElapsedUs;
     }
-    us_accumulator_ -= us_per_pulse_;
+    return kPulsePhase * grids::kPulsesPerStep / bpm_tenths_;
+}
 
+void GenerativeController::AdvancePulse(FireEvent& event) {
     // Advance the Grids engine by 1 pulse
     grids::PatternGenerator::TickClock(1);
 
@@ -135,61 +467,109 @@ FireEvent GenerativeController::Tick() {
         step_evaluated_ = false;
     }
 
+    // Clock output, phased to the bar line
+    const uint8_t bar_pulse = current_step_ * grids::kPulsesPerStep + pulse_in_step_;
+    if (bar_pulse % clock_out_pulses_ == 0) {
+        event.logic_mask |= kLogicClock;
+    }
+
     // Only evaluate triggers at the start of each step
     if (!step_evaluated_ && pulse_in_step_ == 0) {
         step_evaluated_ = true;
 
-        // Evaluate each channel against the Grids drum map
-        for (uint8_t i = 0; i < kNumChannels; ++i) {
-            ChannelState& ch = channels_[i];
+        // Song mode: bank flip on the bar line, next entry staged mid-bar
+        if (song_active_) {
+            if (current_step_ == 0) {
+                SongBarLine();
+            } else if (current_step_ == kPatternSteps / 2 && !song_staged_ &&
+                       !song_bars_left_) {
+                if (song_pos_ + 1 < song_length_) {
+                    StageSongEntry(song_pos_ + 1);
+                } else if (song_loop_) {
+                    StageSongEntry(0);
+                }
+            }
+        }
+
+        if (current_step_ == 0) {
+            event.logic_mask |= kLogicBar;
+            if (reset_pending_) {
+                event.logic_mask |= kLogicReset;
+                reset_pending_ = false;
+            }
+        }
+        // Grids' random bit, redrawn on every pulse
+        if (grids::PatternGenerator::state() & 0x80) {
+            event.logic_mask |= kLogicRandom;
+        }
+
+        // Bar-by-bar engines, unless new patterns are due now anyway
+        if (current_step_ == 0 && !randomize_pending_) {
+            EvolveBar();
+        }
+
+        // Requested patterns replace the playing bank
+        if (randomize_pending_ &&
+            (randomize_swap_at_ == kSwapAtStep || current_step_ == 0)) {
+            memcpy(channels_[live_bank_], shadow_, sizeof(shadow_));
+            randomize_pending_ = false;
+        }
 
-            uint8_t level = grids::PatternGenerator::GetDrumMapLevel(
-                current_step_, ch.drum_part, ch.x, ch.y);
+        if (engine_ == kEngineTuring) {
+            TuringStep();
+        }
 
-            uint8_t threshold = 255 - ch.density;
-            if (level > threshold) {
+        // Evaluate each channel against its pre-rendered trigger pattern
+        for (uint8_t i = 0; i < kNumChannels; ++i) {
+            ChannelState& ch = channels_[live_bank_][i];
+
+            if ((ch.trigger_bits >> current_step_) & 1) {
                 // Trigger! Check velocity pattern
                 bool high_vel = (ch.velocity_bits >> ch.velocity_step) & 1;
                 uint8_t duration = high_vel ? 100 : 1;
 
                 event.gpio_mask |= (1 << i);
-                event.duration_ms[i] = duration;
+                if (high_vel) {
+                    event.logic_mask |= kLogicAccent;
+                }
+                if (duration > event.duration_ms[i]) {
+                    event.duration_ms[i] = duration;
+                }
 
                 // Advance velocity step (only on trigger)
                 ch.velocity_step = (ch.velocity_step + 1) % kPatternSteps;
             }
         }
-
-        // Single compact line per step with all triggers
-        if (verbose_ && event.gpio_mask) {
-            printf("S%02u:", current_step_);
-            for (uint8_t i = 0; i < kNumChannels; ++i) {
-                if (event.gpio_mask & (1 << i)) {
-                    printf(" %u%c", i, event.duration_ms[i] > 1 ? 'H' : 'L');
-                }
-            }
-            printf("\n");
-        }
     }
 
     grids::PatternGenerator::IncrementPulseCounter();
+}
 
-    return event;
+void GenerativeController::LogEvent(const FireEvent& event) const {
+    // Single compact line per step with all triggers
+    if (!verbose_ || !event.gpio_mask) {
+        return;
+    }
+    printf("S%02u:", current_step_);
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+        if (event.gpio_mask & (1 << i)) {
+            printf(" %u%c", i, event.duration_ms[i] > 1 ? 'H' : 'L');
+        }
+    }
+    printf("\n");
 }
 
 void GenerativeController::PrintChannel(uint8_t ch) const {
-    const ChannelState& c = channels_[ch];
+    const ChannelState& c = channels_[live_bank_][ch];
     const char* part_names[] = {"BD", "SD", "HH"};
 
     // Compute trigger pattern for display
     printf("  CH%u %s x=%3u y=%3u d=%3u T:", ch, part_names[c.drum_part],
            c.x, c.y, c.density);
 
+    const uint32_t triggers = TriggerMask(ch);
     for (uint8_t step = 0; step < kPatternSteps; ++step) {
-        uint8_t level = grids::PatternGenerator::GetDrumMapLevel(
-            step, c.drum_part, c.x, c.y);
-        uint8_t threshold = 255 - c.density;
-        printf("%c", level > threshold ? 'x' : '-');
+        printf("%c", (triggers >> step) & 1 ? 'x' : '-');
     }
 
     printf(" V:");
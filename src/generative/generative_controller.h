@@ -3,10 +3,17 @@
 
 #include <stdint.h>
 
+#include "generative/automaton.h"
+#include "generative/evolve.h"
+#include "generative/markov.h"
+#include "generative/pattern_index.h"
+
 namespace generative {
 
 static const uint8_t kNumChannels = 8;
 static const uint8_t kPatternSteps = 32;
+static const uint8_t kMaxSnapshots = 8;
+static const uint8_t kMaxSongEntries = 16;
 
 // Per-channel state for trigger + velocity dual patterns
 struct ChannelState {
@@ -14,14 +21,49 @@ struct ChannelState {
     uint8_t x;               // Grids X position (0-255)
     uint8_t y;               // Grids Y position (0-255)
     uint8_t density;         // Trigger density threshold (0-255)
+    uint32_t trigger_bits;   // 32-step trigger pattern at x/y/density (bit=1 -> fire)
     uint32_t velocity_bits;  // 32-step binary velocity pattern (bit=1 -> high vel)
     uint8_t velocity_step;   // current position in velocity pattern (advances on trigger)
 };
 
+// Song mode: play snapshot `snapshot` for `repeats` bars (1-255)
+struct SongEntry {
+    uint8_t snapshot;
+    uint8_t repeats;
+};
+
+// Logic outputs for other gear, as FireEvent::logic_mask bits
+enum LogicOutput {
+    kLogicClock = 1 << 0,    // every SetClockOutPulses() pulses, from the bar line
+    kLogicReset = 1 << 1,    // first bar line after Init() or Restart()
+    kLogicBar = 1 << 2,      // every bar line (step 0)
+    kLogicAccent = 1 << 3,   // a step with at least one high velocity hit
+    kLogicRandom = 1 << 4    // a step whose Grids random bit is set
+};
+static const uint8_t kNumLogicOutputs = 5;
+
+// What rewrites the channel patterns as the music plays. Patterns always
+// play the same way (trigger bits, velocity bits, FireEvent); engines other
+// than Grids start from the patterns playing when they are selected.
+enum Engine {
+    kEngineGrids,            // fixed Grids patterns, changed by Randomize()
+    kEngineAutomaton,        // each row evolves by SetAutomatonRule() every bar
+    kEngineMarkov,           // each bar drawn from markov(), once it has learnt
+    kEngineEvolve,           // one evolver() generation of the rows every bar
+    kEngineTuring            // each step's bit may flip, SetTuringChance()
+};
+
+// Where RequestRandomize() swaps the new patterns in
+enum RandomizeSwap {
+    kSwapAtBar,              // next bar line (step 0)
+    kSwapAtStep              // next step
+};
+
 // Returned by Update() to tell main.cpp which solenoids to fire
 struct FireEvent {
     uint8_t gpio_mask;       // bitmask: bit N = GPIO (N + GPIO_BASE) should fire
     uint8_t duration_ms[kNumChannels]; // pulse duration per channel (0 = no fire)
+    uint8_t logic_mask;      // LogicOutput bits due with this event
 };
 
 class GenerativeController {
@@ -31,49 +73,206 @@ public:
     // Initialize: seed RNG, randomize patterns, set tempo
     void Init(uint32_t seed, uint32_t bpm_tenths);
 
-    // Set tempo in tenths of BPM (e.g. 1200 = 120.0 BPM)
+    // Set tempo in tenths of BPM (e.g. 1200 = 120.0 BPM). The pulse in
+    // progress finishes at the new tempo from the point it has reached.
     void SetBpm(uint32_t bpm_tenths);
+    uint32_t bpm_tenths() const { return bpm_tenths_; }
+
+    // Grids tap tempo option: the tempo is set by tapping the User Key.
+    // Reset to off by Init(), kept by Randomize().
+    void SetTapTempo(bool enabled);
+    bool tap_tempo() const { return tap_tempo_; }
 
-    // Call every 1 ms from main loop. Returns fire events when triggers occur.
-    FireEvent Tick();
+    // Call from the main loop with the time elapsed since the previous call
+    // (about 1000 us). Returns fire events when triggers occur. Pulses that
+    // fell due during elapsed_us are all processed; their events are merged.
+    FireEvent Tick(uint32_t elapsed_us);
 
-    // Re-roll all x/y positions, drum parts, and velocity patterns
+    // External clock: advance exactly one pulse now. The time-based phase
+    // restarts, so Tick() can take over again from this pulse.
+    FireEvent ClockPulse();
+
+    // External reset: the next pulse plays step 0 (the bar line)
+    void Restart();
+
+    // Grids clock input resolution (grids::ClockResolution: 4, 8 or 24 PPQN).
+    // Reset to 24 PPQN by Init(), kept by Randomize().
+    void SetClockResolution(uint8_t resolution);
+    // 24 PPQN pulses per clock input edge at that resolution
+    uint8_t PulsesPerClock() const;
+
+    // Clock output period in 24 PPQN pulses (default 6: 4 PPQN, one per
+    // 1/16 note). Values that do not divide a bar (96) are rounded down to one
+    // that does.
+    void SetClockOutPulses(uint8_t pulses);
+    uint8_t clock_out_pulses() const { return clock_out_pulses_; }
+
+    // Microseconds until the next 24 PPQN pulse falls due (rounded up)
+    uint32_t UsToNextPulse() const;
+
+    // Length of one step (3 pulses) at the current tempo, rounded down
+    uint32_t UsPerStep() const;
+    uint32_t UsPerPulse() const { return us_per_pulse_; }
+
+    // Print a compact line for a step's triggers (verbose mode only). Kept out
+    // of Tick() so the UART cost stays off the pulse path.
+    void LogEvent(const FireEvent& event) const;
+
+    // Re-roll all x/y positions, drum parts, and velocity patterns. Each
+    // channel is drawn from the pattern index among patterns whose hit count
+    // lies in the configured range. Takes effect at once and restarts the
+    // pattern from step 0.
     void Randomize();
 
+    // Randomize() for a running pattern: the new patterns are rolled into a
+    // shadow bank now and swapped in at the next bar line or step (RandomizeSwap),
+    // keeping the step position and the clock. A second request before the
+    // swap replaces the first.
+    void RequestRandomize(uint8_t swap_at);
+    bool randomize_pending() const { return randomize_pending_; }
+
+    // Pattern engine (Engine), from the next bar line (the Turing engine from
+    // the next step). Kept by Init().
+    void SetEngine(uint8_t engine);
+    uint8_t engine() const { return engine_; }
+
+    // Automaton engine rule (default elementary rule 90). Rows that die out
+    // or fill up are reseeded at random.
+    void SetAutomatonRule(AutomatonRule rule) { automaton_rule_ = rule; }
+    AutomatonRule automaton_rule() const { return automaton_rule_; }
+
+    // Rhythm model of the Markov engine; train it with Observe()/Flush()
+    MarkovModel& markov() { return markov_; }
+
+    // Evolution engine; its targets are kept by Init()
+    Evolver& evolver() { return evolver_; }
+
+    // Turing engine: each channel's trigger pattern is a looping shift
+    // register, read at the playing step. As a step comes round its bit flips
+    // with a chance of chance/256 (0 = locked loop, 128 = random, default 16),
+    // and a hit is high velocity when the bit half a bar away is set. Kept by
+    // Init().
+    void SetTuringChance(uint8_t chance) { turing_chance_ = chance; }
+    uint8_t turing_chance() const { return turing_chance_; }
+
+    // Hits per 32-step pattern allowed by Randomize() (default 4-16)
+    void SetHitRange(uint8_t min_hits, uint8_t max_hits);
+
+    // Further limits on the patterns Randomize() draws, by the syncopation and
+    // downbeat levels of the pattern index (0-3, see pattern_index.h; default
+    // 0-3, no limit). If no pattern in the hit range meets them, the draw
+    // ignores them and feature_ranges_met() returns false until a draw meets
+    // them again.
+    void SetSyncopationRange(uint8_t min_level, uint8_t max_level);
+    void SetDownbeatRange(uint8_t min_level, uint8_t max_level);
+    bool feature_ranges_met() const { return feature_ranges_met_; }
+
+    // Store the current channel patterns in snapshot slot (0-7)
+    void SaveSnapshot(uint8_t slot);
+
+    // Song mode: an ordered chain of snapshots with repeat counts. Switches
+    // happen on bar lines (step 0) only; the next entry is copied into a
+    // standby bank half a bar before, so the downbeat just flips banks.
+    // StartSong() begins with entries[0] at the next bar line. Without loop,
+    // the last entry keeps playing once the chain is done.
+    void SetSong(const SongEntry* entries, uint8_t length, bool loop);
+    void StartSong();
+    void StopSong() { song_active_ = false; }
+    bool song_active() const { return song_active_; }
+    uint8_t song_position() const { return song_pos_; }
+
     // Enable/disable verbose UART logging
     void SetVerbose(bool v) { verbose_ = v; }
 
     // Get current step (0-31) for display
     uint8_t step() const { return current_step_; }
 
+    // True right after the Tick() whose last pulse started a step
+    bool at_step_start() const { return pulse_in_step_ == 0; }
+
     // Get channel state for display
-    const ChannelState& channel(uint8_t ch) const { return channels_[ch]; }
+    const ChannelState& channel(uint8_t ch) const { return channels_[live_bank_][ch]; }
+
+    // 32-step trigger pattern of a channel (bit N = step N fires)
+    uint32_t TriggerMask(uint8_t ch) const { return channels_[live_bank_][ch].trigger_bits; }
 
     // Print all channel patterns to UART
     void PrintPatterns() const;
 
+    // Print a single channel's trigger/velocity patterns, to spread a dump
+    // over several main loop passes
+    void PrintChannel(uint8_t ch) const;
+
 private:
-    ChannelState channels_[kNumChannels];
+    // Playing bank and, in song mode, the standby bank of the next entry
+    ChannelState channels_[2][kNumChannels];
+    uint8_t live_bank_;
     bool verbose_;
+    uint8_t min_hits_;
+    uint8_t max_hits_;
+    uint8_t min_syncopation_;     // levels, see pattern_index.h
+    uint8_t max_syncopation_;
+    uint8_t min_downbeat_;
+    uint8_t max_downbeat_;
+    bool feature_ranges_met_;
 
     // Timing
     uint32_t bpm_tenths_;         // tempo in 0.1 BPM units
-    uint32_t us_per_pulse_;       // microseconds per PPQN pulse
-    uint32_t us_accumulator_;     // accumulated microseconds (incremented by 1000 each Tick)
+    uint32_t us_per_pulse_;       // microseconds per PPQN pulse (rounded down, for display)
+    uint32_t pulse_phase_;        // progress to the next pulse, in us x bpm_tenths
 
     // Grids sequencer state
     uint8_t current_step_;        // 0..31
     uint8_t pulse_in_step_;       // 0..2 (kPulsesPerStep = 3)
     bool step_evaluated_;         // has current step been evaluated yet?
 
+    // Logic outputs
+    uint8_t clock_out_pulses_;
+    bool reset_pending_;          // next bar line raises kLogicReset
+
+    // Grids options, applied again whenever Grids is re-initialized
+    bool tap_tempo_;
+    uint8_t clock_resolution_;    // grids::ClockResolution
+
+    // Pattern engine
+    uint8_t engine_;
+    AutomatonRule automaton_rule_;
+    MarkovModel markov_;
+    Evolver evolver_;
+    uint8_t turing_chance_;
+
+    // RequestRandomize() patterns waiting for their swap
+    ChannelState shadow_[kNumChannels];
+    bool randomize_pending_;
+    uint8_t randomize_swap_at_;
+
+    // Song mode
+    ChannelState snapshots_[kMaxSnapshots][kNumChannels];
+    SongEntry song_[kMaxSongEntries];
+    uint8_t song_length_;
+    bool song_loop_;
+    bool song_active_;
+    uint8_t song_pos_;            // entry playing
+    uint8_t song_bars_left_;      // bars of it after the current one
+    bool song_staged_;            // standby bank holds entry song_staged_pos_
+    uint8_t song_staged_pos_;
+
     // Internal helpers
     void UpdateUsPerPulse();
-    void EvaluateStep();
+    void ResetGrids();
+    void AdvancePulse(FireEvent& event);
+    static void ClearEvent(FireEvent& event);
+    void RollPatterns(ChannelState* channels);
+    uint16_t CountCells(uint8_t min_sync, uint8_t max_sync, uint8_t min_down,
+                        uint8_t max_down) const;
+    uint16_t FindCell(uint8_t min_sync, uint8_t max_sync, uint8_t min_down,
+                      uint8_t max_down, uint16_t n) const;
+    void EvolveBar();
+    void TuringStep();
+    void StageSongEntry(uint8_t pos);
+    void SongBarLine();
     uint32_t SimpleRand();
     uint32_t rng_state_;
-
-    // Print a single channel's trigger/velocity patterns
-    void PrintChannel(uint8_t ch) const;
 };
 
 }  // namespace generative
@@ -0,0 +1,138 @@
+#include "generative/markov.h"
+
+#include <string.h>
+
+namespace generative {
+
+namespace {
+
+// Estimate (8 * hits + 1) / (8 * total + 2): close to the counted ratio once
+// a few bars are in, never quite 0 or 1, and 1/2 with no data
+uint16_t Chance(uint16_t hits, uint16_t total) {
+    return static_cast<uint16_t>(((8u * hits + 1u) << 16) / (8u * total + 2u));
+}
+
+const uint16_t kEvenChance = 0x8000;  // Chance(0, 0)
+
+}  // namespace
+
+MarkovModel::MarkovModel() : rng_state_(1) {
+    Clear();
+}
+
+void MarkovModel::Clear() {
+    memset(hit_count_, 0, sizeof(hit_count_));
+    memset(step_count_, 0, sizeof(step_count_));
+    memset(high_count_, 0, sizeof(high_count_));
+    memset(fired_count_, 0, sizeof(fired_count_));
+    for (uint8_t ch = 0; ch < kChannels; ++ch) {
+        for (uint8_t s = 0; s < kSteps; ++s) {
+            hit_chance_[ch][s][0] = kEvenChance;
+            hit_chance_[ch][s][1] = kEvenChance;
+            high_chance_[ch][s] = kEvenChance;
+        }
+    }
+    bar_ = 0;
+    bar_open_ = false;
+    memset(bar_hits_, 0, sizeof(bar_hits_));
+    memset(bar_high_, 0, sizeof(bar_high_));
+    bars_ = 0;
+}
+
+void MarkovModel::Observe(uint8_t ch, uint32_t step, bool high) {
+    if (ch >= kChannels) {
+        return;
+    }
+    const uint32_t bar = step / kSteps;
+    if (bar_open_ && bar != bar_) {
+        if (bar < bar_) {
+            return;  // out of order
+        }
+        LearnBar();
+    }
+    bar_ = bar;
+    bar_open_ = true;
+    const uint32_t bit = 1u << (step % kSteps);
+    bar_hits_[ch] |= bit;
+    if (high) {
+        bar_high_[ch] |= bit;
+    }
+}
+
+void MarkovModel::Flush() {
+    if (bar_open_) {
+        LearnBar();
+    }
+}
+
+void MarkovModel::LearnBar() {
+    for (uint8_t ch = 0; ch < kChannels; ++ch) {
+        const uint32_t hits = bar_hits_[ch];
+        const uint32_t prev = (hits << 1) | (hits >> 31);  // bit N: step N - 1 fired
+        for (uint8_t s = 0; s < kSteps; ++s) {
+            uint8_t* hit_count = hit_count_[ch][s];
+            uint8_t* step_count = step_count_[ch][s];
+            const uint8_t p = (prev >> s) & 1;
+            if (step_count[p] == 255) {
+                for (uint8_t i = 0; i < 2; ++i) {
+                    step_count[i] >>= 1;
+                    hit_count[i] >>= 1;
+                }
+            }
+            step_count[p]++;
+            if ((hits >> s) & 1) {
+                hit_count[p]++;
+                if (fired_count_[ch][s] == 255) {
+                    fired_count_[ch][s] >>= 1;
+                    high_count_[ch][s] >>= 1;
+                }
+                fired_count_[ch][s]++;
+                if ((bar_high_[ch] >> s) & 1) {
+                    high_count_[ch][s]++;
+                }
+            }
+
+            // A context never seen falls back on the step alone
+            const uint16_t either =
+                Chance(hit_count[0] + hit_count[1], step_count[0] + step_count[1]);
+            for (uint8_t i = 0; i < 2; ++i) {
+                hit_chance_[ch][s][i] = step_count[i] ? Chance(hit_count[i], step_count[i]) : either;
+            }
+            high_chance_[ch][s] = Chance(high_count_[ch][s], fired_count_[ch][s]);
+        }
+        bar_hits_[ch] = 0;
+        bar_high_[ch] = 0;
+    }
+    bar_open_ = false;
+    if (bars_ < 0xFFFF) {
+        bars_++;
+    }
+}
+
+uint16_t MarkovModel::NextRandom() {
+    rng_state_ = rng_state_ * 1664525u + 1013904223u;
+    return static_cast<uint16_t>(rng_state_ >> 16);
+}
+
+uint32_t MarkovModel::Sample(uint8_t ch, bool last_hit, uint32_t* velocity) {
+    uint32_t hits = 0;
+    uint32_t high = 0;
+    uint8_t count = 0;
+    if (ch >= kChannels) {
+        *velocity = 0;
+        return 0;
+    }
+    uint8_t prev = last_hit ? 1 : 0;
+    for (uint8_t s = 0; s < kSteps; ++s) {
+        prev = NextRandom() < hit_chance_[ch][s][prev];
+        if (prev) {
+            hits |= 1u << s;
+            high |= static_cast<uint32_t>(NextRandom() < high_chance_[ch][s]) << count;
+            count++;
+        }
+    }
+    *velocity = high;
+    return hits;
+}
+
+}  // namespace generative
@@ -0,0 +1,71 @@
+#ifndef GENERATIVE_MARKOV_H_
+#define GENERATIVE_MARKOV_H_
+
+#include <stdint.h>
+
+namespace generative {
+
+// Markov-chain rhythm model learnt from MIDI performances.
+//
+// For every channel and step of the 32-step bar it keeps the chance that the
+// step fires given whether the step before it fired (the bar is a ring, step
+// 0 follows step 31), and the chance that a hit is high velocity. Training
+// counts whole bars; the chances are kept as 16-bit fixed point, so sampling
+// a bar costs one random draw and one compare per step.
+class MarkovModel {
+public:
+    static const uint8_t kChannels = 8;
+    static const uint8_t kSteps = 32;
+
+    MarkovModel();
+
+    // Forget everything learnt
+    void Clear();
+
+    void Seed(uint32_t seed) { rng_state_ = seed; }
+
+    // A hit on channel ch (0-7) at `step`, counted in 1/32 notes from the
+    // first bar line of a recording; bar = step / 32. Notes come in time
+    // order. A bar is learnt for all channels when a later bar starts or at
+    // Flush(); bars without hits are pauses and are skipped.
+    void Observe(uint8_t ch, uint32_t step, bool high);
+
+    // End of a recording: learn the bar in progress
+    void Flush();
+
+    // Bars learnt since Clear() (counts stop at 65535)
+    uint16_t bars() const { return bars_; }
+
+    // Draw a bar for channel ch. last_hit is whether step 31 of the bar
+    // before fired. Bit N of *velocity is the velocity of the Nth hit
+    // (1 = high), as ChannelState::velocity_bits from velocity_step 0.
+    uint32_t Sample(uint8_t ch, bool last_hit, uint32_t* velocity);
+
+private:
+    void LearnBar();
+    uint16_t NextRandom();
+
+    // Counts, halved together once a total reaches 255 so the model follows
+    // the recent playing
+    uint8_t hit_count_[kChannels][kSteps][2];    // [prev fired]
+    uint8_t step_count_[kChannels][kSteps][2];
+    uint8_t high_count_[kChannels][kSteps];
+    uint8_t fired_count_[kChannels][kSteps];
+
+    // Chances in 1/65536
+    uint16_t hit_chance_[kChannels][kSteps][2];
+    uint16_t high_chance_[kChannels][kSteps];
+
+    // Bar being recorded
+    uint32_t bar_;
+    bool bar_open_;
+    uint32_t bar_hits_[kChannels];
+    uint32_t bar_high_[kChannels];
+
+    uint16_t bars_;
+    uint32_t rng_state_;
+};
+
+}  // namespace generative
+
+#endif  // GENERATIVE_MARKOV_H_
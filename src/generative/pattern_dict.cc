@@ -0,0 +1,739 @@
+// Deduplicated trigger mask dictionary of the pattern index grid.
+//
+// Automatically generated with:
+// make pattern-dict
+//
+// 6144 cells -> 1231 distinct masks, 17212 bytes of flash
+// (24576 bytes as one mask per cell).
+
+#include "generative/pattern_dict.h"
+
+namespace generative {
+
+const uint16_t kPatternDictSize = 1231;
+
+const uint32_t kPatternDict[] = {
+  0x00001000, 0x00041000, 0x10041000, 0x10041001, 0x10045041, 0x10055041,
+  0x11055041, 0x10001001, 0x10051001, 0x51055141, 0x00000000, 0x00001001,
+  0x10011001, 0x51055041, 0x00000001, 0x00011001, 0x50011001, 0x51051001,
+  0x00010001, 0x51011001, 0x51011101, 0x55555551, 0x55511101, 0x55555555,
+  0x01010001, 0x11010101, 0x55555501, 0x51010101, 0x55510101, 0x55555101,
+  0x01010101, 0x55010101, 0x55554501, 0x55555511, 0xf5555555, 0x15410101,
+  0x55450511, 0x55554511, 0x05450511, 0x15450511, 0x75554511, 0x00000111,
+  0x01410511, 0x01450511, 0x15454511, 0xf5555551, 0x00000101, 0x00010511,
+  0x75754531, 0xfd756531, 0x00010101, 0x01610531, 0x25650531, 0x3d654531,
+  0x00200121, 0x00210121, 0x29210121, 0x2d650531, 0x00000020, 0x00200120,
+  0x08210121, 0x28210121, 0x3d656531, 0x10155041, 0x10155051, 0x51155151,
+  0x51155051, 0x55155151, 0x51151101, 0x51111101, 0x11011001, 0x55111101,
+  0x11010001, 0x51110101, 0x15110101, 0x55550101, 0x55550511, 0x01010501,
+  0x11450511, 0x15550511, 0x01010401, 0x01010511, 0x35554531, 0xfd756571,
+  0x11650531, 0x3d654571, 0x00010121, 0x01210121, 0x39654571, 0x09210121,
+  0x29214161, 0x79656571, 0x10151001, 0x10151011, 0x50155051, 0x10111001,
+  0x51151111, 0x11111001, 0x51111111, 0x55111111, 0x55555111, 0x11110001,
+  0x15111101, 0x11550511, 0x11010401, 0x55554551, 0x11050411, 0x15554551,
+  0x11050501, 0x11450541, 0x11654571, 0x01010141, 0x01614161, 0x39654561,
+  0x00210161, 0x01214161, 0x39614161, 0x00101001, 0x00101011, 0x50151011,
+  0x00111001, 0x10111011, 0x11111111, 0x11111101, 0x00110001, 0x75555555,
+  0x11551511, 0x11150401, 0x11550551, 0x11050401, 0x11150441, 0x11554551,
+  0x11010141, 0x11454541, 0x00010141, 0x11414141, 0x11454561, 0x00000141,
+  0x01014141, 0x01414141, 0x11614161, 0x79656561, 0x00100001, 0x00111011,
+  0x50151111, 0x51151151, 0x51115111, 0x11151451, 0x11110401, 0x11151441,
+  0x55551551, 0x11010041, 0x11050441, 0x11550541, 0x01010041, 0x11554541,
+  0x00010041, 0x11454141, 0x00000041, 0x00014141, 0x51555141, 0x51151051,
+  0x11115101, 0x51155111, 0x01111001, 0x10111101, 0x11115111, 0x10111111,
+  0x10111511, 0x11111551, 0x11110411, 0x11151551, 0x11010411, 0x51150551,
+  0x11010541, 0x11150551, 0x11014141, 0x51555151, 0x10151051, 0x11151051,
+  0x11111051, 0x01115101, 0x51115101, 0x51155551, 0x01014101, 0x51555541,
+  0x51515551, 0x00111101, 0x15515551, 0x15511551, 0x55111551, 0x01010011,
+  0x11010111, 0x55150551, 0x01010111, 0x51110151, 0x11415151, 0x11415141,
+  0x00101041, 0x11111041, 0x11151041, 0x01111041, 0x51155141, 0x01115001,
+  0x01115141, 0x51155541, 0x01114101, 0x41115141, 0x00014101, 0x41114101,
+  0x41115501, 0x41555541, 0x00115101, 0x01115501, 0x10115501, 0x55515551,
+  0x00111111, 0x01111111, 0x55511551, 0x41111111, 0x55111511, 0x41010111,
+  0x45111111, 0x11011101, 0x01101041, 0x01115041, 0x00014001, 0x41515541,
+  0x41514541, 0x51555551, 0x51515541, 0x10515541, 0x14511511, 0x15111111,
+  0x00010111, 0x45010111, 0x55515555, 0x55115511, 0x51115511, 0x10101041,
+  0x15111041, 0x15511041, 0x00111041, 0x55555051, 0x51515041, 0x55555151,
+  0x40514041, 0x51515151, 0x00114001, 0x40514141, 0x41514151, 0x00514141,
+  0x00511001, 0x10555151, 0x10551001, 0x14551141, 0x54555551, 0x14551101,
+  0x15555555, 0x00011101, 0x15551111, 0x55011111, 0x55551111, 0x51010111,
+  0x11110111, 0x11110101, 0x14101041, 0x14111041, 0x10111041, 0x55515051,
+  0x10511051, 0x50511051, 0x55515151, 0x00500051, 0x50515051, 0x00500001,
+  0x50514051, 0x00510001, 0x10510051, 0x50555051, 0x00410001, 0x10551041,
+  0x14551051, 0x54555151, 0x00450001, 0x14451001, 0x14551041, 0x14555155,
+  0x00050001, 0x14551155, 0x10051101, 0x15451111, 0x55551151, 0x51011111,
+  0x51110111, 0x11111511, 0x14101001, 0x14511041, 0x14501041, 0x14511051,
+  0x55511051, 0x10501051, 0x54511051, 0x10500051, 0x50501051, 0x54515051,
+  0x00500011, 0x50500051, 0x50505051, 0x00400001, 0x00400011, 0x50551051,
+  0x54555051, 0x10410001, 0x10451051, 0x14451041, 0x14551055, 0x04450001,
+  0x14451155, 0x10050001, 0x14450001, 0x15451101, 0x55451155, 0x10010101,
+  0x55451111, 0x55511111, 0x51111511, 0x01110101, 0x00110101, 0x04101001,
+  0x14111001, 0x55511041, 0xd5d55555, 0x14501051, 0x00100011, 0x00000011,
+  0x10500011, 0x54555055, 0x14551045, 0x04050001, 0x14451005, 0x14050001,
+  0x14451101, 0x55555155, 0x10010001, 0x55151111, 0x55155511, 0x11115511,
+  0x04110001, 0x04111001, 0x54511041, 0xd4511041, 0xd5511051, 0x10100011,
+  0x14511011, 0x10511011, 0x54555555, 0x04010001, 0x04550005, 0x14551015,
+  0x14555555, 0x04150005, 0x14551405, 0x14150001, 0x14155115, 0x55555515,
+  0x10150001, 0x15154111, 0x11114111, 0x51154111, 0x51155511, 0x11114101,
+  0x44110001, 0xc4511001, 0x54511011, 0xd4511051, 0x14110011, 0x14111011,
+  0x10101011, 0x04111015, 0x14111415, 0x04110005, 0x04155515, 0x14555515,
+  0x04114405, 0x04155505, 0x54555515, 0x04154005, 0x14154515, 0x00104001,
+  0x10154001, 0x15154411, 0x55155515, 0x10104001, 0x11144011, 0x11154411,
+  0x55154511, 0x00004001, 0x11154511, 0x11104001, 0x11154111, 0x01004101,
+  0x01000101, 0x11014101, 0xc4110001, 0xc4510001, 0xc4d10001, 0xd4d11041,
+  0xd4511011, 0xd5d11551, 0x54111011, 0xd5511011, 0x15111011, 0x15111015,
+  0x15115515, 0x14115515, 0x00110005, 0x04115515, 0x44115515, 0x44155515,
+  0x04154415, 0x10144411, 0x14154415, 0x15154515, 0x00144001, 0x10144001,
+  0x11144411, 0x15144411, 0x15154511, 0x11104101, 0x01004001, 0x11004101,
+  0x00010000, 0x00011000, 0x00011400, 0x00011510, 0x00011554, 0x00451554,
+  0x10455554, 0x55555554, 0x00011100, 0x00011500, 0x00011514, 0x11451554,
+  0x11455554, 0x00001100, 0x01001100, 0x11011100, 0x11011514, 0xd1c51554,
+  0x00000100, 0x11001100, 0x11801100, 0xd1811504, 0x01000100, 0xd1801100,
+  0xd1801105, 0x10000100, 0x10001100, 0x57c49180, 0x10000000, 0x10001000,
+  0x11401100, 0x17c01100, 0x11c01000, 0x11c01100, 0x57c01100, 0x10401000,
+  0x10c01000, 0x17c01000, 0x57c01000, 0x57c03001, 0x7fedb1a1, 0x01401000,
+  0x11c03001, 0x11e03001, 0x77e13121, 0x01002001, 0x21212001, 0x21e13021,
+  0x79e13121, 0x01202001, 0x21212021, 0x21212121, 0x29e12121, 0x7fe93121,
+  0x10011550, 0x11555554, 0x11555555, 0x11011510, 0x11011554, 0x51555555,
+  0x51d55555, 0xd1911114, 0x51801100, 0xd1901100, 0xd5d55115, 0x51001100,
+  0xd5d55155, 0xd1d45155, 0x51401100, 0x57d4d5d0, 0x51c01100, 0x57d4d5d4,
+  0x57d01110, 0x57d495d4, 0x51c01000, 0x57d01010, 0x57d49594, 0x57d01011,
+  0x7ff5f5b5, 0x11001000, 0x51c03001, 0x77f13131, 0x7ffdf5b5, 0x01000001,
+  0x11003001, 0x71613001, 0x71f17131, 0x7ffdf5f5, 0x00002001, 0x61213121,
+  0x79f17121, 0x7df97171, 0x11000100, 0x11111540, 0x11115551, 0x11101100,
+  0x11101110, 0x51515555, 0x51905110, 0x51101100, 0x51901110, 0x51501100,
+  0x50001100, 0x51501110, 0x50001000, 0x51d01110, 0x50001010, 0x50d01010,
+  0x57d41410, 0x51d01010, 0x57d01410, 0x51101010, 0x51f07111, 0x51107011,
+  0x51003001, 0x51307101, 0x71317131, 0x11100100, 0x11100141, 0x11104141,
+  0x11105141, 0x11105110, 0x51505151, 0x51101110, 0x51105110, 0x51505110,
+  0x57d45554, 0x50101010, 0x50101110, 0x51541510, 0x10001010, 0x10101010,
+  0x50101410, 0x51541410, 0x50105010, 0x51105510, 0x7ff5f5f5, 0x51105111,
+  0x50005000, 0x50105000, 0x51307111, 0x11100101, 0x51104141, 0x55554555,
+  0x51105151, 0x01000000, 0x51545110, 0x50000100, 0x55545554, 0x51501510,
+  0x00001010, 0x50141510, 0x50145410, 0x55557554, 0x50105510, 0x50105110,
+  0x5555757c, 0x5551757c, 0x51144145, 0x51144151, 0x55145151, 0x55145111,
+  0x55101110, 0x55145110, 0x55101100, 0x55505110, 0x55501100, 0x55501110,
+  0x55501150, 0x55501510, 0x55101510, 0x50101510, 0x55141510, 0x54145510,
+  0x54505510, 0x54515110, 0x10005000, 0x50515110, 0x11040100, 0x11144101,
+  0x11544145, 0x55144145, 0x11140100, 0x55145101, 0x55140100, 0x55155111,
+  0x15000100, 0x55001100, 0x55541110, 0x15001100, 0x15101100, 0x14001110,
+  0x54101510, 0x10001110, 0x55105510, 0x54505110, 0x55515510, 0x50405100,
+  0x54415110, 0x54517110, 0x10405000, 0x50415100, 0x50415110, 0x11044104,
+  0x11444105, 0x11040104, 0x55044105, 0x15040100, 0x55154105, 0x55040100,
+  0x55150101, 0x55000100, 0x55100100, 0x15100100, 0x15101110, 0x55501550,
+  0x04001100, 0x14001100, 0x15001500, 0x14001500, 0x55405510, 0x14405100,
+  0x54415100, 0x55417510, 0x10405100, 0x14415100, 0x54417110, 0x10400000,
+  0x10414000, 0x10415100, 0x54417114, 0x01040100, 0x55054105, 0x55154101,
+  0x05000100, 0x15101150, 0x55501151, 0x55005500, 0x15005500, 0x55415500,
+  0x5555757d, 0x15415100, 0x55417514, 0x10400100, 0x00400000, 0x10414100,
+  0x54417100, 0x11004100, 0x11144104, 0x55144104, 0x11044100, 0x55044104,
+  0x55544105, 0x55044100, 0x55554105, 0x55554155, 0x55100150, 0x55000150,
+  0x55101151, 0x55515155, 0x15001150, 0x55511155, 0x55001150, 0x55141155,
+  0x05001100, 0x55001104, 0x55145554, 0x15001104, 0x55045514, 0x15045104,
+  0x55455504, 0x15005100, 0x55455100, 0x55455514, 0x11415100, 0x55457514,
+  0x00404100, 0x51455100, 0x55457510, 0x01004100, 0x51104104, 0x55144504,
+  0x51104100, 0x51044100, 0x55544104, 0x41044100, 0x51444100, 0x55544114,
+  0x41000100, 0x55044110, 0x51000140, 0x55044155, 0x41000140, 0x41000151,
+  0x55000155, 0x55155155, 0x45000151, 0x55001155, 0x45001144, 0x05001104,
+  0x55041154, 0x55055155, 0x15041104, 0x55041104, 0x55045554, 0x05041104,
+  0x55445514, 0x01045100, 0x55445504, 0x01005100, 0x01445100, 0x51455500,
+  0x55555504, 0x00004100, 0x01404100, 0x55557500, 0x01104100, 0x41104100,
+  0x55104100, 0x55104104, 0x55544504, 0x41004100, 0x51144100, 0x51144104,
+  0x51544104, 0x51444104, 0x51544154, 0x51444154, 0x51554155, 0x41004155,
+  0x51044155, 0x51454155, 0x41000155, 0x41014155, 0x55054155, 0x41010155,
+  0x41000144, 0x45051155, 0x01000104, 0x41041144, 0x55041155, 0x01041104,
+  0x55557555, 0x01041100, 0x01045104, 0x45045504, 0x01044100, 0x41045500,
+  0x41445500, 0x01044500, 0x41545500, 0x41555500, 0x55104d04, 0xf5555d55,
+  0x51044104, 0x55544554, 0x51544554, 0x41044104, 0x51544555, 0x41044154,
+  0x51454555, 0x41000150, 0x41054155, 0x51054555, 0x55054555, 0x41000154,
+  0x41040155, 0x55055555, 0x41040104, 0x01040104, 0x41041104, 0x41045104,
+  0x41045504, 0x55545505, 0x41545505, 0x41044500, 0x41145500, 0x41545501,
+  0x45555505, 0x51004100, 0x75104904, 0xf5104d04, 0x55104904, 0x75144d04,
+  0x75544d44, 0x01044104, 0x55444104, 0x55544544, 0x55444544, 0x55444554,
+  0x51444554, 0x55444555, 0x41044150, 0x51044555, 0x55454555, 0x51040555,
+  0x41040504, 0x51040554, 0x55045555, 0x41041504, 0x55045505, 0x41044504,
+  0x45145505, 0x41045505, 0x41145505, 0x41044501, 0x51004900, 0x71004904,
+  0x71104904, 0xf5104904, 0x11004104, 0x51004904, 0xf5144d44, 0x01004104,
+  0x55044904, 0x05044504, 0x15444544, 0x55444545, 0x01044544, 0x55044544,
+  0x11044540, 0x51044554, 0x01000540, 0x11000550, 0x51044550, 0x55144555,
+  0x01000500, 0x51000550, 0x51040550, 0x51144555, 0x41000500, 0x51040504,
+  0x51045554, 0x41000504, 0x51045504, 0x51045505, 0x41044505, 0x01044101,
+  0x41144505, 0x01004900, 0x31004900, 0xf1004904, 0xf1104944, 0xf5104944,
+  0x11004904, 0xf5044d44, 0xf5555d45, 0x11044904, 0x75044d44, 0xf5444d44,
+  0x15044544, 0x75444d45, 0x05044544, 0x05444544, 0x15444545, 0x01044504,
+  0x01040500, 0x15044554, 0x11000500, 0x11040550, 0x11044550, 0x55544550,
+  0x51144550, 0x51144554, 0x55545555, 0x51044504, 0x55145505, 0x00004101,
+  0x41044101, 0x45545505, 0x11015511, 0x15115511, 0xf511d555, 0xf5115511,
+  0xf1110111, 0xf1114151, 0x00110111, 0x01110111, 0xf555c555, 0x01154151,
+  0xf5554151, 0x00004011, 0x00444051, 0x04554151, 0xf5554551, 0x00044011,
+  0x00444011, 0x04444051, 0x04444451, 0x04544451, 0x00040011, 0xf5f57cf5,
+  0x00440011, 0x00444055, 0x045544f5, 0xf5f544f5, 0x00040055, 0x004500f5,
+  0x01f500f5, 0xf1f540f5, 0x00000005, 0x000500f5, 0xf1f500f5, 0xf1f53cf5,
+  0x00000025, 0x012500f5, 0xf1f520f5, 0xf1f53df5, 0x00000021, 0x01010025,
+  0x012520f5, 0x21f521f5, 0xf1f521f5, 0x00002021, 0x01002021, 0x01012121,
+  0x01212125, 0x00002121, 0x01002121, 0x01212121, 0x15014111, 0x55115111,
+  0xf555d555, 0xf1115151, 0xf1111155, 0x01114111, 0xf1555151, 0x00114111,
+  0x01554151, 0x04554051, 0x05554551, 0xf5f57df5, 0x00550051, 0x01554055,
+  0x55f544f5, 0x00010011, 0x00150051, 0x015500f5, 0x11f500f5, 0xf5f554f5,
+  0x00110015, 0x011500f5, 0x01110065, 0x113500f5, 0x51f500f5, 0xf1f531f5,
+  0x01010021, 0x117521f5, 0x01000021, 0x01112161, 0x317531f5, 0xf5f53df5,
+  0x01313161, 0x71f531f5, 0x15010101, 0x55014111, 0x55010111, 0x55115115,
+  0x51115155, 0x11555155, 0x00110011, 0x01154111, 0x15555151, 0x01554111,
+  0x05555551, 0x00150011, 0x15555551, 0x01150011, 0x11550051, 0x555555f5,
+  0x01110011, 0x11150011, 0x11550055, 0x55f551f5, 0x01110001, 0x11110055,
+  0xf1f501f5, 0x11110045, 0x511501f5, 0x11110041, 0x11110165, 0x51f531f5,
+  0x01100141, 0x11112161, 0x51713165, 0x01002141, 0x01103161, 0x11113161,
+  0x717531f5, 0x15010001, 0x55010001, 0x55014101, 0x55015111, 0x55115515,
+  0x55111155, 0x11111155, 0x11151155, 0x11151111, 0x11555111, 0x51551151,
+  0x11110011, 0x55151155, 0x00110000, 0x51110115, 0x551501f5, 0x51110141,
+  0x555511f5, 0x01100001, 0x11110141, 0x51511175, 0x01100041, 0x11100041,
+  0x11111141, 0x51513161, 0x01000041, 0x01101141, 0x11101141, 0x11503161,
+  0x71713161, 0x05000001, 0x55000001, 0x55110111, 0x11111115, 0x55551155,
+  0x11551155, 0x01110000, 0x11110000, 0x55155555, 0x55111151, 0x00100000,
+  0x51111141, 0x11101041, 0x51511141, 0x55575555, 0x11501141, 0x51571151,
+  0x11000001, 0x15110111, 0x00010010, 0x55151115, 0x10110000, 0x11100001,
+  0x11151151, 0x11151141, 0x11001041, 0x11141041, 0x11541151, 0x10000001,
+  0x11010011, 0x11155555, 0x11111151, 0x11115155, 0x00100010, 0x11115151,
+  0x11515151, 0x11511151, 0x00110010, 0x10111010, 0x10110010, 0x55151515,
+  0x11151011, 0x11151115, 0x10100000, 0x55151555, 0x11101001, 0x11000000,
+  0x11041001, 0x11141051, 0x55571555, 0x11041041, 0x00000010, 0x10100010,
+  0x11111011, 0x15111515, 0x00100111, 0x11111555, 0x15155555, 0x00001111,
+  0x11115555, 0x00101111, 0x00101110, 0x11515555, 0x00101010, 0x11551151,
+  0x10151111, 0x55551555, 0x10151010, 0x15151515, 0x10141010, 0x11151015,
+  0x11151515, 0x10041010, 0x11151555, 0x10040000, 0x11041010, 0x11041011,
+  0x11040000, 0x11041000, 0x11041051, 0x11051051, 0x10101111, 0x10101110,
+  0x11101151, 0x11501150, 0x51551555, 0x10151015, 0x10151515, 0x11151055,
+  0x15171555, 0x15111151, 0x15115555, 0x55115555, 0x11101111, 0x51151555,
+  0x10000010, 0x15151555, 0x11141010, 0x11141011, 0x15151051, 0x15511151,
+  0x15115151, 0x55115151, 0x51155555, 0x10151115, 0x15151511, 0x15151010,
+  0x10111050, 0x11511150, 0x15515151, 0x00111010, 0x00011111, 0x55115551,
+  0x11111515, 0x11101010, 0x15141010, 0x10101000, 0x15101010, 0x15151510,
+  0x7f55557d, 0x01011111, 0x51111151, 0x00001011, 0x15551515, 0x15141510,
+  0x55551515, 0x11111150, 0x51115151, 0x51111155, 0x55115155, 0x10011111,
+  0x10000011, 0x10011011, 0x10110011, 0x15551555, 0x10141011, 0x11151511,
+  0x15141511, 0x11111010, 0x7b55517d, 0x51555155, 0x51155155, 0x01011151,
+  0x00000151, 0x01010155, 0x01011155, 0x11011155, 0x10010155, 0x10010055,
+  0x10010015, 0x10010011, 0x11551555, 0x10110001, 0x11551515, 0x10551111,
+  0x10001011, 0x10541011, 0x10441010, 0x10441111, 0x15541515, 0x7b15513d,
+  0x7b55557d, 0x7b15517d, 0x00000055, 0x00000051, 0x00000155, 0x00000015,
+  0x11010155, 0x11015555, 0x10000055, 0x11010055, 0x11055555, 0x10000015,
+  0x10150115, 0x10550011, 0x10450011, 0x10040011, 0x10441011, 0x10551515,
+  0x10441515,
+};
+
+const uint16_t kPatternDictIndex[kIndexCells] = {
+     0,    1,    2,    3,    4,    5,    6,    6,    0,    0,    7,    3,
+     8,    5,    6,    9,   10,   11,    7,   12,    8,    8,   13,    9,
+    14,   11,   15,   12,   12,   16,   17,    9,   14,   18,   15,   12,
+    16,   19,   20,   21,   18,   18,   18,   12,   19,   20,   22,   23,
+    18,   18,   24,   25,   20,   22,   26,   23,   18,   24,   25,   27,
+    28,   29,   26,   23,   18,   30,   25,   31,   28,   32,   33,   34,
+    14,   30,   30,   35,   36,   37,   33,   34,   14,   30,   30,   38,
+    39,   37,   40,   34,   14,   41,   42,   43,   39,   44,   40,   45,
+    14,   46,   47,   42,   38,   39,   48,   49,   10,   46,   50,   50,
+    51,   52,   53,   49,   10,   46,   54,   55,   55,   56,   57,   49,
+    58,   59,   54,   55,   60,   61,   56,   62,    0,    0,    3,    3,
+     8,   63,   64,   65,    0,   11,    7,    8,    8,    8,   66,   67,
+    10,   11,   12,   12,   12,    8,   66,   67,   14,   15,   15,   12,
+    12,   19,   68,   67,   18,   18,   15,   12,   12,   19,   69,   33,
+    18,   18,   18,   12,   70,   69,   71,   23,   18,   18,   18,   72,
+    20,   69,   29,   23,   18,   18,   18,   25,   73,   22,   26,   23,
+    18,   18,   24,   25,   74,   75,   33,   34,   14,   18,   24,   25,
+    35,   76,   33,   34,   14,   18,   24,   77,   78,   79,   37,   34,
+    14,   18,   80,   43,   78,   39,   40,   45,   14,   14,   18,   81,
+    78,   39,   82,   83,   14,   14,   50,   30,   77,   84,   85,   83,
+    10,   14,   46,   86,   87,   87,   88,   83,   10,   14,   54,   55,
+    55,   89,   90,   91,    0,   11,    7,   92,   93,   93,   94,   65,
+     0,   11,    7,   12,   92,   93,   66,   67,   10,   11,   12,   12,
+    95,   93,   96,   67,   14,   15,   12,   12,   12,   97,   98,   67,
+    18,   15,   12,   12,   70,   69,   98,   33,   18,   18,   15,   12,
+    97,   69,   98,   21,   18,   18,   18,   12,   97,   69,   99,   23,
+    18,   18,   18,   18,   97,   69,  100,   23,   14,   18,   18,   18,
+   101,  102,   33,   34,   14,   18,   18,   24,  101,  103,   33,   34,
+    14,   18,   18,   24,  104,  103,  105,   45,   14,   18,   24,  104,
+   106,   78,  107,   45,   14,   14,   24,   80,  108,   78,  107,   83,
+    14,   14,   18,   30,   30,  109,  110,   83,   14,   14,   46,   50,
+   111,  112,  113,   83,   10,   14,   46,   50,  114,  115,  116,   91,
+    11,  117,  118,   93,   93,   93,  119,   65,   14,   11,  120,  121,
+   121,   93,   96,   67,   14,   15,   95,   95,  121,  121,   96,   67,
+    18,   15,   12,   95,   95,  122,   98,   67,   18,   15,   12,   12,
+    97,  123,   98,  100,   18,   18,   15,   95,   95,  123,   98,   21,
+    18,   18,   18,  120,   95,   97,   98,   21,   14,   18,   18,  124,
+   120,   95,  122,   23,   14,   18,   18,  124,  124,   95,  122,  125,
+    14,   18,   18,   18,  101,  101,  126,   45,   14,   18,   18,   24,
+   104,  127,  128,   45,   14,   18,   24,  104,  129,  130,  128,   45,
+    14,   18,   24,   72,  104,  109,  131,   83,   14,   14,   18,   24,
+   132,  109,  133,   83,   14,   14,   18,  134,  111,  135,  136,   83,
+    14,   14,  137,  134,  138,  139,  140,  141,  142,  118,  143,  121,
+    93,  119,  144,  145,   14,  120,  143,  121,  121,   93,   96,   21,
+    14,  120,  120,   95,  121,  122,   96,   21,   18,   15,   95,   95,
+    97,  122,  146,   21,   18,   15,   12,   95,   97,  123,  146,   21,
+    18,   18,   15,   95,   95,  123,  122,   21,   14,   18,   18,  120,
+    95,   95,  122,   23,   14,   18,   18,  124,  120,   95,  121,   23,
+    14,   18,   18,  124,  124,   95,  121,   23,   14,   18,   18,   18,
+   124,   97,  147,   23,   14,   18,   18,   18,   72,  148,  149,   21,
+    14,   18,   24,   72,  104,  130,  130,  150,   14,   18,   24,   72,
+   151,  152,  153,   21,   14,   14,   18,  154,  151,  132,  155,   21,
+    14,   14,  156,  111,  138,  135,  157,   21,   14,  158,  137,  159,
+   139,  135,  157,  160,  142,  117,  117,  143,  121,   93,  161,  145,
+    14,  117,  120,  120,  121,   93,  145,   21,   14,   18,  120,  120,
+    95,  122,   65,   21,   18,   18,   15,  120,  123,  162,  163,   21,
+    18,   18,   18,  164,  123,  162,  146,   21,   18,   18,   18,  120,
+   165,  162,  146,   23,   18,   18,   18,  120,  120,  165,  166,   23,
+    14,   18,   18,  120,  120,   95,  167,   23,   14,   18,   18,  124,
+   120,   95,  168,   23,   14,   18,   18,   18,  124,   97,  169,   23,
+    14,   18,   18,   18,   24,  170,  171,   23,   14,   18,   24,   24,
+    72,  172,  173,   21,   14,   18,   24,   24,   72,  174,  175,   21,
+    14,   18,   18,   24,  111,  132,  131,   21,   14,   14,   18,   30,
+   111,  176,  157,   21,   14,   14,   50,  134,  111,  135,  135,  177,
+    14,  117,  117,  117,   95,  178,  179,  145,   14,   14,  117,  120,
+   120,  180,   65,   21,   14,   14,  124,  120,  164,  162,   65,   21,
+    18,   18,   18,  120,  181,  182,  183,   21,   18,   18,   18,  184,
+   181,  182,  185,   21,   18,   18,   18,  124,  181,  162,  186,   23,
+    18,   18,   18,  120,  187,  162,  186,   23,   14,   18,   18,  120,
+   120,  165,  188,   23,   14,   18,   18,  120,  120,  167,  189,   23,
+    14,   18,   18,   18,  120,  122,  190,   23,   14,   18,   18,   18,
+   191,  122,  190,   23,   14,   18,   24,   24,  191,  192,  193,   23,
+    14,   18,   24,   24,  194,  192,  193,   21,   14,   18,   18,   24,
+    30,  192,  195,   21,   14,   18,   18,   30,   30,  132,  196,   21,
+    14,   14,   50,   30,   30,  132,  197,  177,   14,   11,  117,  117,
+   198,  199,  200,  145,   14,   14,  117,  120,  201,  199,  202,   21,
+    14,   14,   18,  120,  203,  204,  205,   21,   14,   18,   18,  184,
+   206,  207,  185,   21,   18,   18,  208,  184,  209,  210,  211,   21,
+    18,   18,   18,  208,  181,  210,  185,   23,   18,   18,   18,  187,
+   212,  213,   21,   23,   14,   18,   15,  120,  187,  214,  215,   23,
+    14,   18,   18,  120,  187,  168,  215,   23,   14,   18,   18,   18,
+   216,  217,  218,   23,   14,   18,   18,  191,  194,  219,  220,   23,
+    14,   18,  191,  191,  194,  221,  222,   23,   14,   18,   24,  194,
+   194,  221,   99,   21,   14,   18,   24,   30,  194,  194,   99,   21,
+    14,   18,   50,   30,   30,   25,  122,   21,   14,   18,   50,   30,
+    25,   25,  223,  177,   14,   11,  117,  198,  224,  199,  200,   23,
+    14,   14,  117,  117,  201,  199,  202,   23,   14,   14,   14,  124,
+   225,  207,  185,   23,   14,   18,  226,  184,  209,  227,  211,   21,
+    18,  226,  208,  184,  209,  228,  211,   23,   14,   18,   18,  208,
+   206,  227,  229,   23,   14,   18,   18,   50,  212,  230,   21,   23,
+    14,   18,   18,  120,  187,  231,   21,   23,   14,   18,   15,   15,
+   187,  232,   21,   23,   14,   18,   18,   18,  216,  233,   21,   23,
+    14,   18,   18,  234,  194,  222,   99,   23,   14,   18,  191,  194,
+   221,  235,  222,   23,   14,   18,  191,  194,  194,  221,   99,  236,
+    14,   18,   30,   30,  194,  194,   99,  236,   14,   18,   50,   30,
+    30,  192,  122,  237,   14,   18,   50,   30,   25,  223,  123,  238,
+    11,   11,  117,  198,  239,  240,  241,   23,   14,   14,  117,  198,
+   242,  199,  243,   23,   14,   14,  142,  120,  242,  244,  245,   23,
+    14,   14,   14,  124,  246,  247,  229,   23,   14,   14,   18,  248,
+   249,  250,  229,   23,   14,   14,   18,   18,  251,  247,   21,   23,
+    14,   18,   18,   18,  252,  253,   21,   23,   14,   18,   18,   15,
+   254,  255,  256,   23,   14,   18,   18,   15,   12,  257,  258,   23,
+    14,   18,   18,   18,  259,  260,  150,   23,   18,   18,   18,  234,
+   194,  261,  262,   23,   18,   18,  191,  194,  221,  221,   99,   23,
+    18,   18,   30,  194,  194,  263,   99,   23,   18,   18,   30,   30,
+   194,  264,   98,   23,   18,   18,   30,   30,   25,  122,  122,  236,
+    18,   18,   50,   30,  265,  123,  122,  238,   11,   11,  117,  266,
+   267,  240,  241,   23,   14,   11,  117,  198,  268,  241,  269,   23,
+    14,   14,  142,  198,  270,  271,  272,   23,   14,   14,  142,  273,
+   271,  274,  247,   23,   14,   14,  275,  273,  276,  274,  247,   23,
+    14,   14,   14,  277,  278,  279,  245,   23,   14,   14,   18,  280,
+   281,  282,  283,   23,   14,   18,   18,  284,  285,  286,  287,   23,
+    14,   18,   18,  288,  285,  285,  289,   23,   14,   18,   18,   18,
+   290,  291,  292,   23,   18,   18,   18,   50,  192,  261,  292,   23,
+    18,   18,   30,  194,  263,  293,   99,   23,   18,   18,   30,  194,
+   263,  294,   99,   23,   18,   18,   30,   30,  264,   98,   98,   23,
+    18,   18,   30,   30,  265,  122,   98,   23,   18,   18,   30,  265,
+   265,  122,  295,  238,   11,  117,  296,  266,  267,  297,  241,   23,
+    14,  117,  117,  266,  298,  299,  300,   23,   14,  142,  198,  301,
+   301,  302,  269,   23,   14,  142,  273,  303,  304,  304,  305,   23,
+    14,  306,  273,  303,  307,  308,  274,   23,   14,  309,  310,  303,
+   278,  311,  312,   23,   14,   14,  309,  313,  314,  282,  312,   23,
+    14,   14,  284,  284,  285,  315,  316,   23,   14,   18,  288,  317,
+   285,  315,  318,   23,   14,   18,   18,  319,  320,  321,  322,   23,
+    18,   18,   18,  323,   25,  324,  292,   23,   18,   18,   30,   25,
+   263,  293,  325,   23,   18,   50,   30,   25,  263,   98,   98,   23,
+    18,   50,   30,   25,  264,   98,  326,   23,   18,   50,  327,  265,
+   264,  122,  326,   23,   18,  328,  327,  265,  264,  122,  295,  238,
+    14,  329,  329,  330,  267,  297,  331,  332,   14,  142,  117,  296,
+   297,  299,  300,  332,   14,  142,  142,  301,  333,  302,  302,  332,
+    14,  334,  334,  303,  301,  304,  305,  332,  335,  334,  336,  303,
+   304,  304,  274,   23,   14,   14,  310,  336,  301,  271,  312,   23,
+    14,   14,   14,  280,  282,  282,  337,   23,   14,   14,  288,  317,
+   285,  338,  316,   23,   14,   18,  288,  339,  320,  340,  289,   23,
+    14,   18,   18,  288,  341,  342,  343,   23,   14,   18,   18,  344,
+    25,  345,   23,   23,   14,   18,   18,   25,  263,  294,  346,   23,
+    14,   18,   30,   25,  264,  294,  238,   23,   14,   18,   30,  265,
+   264,  122,  238,   23,   18,   18,  327,  265,  264,  122,  347,   23,
+    18,  328,  327,  265,  264,  122,  347,  237,   14,  142,  348,  349,
+   349,  350,  351,  332,   14,  142,  142,  349,  330,  302,  352,  332,
+    14,  142,  142,  353,  354,  302,  300,  332,   14,  334,  334,  353,
+   301,  271,  300,  332,  335,  335,  353,  353,  301,  271,  269,   23,
+    14,   14,  334,  353,  355,  299,  337,   23,   14,   14,   14,  124,
+   354,  316,  356,   23,   14,   14,   18,  357,  358,  359,  360,   23,
+    14,   14,   18,  357,  361,  362,  360,   23,   14,   14,   18,   18,
+   363,  364,  365,   23,   14,   14,   14,   18,  366,  367,  365,   23,
+    14,   14,   14,  344,  368,  369,  346,   23,   14,   14,   14,   72,
+   368,  369,  370,   23,   14,   14,   18,  265,  368,  368,  370,   23,
+    14,   18,   30,  265,  371,  368,  347,   23,   14,   50,   30,  265,
+   371,  368,  166,  237,   14,  124,  348,  348,  372,  373,  351,  332,
+    14,  142,  124,  348,  348,  374,  375,  332,   14,  142,  142,  124,
+   376,  374,  352,  332,   14,   14,  334,  353,  121,  377,  300,  332,
+    14,  335,  353,  353,  378,  121,  300,   23,   14,   14,  334,  353,
+   121,  377,  236,   23,   14,   14,  142,  124,  379,  380,   23,   23,
+    14,   14,  124,  381,  381,  382,  383,   23,   14,   14,  124,  381,
+   384,  385,  386,   23,   14,   14,  142,  124,  387,  388,  365,   23,
+    14,   14,  142,  389,  390,  391,  392,   23,   14,   14,  142,  393,
+   394,  395,  396,   23,   14,   14,  397,  393,  394,  398,  396,   23,
+    14,   14,  397,  399,  371,  400,  398,   23,   14,   14,  401,  371,
+   371,  368,  398,   23,   14,  402,   30,  403,  371,  371,  368,  346,
+    18,  124,  348,  372,  404,  405,  406,  407,   14,  124,  124,  348,
+   372,  404,  408,  409,   14,   14,  124,  124,  376,  410,  411,  409,
+    14,   14,  334,  353,  121,  412,  412,  409,   14,  335,  353,  353,
+   121,  412,  233,   23,   14,   14,  334,  334,  377,  413,  414,   23,
+    14,  142,  142,  124,  379,  415,  414,   23,   14,  142,  416,  381,
+   384,  417,  418,   23,  142,  142,  416,  384,  384,  417,  419,   23,
+    14,  142,  389,  389,  384,  420,  392,  365,   14,  142,  389,  389,
+   421,  422,  423,  365,   14,  389,  424,  425,  421,  426,  427,  392,
+    14,  397,  389,  425,  394,  426,  428,  346,   14,  397,  397,  399,
+   429,  400,  398,  346,   14,  397,  430,  431,  371,  368,  400,  346,
+    14,  401,  184,  184,  403,  371,  368,  346,  432,  433,  434,  435,
+   436,  437,  438,  439,   10,    0,  440,  441,  442,  443,  444,  332,
+    10,  445,  445,  446,  447,  448,  449,  332,  450,  450,  446,  446,
+   451,  452,  453,  332,  450,  454,  446,  451,  452,  455,  456,  456,
+   450,  450,  446,  451,  451,  452,  455,  456,  450,  450,  457,  458,
+   451,  451,  452,  456,  450,  450,  457,  458,  458,  451,  451,  456,
+    10,  457,  457,  458,  458,  451,  451,  459,   10,  460,  461,  458,
+   458,  462,  463,  459,   10,  461,  461,  461,  464,  465,  466,  459,
+     0,  461,  467,  468,  464,  469,  470,  459,   10,    0,  467,  464,
+   464,  469,  471,  472,   10,   10,   10,  473,  474,  475,  476,  472,
+    10,   10,  477,  477,  478,  479,  480,  472,   14,  477,  481,  478,
+   482,  483,  484,  485,   10,   10,  440,  441,  486,  487,  488,   23,
+    10,  450,  445,  440,  489,  490,  491,  332,   10,  450,  446,  451,
+   451,  489,  492,  332,  450,  454,  446,  451,  451,  451,  493,  332,
+   450,  454,  446,  451,  451,  494,  495,  496,  450,  450,  451,  451,
+   451,  497,  455,  498,  450,  450,  457,  451,  451,  451,  497,  499,
+   450,  457,  457,  458,  451,  451,  497,  499,   10,  457,  457,  458,
+   458,  451,  500,  501,   10,  460,  461,  458,  458,  500,  502,  503,
+    10,  461,  461,  461,  467,  502,  504,  505,    0,  461,  461,  467,
+   468,  506,  507,  508,   10,    0,  461,  461,  464,  506,  509,  510,
+    10,   10,    0,  461,  511,  512,  513,  514,   10,   10,   10,  515,
+   516,  517,  518,  519,   10,   10,  520,  477,  478,  521,  522,  523,
+    10,  450,  450,  524,  525,  526,  491,   23,   10,  450,  454,  524,
+   527,  526,  491,  332,   10,  454,  454,  451,  451,  528,  529,  332,
+   450,  454,  446,  451,  451,  527,  530,  332,  454,  454,  451,  451,
+   451,  531,  530,  498,  450,  454,  451,  451,  451,  497,  532,  498,
+   450,  457,  458,  451,  497,  497,  533,  498,  450,  457,  457,  458,
+   497,  497,  533,  499,   10,  457,  458,  458,  497,  497,  533,  503,
+    10,  460,  461,  458,  534,  500,  535,  503,   10,  461,  461,  461,
+   536,  535,  537,  503,    0,    0,  461,  461,  538,  539,  540,  505,
+    10,    0,  461,  461,  538,  541,  542,  510,   10,   10,    0,  461,
+   538,  543,  544,  519,   10,   10,    0,  461,  536,  545,  518,  519,
+    10,   10,   10,    0,  546,  547,  548,  523,  450,  454,  524,  549,
+   550,  551,  186,   23,  450,  454,  524,  549,  549,  552,  186,  332,
+   454,  454,  524,  549,  527,  553,  554,  332,  454,  454,  524,  451,
+   527,  555,  556,  332,  454,  454,  451,  451,  527,  555,  556,  498,
+   450,  524,  451,  451,  497,  531,  557,  498,  450,  457,  451,  497,
+   497,  531,  535,  498,  457,  457,  458,  497,  497,  533,  533,  499,
+   460,  457,  534,  534,  497,  533,  533,  558,   10,  461,  461,  534,
+   534,  535,  535,  503,   10,  461,  461,  538,  559,  560,  561,  503,
+    10,    0,  562,  563,  559,  564,  565,  505,   10,    0,  562,  563,
+   559,  559,  565,  510,   10,    0,  461,  559,  559,  566,  567,  568,
+    10,    0,  461,  536,  566,  566,  569,  519,   10,    0,  461,  570,
+   571,  556,  572,  523,  454,  524,  549,  573,  550,  551,  574,  575,
+   454,  524,  549,  549,  573,  551,  576,   23,  454,  524,  524,  549,
+   549,  569,  576,   23,  454,  454,  524,  527,  527,  556,  569,   23,
+   577,  454,  451,  527,  527,  555,  578,  245,  450,  524,  451,  451,
+   531,  555,  557,  245,  450,  457,  451,  497,  531,  533,  535,  245,
+   457,  457,  497,  497,  497,  533,  533,  245,  457,  579,  534,  497,
+   497,  533,  535,  580,   10,  461,  534,  534,  560,  555,  581,  580,
+    10,    0,  562,  559,  560,  560,  561,  580,   10,  582,  563,  563,
+   559,  564,  583,  580,    0,  582,  563,  559,  559,  564,  584,  585,
+     0,    0,  562,  559,  559,  566,  586,  585,    0,  461,  461,  566,
+   566,  566,  587,  588,    0,  461,  570,  571,  566,  587,  587,  589,
+   454,  524,  524,  524,  573,  551,  590,  575,  454,  454,  524,  524,
+   549,  429,  591,   23,  454,  454,  524,  524,  549,  429,  592,   23,
+   454,  454,  524,  524,  527,  531,  593,   23,  454,  454,  524,  524,
+   527,  594,  595,  245,  450,  454,  524,  451,  531,  596,  597,  245,
+   450,  524,  524,  451,  531,  598,  599,  245,  450,  457,  524,  497,
+   531,  598,  600,  245,  450,  457,  451,  497,  531,  598,  600,   23,
+    10,  460,  458,  534,  531,  594,  601,   23,   10,    0,  461,  458,
+   560,  555,  602,  580,   10,    0,  582,  562,  559,  603,  604,  580,
+    10,    0,  461,  562,  559,  603,  605,  588,   10,    0,  461,  562,
+   559,  587,  606,  588,   10,  461,  461,  570,  566,  587,  607,  588,
+    10,  461,  608,  570,  587,  609,  607,  589,  454,  454,  524,  524,
+   610,  611,  612,  575,  454,  454,  524,  524,  524,  611,  613,   23,
+   454,  454,  524,  524,  524,  614,  615,   23,  454,  454,  524,  524,
+   524,  616,  617,   23,  454,  454,  524,  524,  618,  596,  345,  245,
+   454,  454,  524,  524,  619,  596,  620,  245,  450,  524,  524,  524,
+   596,  596,  599,  245,  450,  524,  524,  621,  596,  598,  600,  245,
+   450,  457,  524,  451,  596,  599,  600,   23,   10,  450,  458,  451,
+   622,  594,  601,   23,   10,   10,  458,  458,  621,  594,  602,   23,
+    10,    0,    0,  458,  623,  624,  602,  580,   10,    0,    0,  458,
+   625,  624,  626,  588,   10,    0,  461,  458,  625,  627,  628,  588,
+    10,  460,  461,  608,  629,  630,  631,  588,   10,  460,  608,  632,
+   633,  634,  631,  589,  450,  454,  454,  610,  610,  635,  636,  575,
+   450,  454,  454,  610,  610,  637,  638,   23,  450,  454,  454,  524,
+   610,  639,  640,   23,  450,  454,  454,  524,  618,  641,  642,  343,
+   450,  454,  454,  618,  643,  643,  642,  245,  454,  454,  618,  618,
+   618,  644,  345,  245,  454,  454,  618,  618,  645,  596,  600,  245,
+   454,  454,  618,  645,  622,  646,  600,  245,  450,  454,  618,  622,
+   622,  646,  600,  215,  450,  450,  621,  621,  622,  646,  647,   23,
+   450,  450,  648,  621,  621,  622,  602,   23,   10,  445,  445,  649,
+   649,  650,  602,  580,   10,  445,  445,  649,  649,  651,  652,  588,
+    10,   10,  458,  458,  653,  654,  655,  588,   10,  460,  458,  656,
+   657,  630,  658,  588,  460,  659,  660,  661,  661,  658,  662,  589,
+   450,  454,  663,  610,  637,  635,  635,   23,  450,  454,  454,  610,
+   610,  635,  638,   23,  450,  454,  454,  524,  610,  641,  664,   23,
+   450,  454,  454,  618,  639,  641,  665,  575,  450,  454,  666,  618,
+   643,  641,  642,   23,  454,  454,  666,  618,  618,  644,  345,   23,
+   454,  454,  666,  618,  645,  596,  292,   23,  454,  454,  618,  618,
+   622,  667,  668,  343,  454,  666,  618,  618,  622,  667,  600,   23,
+   450,  454,  666,  621,  621,  646,  600,   23,  450,  450,  648,  621,
+   621,  621,  602,   23,  450,  445,  648,  648,  621,  650,  669,   23,
+   450,  450,  445,  649,  649,  670,  671,  672,   10,  450,  445,  649,
+   653,  673,  674,  672,   10,   10,  675,  661,  657,  654,  674,  588,
+   676,  659,  677,  677,  661,  678,  662,  588,  454,  454,  454,  679,
+   635,  680,  681,   23,  454,  454,  454,  524,  682,  681,  681,   23,
+   450,  454,  454,  524,  682,  683,  684,   23,  450,  454,  454,  524,
+   641,  685,  686,   23,  450,  454,  454,  524,  641,  685,  686,   23,
+   450,  454,  454,  524,  643,  685,  687,   23,  454,  454,  454,  666,
+   643,  688,  343,   23,  454,  454,  454,  666,  689,  690,  691,   23,
+   454,  454,  454,  666,  692,  690,  693,   23,  450,  454,  454,  666,
+   621,  694,  695,   23,  450,  450,  454,  696,  621,  697,  698,   23,
+   450,  450,  445,  696,  621,  699,  700,   23,  450,  450,  445,  696,
+   621,  701,  702,  672,   10,  450,  450,  445,  703,  704,  705,  672,
+    10,  450,  450,  656,  706,  704,  707,  672,   10,  450,  708,  677,
+   706,  709,  710,  588,  454,  454,  711,  679,  712,  681,  713,   23,
+   454,  454,  711,  679,  714,  681,  713,   23,  450,  454,  454,  711,
+   715,  681,  716,   23,  450,  454,  454,  711,  715,  685,  716,   23,
+   450,  454,  454,  717,  715,  718,  719,   23,  450,  454,  454,  720,
+   715,  721,  687,   23,  450,  454,  454,  720,  722,  723,  343,   23,
+   454,  454,  454,  724,  725,  726,  727,   23,  454,  454,  454,  724,
+   728,  729,  727,   23,  450,  454,  454,  454,  730,  729,  727,   23,
+   450,  454,  454,  454,  731,  732,  733,   23,  450,  454,  454,  696,
+   734,  735,  736,   23,  450,  450,  454,  446,  737,  735,  738,  672,
+   450,  450,  454,  446,  739,  740,  702,  672,   10,  450,  454,  741,
+   742,  743,  744,  672,   10,  745,  711,  746,  742,  743,  747,  588,
+   454,  711,  748,  749,  750,  751,  713,   23,  454,  711,  711,  749,
+   714,  681,  752,   23,  450,  711,  711,  753,  754,  755,  752,   23,
+   450,  711,  711,  717,  715,  756,  719,   23,  450,  711,  711,  717,
+   718,  757,  758,   23,  450,  454,  711,  753,  717,  759,  760,   23,
+   450,  454,  720,  720,  761,  762,  763,   23,  454,  454,  724,  725,
+   764,  765,  766,   23,  454,  454,  724,  725,  764,  767,  733,   23,
+   454,  454,  454,  768,  764,  769,  733,   23,  454,  454,  454,  770,
+   771,  772,  733,   23,  454,  454,  770,  773,  737,  735,  772,   23,
+   454,  454,  454,  773,  773,  735,  580,  774,  454,  454,  663,  775,
+   776,  777,  744,  774,  454,  454,  778,  778,  779,  780,  744,  672,
+   454,  711,  778,  781,  779,  782,  783,  588,  454,  711,  748,  714,
+   751,  751,  784,  785,  454,  711,  711,  749,  712,  681,  713,  785,
+   450,  711,  711,  753,  755,  755,  752,  785,  450,  711,  711,  778,
+   786,  756,  787,  785,  450,  711,  778,  778,  757,  757,  788,   23,
+   450,  454,  711,  717,  789,  759,  790,   23,  450,  454,  454,  753,
+   791,  762,  792,   23,  450,  454,  724,  793,  764,  794,  795,   23,
+   454,  454,  724,  725,  764,  794,  796,   23,  454,  454,  454,  768,
+   797,  798,  799,   23,  454,  454,  454,  770,  800,  732,  799,   23,
+   454,  454,  770,  801,  802,  735,  736,   23,  454,  454,  454,  801,
+   802,  777,  736,   23,  454,  454,  663,  663,  803,  804,  805,   23,
+   454,  454,  778,  778,  779,  779,  806,   23,  454,  711,  778,  781,
+   807,  808,  809,  810,  454,  711,  711,  811,  712,  812,  813,  785,
+   454,  711,  711,  811,  712,  814,  815,  785,  454,  711,  711,  711,
+   786,  681,  816,  785,  450,  711,  711,  817,  789,  818,  819,  785,
+   450,  711,  778,  817,  817,  820,  821,   23,  450,  454,  454,  778,
+   789,  822,  823,   23,  450,  454,  454,  454,  824,  825,  826,   23,
+   450,  454,  454,  793,  793,  825,  795,   23,  454,  454,  454,  793,
+   793,  827,  795,   23,  454,  454,  454,  720,  797,  827,  799,   23,
+   454,  454,  454,  770,  828,  829,  830,   23,  454,  454,  454,  801,
+   828,  831,  736,   23,  454,  454,  454,  801,  828,  804,  832,   23,
+   454,  454,  454,  663,  833,  804,  834,   23,  450,  454,  711,  778,
+   807,  835,  836,   23,  450,  711,  778,  778,  837,  837,  806,  810,
+   577,  711,  711,  838,  839,  840,  841,  785,  454,  711,  711,  842,
+   843,  840,  844,  785,  454,  711,  711,  845,  635,  846,  816,  785,
+   450,  711,  778,  817,  817,  820,  820,  785,  450,  663,  817,  817,
+   847,  848,  849,   23,  450,  454,  663,  778,  850,  851,  823,   23,
+   450,  454,  454,  663,  852,  853,  823,   23,  450,  454,  454,  854,
+   855,  856,  857,   23,  454,  454,  454,  858,  859,  860,  861,   23,
+   454,  454,  454,  858,  862,  829,  825,   23,  454,  454,  454,  858,
+   828,  863,  864,   23,  454,  454,  454,  865,  828,  828,  866,   23,
+   450,  454,  454,  865,  828,  833,  867,   23,  450,  454,  454,  663,
+   833,  868,  835,   23,  450,  454,  711,  869,  837,  868,  836,   23,
+   450,  711,  401,  869,  837,  837,  870,  810,  577,  871,  872,  872,
+   839,  873,  874,  875,  577,  711,  711,  876,  839,  839,  877,  878,
+   454,  711,  845,  845,  879,  880,  881,  878,  450,  454,  817,  817,
+   847,  882,  883,  878,  450,  663,  817,  847,  884,  885,  886,   23,
+   450,  454,  663,  887,  884,  882,  823,   23,  450,  454,  858,  888,
+   852,  889,  821,   23,  450,  454,  858,  890,  891,  892,  893,   23,
+   454,  858,  858,  890,  855,  860,  894,   23,  450,  454,  858,  858,
+   890,  860,  895,   23,  450,  454,  858,  858,  862,  863,  853,  896,
+   450,  454,  858,  862,  865,  828,  897,  580,  450,  454,  858,  862,
+   828,  833,  868,  898,  450,  454,  454,  862,  868,  868,  868,  898,
+   450,  450,  402,  401,  837,  868,  870,  898,   46,  899,  401,  869,
+   900,  868,  870,  901,   14,   18,   25,  192,  902,  903,  237,  237,
+    14,   18,  194,  192,  192,  347,  237,  904,   14,   14,  234,  192,
+   264,  368,  905,  904,   14,   41,  234,  234,  264,  906,  907,  904,
+   335,  335,   41,  908,  909,  906,  907,  910,  335,  335,  335,   41,
+   908,  911,  912,  910,  335,  335,  335,  913,  914,  915,  916,  910,
+   335,  335,  917,  918,  919,  920,  921,  910,  335,  922,  918,  914,
+   919,  920,  921,  923,  335,  922,  924,  914,  925,  926,  927,  923,
+    14,  922,  928,  929,  930,  931,  923,  923,  932,  928,  933,  930,
+   930,  934,  935,  923,   14,  936,  933,  937,  930,  938,  935,  939,
+    14,  940,  940,  941,  942,  943,  944,  939,   14,  940,  945,  946,
+   947,  948,  943,  939,   14,  520,  945,  949,  950,  947,  951,  944,
+    14,   18,   72,   25,  952,  237,  237,   23,   14,   18,   30,  192,
+   192,  953,  237,  954,   14,   18,  234,  192,  264,   98,  905,  954,
+    14,  234,  234,  909,  264,  294,  955,  954,   14,  335,  234,  908,
+   909,  264,  956,  954,  335,  335,  335,  234,  909,  957,  958,  954,
+   335,  335,  335,  335,  959,  960,  107,  954,  335,  335,  335,  917,
+   918,  961,  962,  954,   14,  335,  335,  917,  914,  961,  962,  963,
+    14,  335,  335,  922,  964,  965,  966,  963,   14,   14,  967,  968,
+   969,  970,  971,  963,   14,   18,  972,  973,  970,  934,  935,  963,
+    14,   14,   24,  974,  975,  976,  977,  963,   14,   14,   14,  978,
+   974,  979,  977,  963,   14,   14,   14,  980,  947,  981,  982,  983,
+    14,   14,  520,  950,  950,  947,  984,  985,   14,  515,   72,  986,
+   987,  237,  237,   23,   14,   18,   72,  192,  988,  953,  237,  954,
+    14,   18,  194,  192,  264,   99,  989,  954,   14,  234,  234,  909,
+   264,  122,  990,  954,   14,  234,  234,  909,  909,  122,  956,  954,
+    14,  335,  234,  908,  909,  122,  991,  954,   14,  335,  967,  992,
+   909,  993,  994,  954,   14,  335,  335,  967,  992,  995,  996,  954,
+    14,  335,  335,  967,  997,  960,  998,  963,   10,   14,  967,  992,
+   999, 1000, 1001,  963,   10,   18,  124, 1002, 1003, 1004, 1005,  963,
+    10,   18, 1006,  101, 1007,  976, 1008,  963,   10,   18, 1006, 1006,
+  1009, 1010,  977,  963,   10,   14,  515, 1006, 1011, 1012, 1013,  963,
+    14,   14,  515,  515, 1014, 1015, 1016,  963,   14,   14,  515,  515,
+  1017, 1018, 1019, 1020,   14,  515, 1021, 1022, 1023, 1024,  237,   23,
+    14,  515,   72,  986,  988,  953, 1025,  954,   14,   18,   30,  192,
+   264,   99,  989,  954,   14,   50,  194,  909,  122,  122, 1026,  954,
+    18,  234,  909,  909,  122,  122, 1027,  954,   18,  967,  908,  909,
+   217,  122, 1028,  954,   14,  967,  967,  908,  909,  217, 1029,  954,
+    14,   18,  967,  992,  909,  217, 1030,   34,   10,   18,  967,  992,
+   909,  909, 1030,  963,   10,   18,  124, 1002, 1002,  264, 1031,  963,
+   432,  432,  124, 1006, 1032,  264, 1033,  963,  432, 1034, 1006,  101,
+   101, 1035, 1036,  963,   10, 1034, 1006,  101,  101, 1037, 1038,  963,
+    10,   14, 1039, 1006, 1011, 1040, 1041,  963,   14,   14,  515, 1042,
+  1043, 1044, 1045,  963,   14,   14, 1046, 1042, 1047, 1048, 1049, 1050,
+    14, 1051, 1052, 1022, 1023,  953,  392,   23,   14,  515,   72,   31,
+  1053,  953,  727,   23,   14,   24,   30,  264,  233,   99,  343,   23,
+    18,   50,  194,  217,  122, 1054, 1055,   23,   18,  234,  909,  217,
+   122, 1054, 1056,   23,   18,  967,  909,  217,  217,  122, 1054,   23,
+   432,   18,  908,  909,  217,  122, 1054,   23,  432,   18,  992,  909,
+   217,  217,  122,   23,  432,   18,  124, 1002,  909,  122,  122,   23,
+   432, 1034,  124, 1006,  264,  264,   98,   23,  432, 1034, 1057,  101,
+   265,  264,   99,   23,  432, 1034, 1058,  101,  265,   73, 1053, 1059,
+    10, 1034, 1058,  101,  265,   73, 1060,   23,   10, 1061, 1039,  101,
+  1011, 1044, 1062,   23,   10,  515, 1042, 1043, 1063, 1044, 1064, 1065,
+    14, 1046, 1046,  224, 1063, 1048, 1066, 1067,   14, 1068, 1021, 1022,
+   953,  237, 1059,   23,   14,  515,   72, 1069,   99,  989, 1059,   23,
+    14,   18,  194,  122,  233,  989,   23,   23,   14,  234,  909,  122,
+   122, 1027,   23,   23,   18,  234,  217,  217,  122, 1027,  488,   23,
+    14,  234,  909,  217,  122, 1027,  991,   23,   10,  967,  908,  217,
+   122,  122,  991,   23,   10, 1070,  992,  217,  217,  122,  247,   23,
+    10, 1034,  992,  909,  122,  122,  247,   23,   10, 1034, 1034, 1002,
+   122,  122,   96,   23,   10, 1034, 1034, 1032,  264,  122, 1071,   23,
+  1061, 1034, 1072,  101,  264,  122, 1071,   23,   10, 1061, 1072,  101,
+   101,  122, 1033, 1065,   10,   10, 1073, 1073,   97, 1074,  145, 1065,
+    10,   10,  515, 1063, 1063, 1075, 1074, 1065,   10,  515, 1046, 1076,
+  1063, 1077, 1078, 1067,   10, 1079, 1080,  233,   99,  392, 1059,   23,
+    10,   14,  264,  122,   99,  392, 1059,   23,   14,  335,  122,  122,
+  1054, 1059,   23,   23,   14,  234,  217,  122, 1054, 1081,   23,   23,
+   335,  234,  217,  122, 1027, 1081,  258,   23,   10,   41,  216,  122,
+  1082, 1083,  258,   23,   10, 1084,  216,  122,  122, 1085,   23,   23,
+    10, 1084, 1084,  217,  122, 1086,  491,   23,   10, 1084, 1084,  122,
+   122, 1087,  177,   23,   10, 1084, 1088, 1089,  122,  122,   23,   23,
+  1061, 1061, 1090, 1089,  122, 1029, 1091,   23, 1061, 1061, 1090, 1089,
+  1092, 1093, 1091,   23,   10, 1094, 1094,  121, 1092, 1029, 1095, 1065,
+    10,   10, 1094, 1096, 1092,  179, 1028, 1065,   10,   10, 1097, 1098,
+  1099,  179, 1074, 1100,   10,  577, 1068, 1101, 1101, 1099, 1074, 1067,
+  1102, 1103, 1104,  122, 1091,  392, 1059,   23, 1102,  334,  122,  122,
+  1105, 1059, 1059,   23, 1102, 1106,  122,  122, 1107, 1108,   23,   23,
+   335, 1109,  122, 1054, 1110, 1108,   23,   23,  335, 1109,  217, 1027,
+  1083, 1081,  258,   23, 1102, 1111,  216, 1082, 1083,  488,   23,   23,
+  1102, 1084, 1112,  122, 1085, 1113,   23,   23, 1102, 1084, 1114,  528,
+  1087,  247,   23,   23, 1102, 1084,  563,  528,  122,  247,   21,   23,
+  1084, 1084,  563,  563,  122, 1115,   23,   23, 1084, 1103,  563, 1089,
+  1116, 1093, 1117,   23, 1061, 1103,  563, 1118,   93, 1093, 1119,   23,
+    10, 1103, 1120, 1118,   93, 1121, 1122, 1100,   10,  460, 1123, 1120,
+  1092, 1092, 1124, 1100,   10, 1125,    2, 1126, 1127,  179,  179, 1100,
+    10, 1128, 1129, 1098, 1130, 1130, 1131, 1067, 1084,  563,  122,  122,
+  1119, 1095,   23,   23, 1102, 1114,  122,  122, 1119, 1059,   23,   23,
+  1102, 1111,  122,  122, 1110, 1108,   23,   23,  335, 1109,  122, 1027,
+  1110, 1108,   23,   23,  335, 1109,  122, 1083, 1110, 1108,   23,   23,
+  1102, 1111, 1132, 1082, 1083, 1108,   23,   23, 1102, 1114, 1133, 1134,
+  1085,  491,   23,   23, 1102, 1114,  563,  528, 1086,  247,   23,   23,
+  1084, 1114,  563,  528, 1135,  177,   23,   23, 1084,  563,  563,  563,
+  1029, 1136,   23,   23, 1084,  563,  563, 1120, 1116, 1122,   23,   23,
+  1084,  563, 1120, 1118, 1137, 1138, 1119,   23, 1102,  563, 1120, 1118,
+    93, 1122, 1119, 1065,   10, 1123, 1123, 1120, 1092, 1092, 1124, 1065,
+   460, 1125, 1123, 1126, 1127, 1092, 1139, 1065, 1125, 1125, 1129, 1126,
+  1127, 1130, 1131, 1140, 1084, 1089, 1089,  122, 1141,   23,   23,   23,
+  1102,  563,  167,  122, 1141,   23,   23,   23, 1102,  118,  122,  122,
+  1142, 1059,   23,   23,  335, 1109,  122,  122, 1110, 1059,   23,   23,
+   335, 1109,  217,  122, 1110, 1143,   23,   23, 1102, 1111, 1132,  122,
+  1085, 1059,   23,   23, 1102, 1114, 1132,  122, 1085, 1059,   23,   23,
+  1084, 1114,  563, 1144, 1082,  229,   23,   23, 1084, 1114,  563,  528,
+   122,  229,   23,   23, 1084,  563,  563,  563, 1029, 1145,   23,   23,
+  1084,  563,  563, 1089, 1093, 1122,   23,   23, 1084,  563,  563, 1118,
+  1138, 1119, 1091,   23, 1102,  563, 1120, 1118, 1121, 1119, 1091, 1065,
+   460, 1146, 1120, 1120, 1092, 1122, 1147, 1065,  460,  460, 1123, 1148,
+  1148, 1092, 1147, 1065,  460,  460, 1129, 1126, 1126, 1149, 1150, 1140,
+  1084, 1089, 1089, 1082, 1151,  343,   23,   23, 1084, 1089,  167,  122,
+  1152,   23,   23,   23, 1102,  143,  167,  122, 1153,  236,   23,   23,
+   335, 1109,  122,  122, 1153, 1143,   23,   23,  335, 1109,  217,  122,
+   953, 1143, 1059,   23, 1102,  118,  167,  122,  166, 1143,   23,   23,
+  1102, 1114, 1132,  122,  166, 1059,   23,   23, 1084, 1114,  563,  122,
+   122, 1154,   23,   23, 1084,  563,  563,  122,  122, 1154,   23,   23,
+  1084,  563,  563,  167, 1093, 1095,   23,   23, 1084,  563,  563,  167,
+  1122, 1091,   23,   23, 1084,  563,  563, 1155, 1122, 1119, 1095,   23,
+  1103,  563,  563, 1118, 1122, 1119, 1095, 1065,  460, 1103,  563, 1120,
+  1092, 1119, 1095, 1065,  460,  460,  563, 1148, 1148, 1156, 1119, 1065,
+   460,  460,  461, 1148, 1148, 1157, 1156, 1140, 1090, 1089, 1158, 1159,
+  1160,  245,  343,   23, 1084, 1089, 1089, 1082,  272,  272,   23,   23,
+  1102, 1161,  167,  122, 1153,  272,   23,   23,  335, 1162,  122,  122,
+   953, 1163,   23,   23,  335, 1109,  217,   98,  953, 1163, 1143,   23,
+   335,  118,  167,  122,  953, 1143, 1059,   23, 1102,  118,  167,  122,
+   122, 1059, 1059,   23, 1084,  563,  378,  122,  122, 1154, 1059,   23,
+  1084,  563,  378,  122, 1093, 1081, 1059,   23, 1084,  563,  378,  122,
+  1122, 1095, 1059,   23, 1084,  563,  563, 1054, 1122, 1095, 1059,   23,
+  1084,  563,  563, 1164, 1119, 1091, 1095,   23, 1103, 1103,  563, 1164,
+  1119, 1091, 1095,   23, 1094, 1103,  563, 1165, 1119, 1119, 1095,   23,
+   460, 1094,  563,  563, 1166, 1119, 1119, 1065,  460, 1094, 1167,  563,
+  1168, 1169, 1119, 1140, 1103, 1089, 1158, 1159, 1160,  245,  343, 1170,
+  1084, 1089, 1089, 1082,  272,  272,   23, 1170, 1102, 1161,  167, 1082,
+  1153,  691,   23, 1170,  335,  234,  217,  122, 1153, 1143,   23, 1170,
+   335,   41, 1171,  122, 1060, 1143, 1143,   23,  335,  335,  167,  122,
+  1172, 1143, 1059,   23, 1102, 1173,  167,  122, 1027, 1059, 1059,   23,
+  1102,  378,  121,  122, 1027, 1081, 1059,   23, 1102,  563,  378,  122,
+  1093, 1081, 1059,   23, 1084,  563,  121, 1054, 1122, 1147,   23,   23,
+  1084, 1103,  121, 1054, 1122, 1095,   23,   23, 1084, 1103,  121, 1122,
+  1119, 1095,   23,   23, 1094, 1103,  563,  295, 1119, 1091, 1117,   23,
+   460, 1103,  563,  563, 1119, 1119, 1117,   23,  460, 1094,  563,  563,
+  1166, 1119, 1174,   23,  460,  460,  563,  563,  563, 1175, 1119, 1176,
+  1103, 1089, 1089, 1177,  247,  343, 1170, 1170, 1102, 1089, 1104, 1082,
+  1178,  343, 1170, 1170, 1102,  967,  122, 1082, 1179,  691,   23, 1170,
+   335,  335, 1171, 1082, 1179, 1180,   23, 1170,  335,   41, 1171, 1082,
+  1179, 1180, 1059,   23,  335,  335, 1162, 1027, 1027, 1143, 1059,   23,
+   335,  335, 1181, 1027, 1027, 1154, 1059,   23, 1102, 1182, 1183, 1027,
+  1027, 1081, 1059,   23, 1102, 1182,  121, 1054, 1027, 1081,   23,   23,
+  1102, 1182,  121, 1054, 1124, 1081,   23,   23,   10,  353, 1184, 1054,
+  1122, 1185,   23,   23,  460,  353, 1184, 1116, 1122, 1185,   23,   23,
+   460, 1103,  378, 1116, 1122, 1174,   23,   23,  460, 1146,  563, 1186,
+  1187, 1174, 1117,   23,  460, 1146,  562,  563, 1186, 1174, 1174,   23,
+   460,  562,  562,  562, 1120, 1188, 1174, 1176, 1103, 1089, 1189,  122,
+   177, 1190, 1170, 1170, 1102,  563, 1104, 1082,  990, 1191, 1170, 1170,
+  1102,  335,  122, 1027, 1027, 1192, 1170, 1170,  335,  335, 1193, 1027,
+  1027,  990,   23, 1170,  335, 1194, 1195, 1196, 1027,  990, 1059,   23,
+   335,  335, 1195, 1197, 1027,  990, 1059,   23,  335,  335, 1198, 1197,
+  1027, 1110, 1059,   23,  335, 1182, 1199, 1197, 1027, 1081,   23,   23,
+   335, 1182, 1200, 1197, 1027, 1081,   23,   23,   14, 1182, 1201, 1027,
+  1028,  488,   23,   23,   14, 1182, 1184, 1155, 1202, 1202,   23,   23,
+  1079, 1203, 1184, 1116, 1204, 1202,   23,   23,  460, 1079, 1184,   93,
+  1205, 1204,   23,   23,   10, 1146, 1206, 1186, 1205, 1204, 1185,   23,
+    10, 1146,  562, 1123, 1207, 1204, 1174,   23,   10,  562,  562, 1123,
+  1208, 1209, 1210, 1176, 1094,  563, 1189,  122, 1211, 1212, 1170, 1170,
+  1102,  563, 1104, 1054, 1027, 1213, 1170, 1170, 1102,  335, 1027, 1027,
+  1027, 1192, 1212, 1170,  335, 1214, 1195, 1197, 1027, 1192,  491, 1170,
+  1215, 1216, 1195, 1196, 1197, 1027, 1192,   23, 1215, 1214, 1195, 1197,
+  1197, 1083, 1154,   23, 1217, 1214, 1218, 1218, 1197, 1219,  491,   23,
+  1217, 1220, 1221, 1218, 1197, 1222,  491,   23,  335, 1223, 1199, 1218,
+  1197, 1081,  491,   23,   14, 1201, 1200, 1218, 1028,  488,  491,   23,
+    14,  344, 1201, 1224, 1056,  488,  258,   23, 1079,  344,  366, 1225,
+  1205, 1202,  258,   23, 1079, 1079, 1226, 1225, 1205, 1202,  258,   23,
+    10, 1146, 1227, 1228, 1205, 1229,  258,   23,   10, 1146, 1123, 1228,
+  1228, 1209, 1204,   23, 1102,  562, 1123, 1208, 1228, 1209, 1230, 1176,
+};
+
+}  // namespace generative
@@ -0,0 +1,29 @@
+#ifndef GENERATIVE_PATTERN_DICT_H_
+#define GENERATIVE_PATTERN_DICT_H_
+
+#include <stdint.h>
+
+#include "generative/pattern_index.h"
+
+// Deduplicated trigger masks of the pattern index grid, generated on the host
+// by host/pattern_dict.cpp (make pattern-dict) into pattern_dict.cc.
+//
+// Many grid cells render to the same 32-step mask, so every distinct mask is
+// stored once and each cell keeps a 16-bit index into the dictionary. A
+// channel's pattern is fetched with one indexed read instead of interpolating
+// the drum map for every step.
+
+namespace generative {
+
+extern const uint16_t kPatternDictSize;
+extern const uint32_t kPatternDict[];
+extern const uint16_t kPatternDictIndex[kIndexCells];
+
+// 32-step trigger mask of an index cell (bit N = step N fires)
+inline uint32_t PatternDictMask(uint16_t cell) {
+    return kPatternDict[kPatternDictIndex[cell]];
+}
+
+}  // namespace generative
+
+#endif  // GENERATIVE_PATTERN_DICT_H_
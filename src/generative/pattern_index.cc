@@ -0,0 +1,1675 @@
+// Pattern index of the Grids drum map.
+//
+// Automatically generated with:
+// make pattern-index
+//
+// 6144 cells, 25664 bytes of flash.
+
+#include "generative/pattern_index.h"
+
+namespace generative {
+
+const PatternIndexEntry kPatternIndex[kIndexCells] = {
+  {   16,   0,   0}, {  104,   0,   0}, {  112,   0,   0}, {  144,   0,   0},
+  {  240,   0,   0}, {  248,   0,   0}, {  272,   0,   0}, {  376,   0,   0},
+  { 2056,   0,   0}, { 2064,   0,   0}, { 2112,   0,   0}, { 2120,   0,   0},
+  { 2128,   0,   0}, { 2144,   0,   0}, { 2152,   0,   0}, { 2153,   0,   0},
+  { 2154,   0,   0}, { 2160,   0,   0}, { 2161,   0,   0}, { 2176,   0,   0},
+  { 2177,   0,   0}, { 2184,   0,   0}, { 2192,   0,   0}, { 2240,   0,   0},
+  { 2248,   0,   0}, { 2256,   0,   0}, { 2272,   0,   0}, { 2280,   0,   0},
+  { 2281,   0,   0}, { 2288,   0,   0}, { 2289,   0,   0}, { 2290,   0,   0},
+  { 2296,   0,   0}, { 2297,   0,   0}, { 2304,   0,   0}, { 2312,   0,   0},
+  { 2320,   0,   0}, { 2368,   0,   0}, { 2376,   0,   0}, { 2384,   0,   0},
+  { 2400,   0,   0}, { 2408,   0,   0}, { 2409,   0,   0}, { 2416,   0,   0},
+  { 2417,   0,   0}, { 2424,   0,   0}, { 2425,   0,   0}, { 2426,   0,   0},
+  { 2504,   0,   0}, { 2512,   0,   0}, { 2520,   0,   0}, { 2528,   0,   0},
+  { 2536,   0,   0}, { 2544,   0,   0}, { 2552,   0,   0}, { 2632,   0,   0},
+  { 2640,   0,   0}, { 2648,   0,   0}, { 2760,   0,   0}, { 2768,   0,   0},
+  { 2776,   0,   0}, { 2784,   0,   0}, { 2792,   0,   0}, { 2800,   0,   0},
+  { 2808,   0,   0}, { 2888,   0,   0}, { 2896,   0,   0}, { 2897,   0,   0},
+  { 2904,   0,   0}, { 2912,   0,   0}, { 2920,   0,   0}, { 2928,   0,   0},
+  { 2936,   0,   0}, { 3032,   0,   0}, { 3040,   0,   0}, { 3048,   0,   0},
+  { 3049,   0,   0}, { 3056,   0,   0}, { 3176,   0,   0}, { 3184,   0,   0},
+  { 3185,   0,   0}, { 3304,   0,   0}, { 3312,   0,   0}, { 3320,   0,   0},
+  { 3440,   0,   0}, { 3448,   0,   0}, { 4424,   0,   0}, { 4432,   0,   0},
+  { 4440,   0,   0}, { 4448,   0,   0}, { 4456,   0,   0}, { 4544,   0,   0},
+  { 4552,   0,   0}, { 4576,   0,   0}, { 4584,   0,   0}, { 4704,   0,   0},
+  { 4712,   0,   0}, { 4720,   0,   0}, { 4784,   0,   0}, { 4792,   0,   0},
+  { 4800,   0,   0}, { 4808,   0,   0}, { 4816,   0,   0}, { 4832,   0,   0},
+  { 4840,   0,   0}, { 4841,   0,   0}, { 4848,   0,   0}, { 4849,   0,   0},
+  { 4856,   0,   0}, { 4864,   0,   0}, { 4872,   0,   0}, { 4904,   0,   0},
+  { 4912,   0,   0}, { 4920,   0,   0}, { 4928,   0,   0}, { 4936,   0,   0},
+  { 4960,   0,   0}, { 4968,   0,   0}, { 4969,   0,   0}, { 4976,   0,   0},
+  { 4977,   0,   0}, { 4984,   0,   0}, { 5088,   0,   0}, { 5096,   0,   0},
+  { 5104,   0,   0}, { 5112,   0,   0}, { 5224,   0,   0}, { 5840,   0,   0},
+  { 5992,   0,   0}, { 6000,   0,   0}, { 6008,   0,   0}, { 6120,   0,   0},
+  { 6128,   0,   0}, {    0,   0,   0}, {    8,   0,   0}, {    9,   0,   0},
+  {  128,   0,   0}, {  129,   0,   0}, {  136,   0,   0}, {  256,   0,   0},
+  {  264,   0,   0}, { 2057,   0,   0}, { 2121,   0,   0}, { 2136,   0,   0},
+  { 2145,   0,   0}, { 2249,   0,   0}, { 2264,   0,   0}, { 2273,   0,   0},
+  { 2282,   0,   0}, { 2377,   0,   0}, { 2392,   0,   0}, { 2393,   0,   0},
+  { 2401,   0,   0}, { 2410,   0,   0}, { 2418,   0,   0}, { 2427,   0,   0},
+  { 2496,   0,   0}, { 2521,   0,   0}, { 2529,   0,   0}, { 2537,   0,   0},
+  { 2545,   0,   0}, { 2553,   0,   0}, { 2641,   0,   0}, { 2656,   0,   0},
+  { 2664,   0,   0}, { 2665,   0,   0}, { 2672,   0,   0}, { 2680,   0,   0},
+  { 2761,   0,   0}, { 2769,   0,   0}, { 2777,   0,   0}, { 2785,   0,   0},
+  { 2793,   0,   0}, { 2905,   0,   0}, { 2906,   0,   0}, { 2913,   0,   0},
+  { 2914,   0,   0}, { 2921,   0,   0}, { 2929,   0,   0}, { 2937,   0,   0},
+  { 3057,   0,   0}, { 3064,   0,   0}, { 4713,   0,   0}, { 4824,   0,   0},
+  { 4833,   0,   0}, { 4944,   0,   0}, { 4945,   0,   0}, { 4952,   0,   0},
+  { 4953,   0,   0}, { 4992,   0,   0}, { 5000,   0,   0}, { 5008,   0,   0},
+  { 5032,   0,   0}, { 5040,   0,   0}, { 5048,   0,   0}, { 5056,   0,   0},
+  { 5080,   0,   0}, { 5097,   0,   0}, { 5128,   0,   0}, { 5136,   0,   0},
+  { 5160,   0,   0}, { 5168,   0,   0}, { 5176,   0,   0}, { 5216,   0,   0},
+  { 5232,   0,   0}, { 5256,   0,   0}, { 5264,   0,   0}, { 5288,   0,   0},
+  { 5296,   0,   0}, { 5344,   0,   0}, { 5352,   0,   0}, { 5360,   0,   0},
+  { 5361,   0,   0}, { 5368,   0,   0}, { 5369,   0,   0}, { 5392,   0,   0},
+  { 5416,   0,   0}, { 5424,   0,   0}, { 5480,   0,   0}, { 5488,   0,   0},
+  { 5489,   0,   0}, { 5496,   0,   0}, { 5497,   0,   0}, { 5520,   0,   0},
+  { 5552,   0,   0}, { 5616,   0,   0}, { 5624,   0,   0}, { 5648,   0,   0},
+  { 5680,   0,   0}, { 5688,   0,   0}, { 5696,   0,   0}, { 5736,   0,   0},
+  { 5744,   0,   0}, { 5752,   0,   0}, { 5753,   0,   0}, { 5768,   0,   0},
+  { 5776,   0,   0}, { 5816,   0,   0}, { 5824,   0,   0}, { 5832,   0,   0},
+  { 5848,   0,   0}, { 5856,   0,   0}, { 5864,   0,   0}, { 5872,   0,   0},
+  { 5880,   0,   0}, { 5896,   0,   0}, { 5904,   0,   0}, { 5984,   0,   0},
+  { 6024,   0,   0}, { 6032,   0,   0}, { 6136,   0,   0}, { 2122,   0,   0},
+  { 2129,   0,   0}, { 2130,   0,   0}, { 2131,   0,   0}, { 2137,   0,   0},
+  { 2250,   0,   0}, { 2257,   0,   0}, { 2258,   0,   0}, { 2259,   0,   0},
+  { 2265,   0,   0}, { 2266,   0,   0}, { 2274,   0,   0}, { 2275,   0,   0},
+  { 2283,   0,   0}, { 2378,   0,   0}, { 2385,   0,   0}, { 2386,   0,   0},
+  { 2387,   0,   0}, { 2394,   0,   0}, { 2395,   0,   0}, { 2402,   0,   0},
+  { 2403,   0,   0}, { 2411,   0,   0}, { 2419,   0,   0}, { 2505,   0,   0},
+  { 2506,   0,   0}, { 2513,   0,   0}, { 2514,   0,   0}, { 2538,   0,   0},
+  { 2546,   0,   0}, { 2554,   0,   0}, { 2633,   0,   0}, { 2649,   0,   0},
+  { 2657,   0,   0}, { 2673,   0,   0}, { 2674,   0,   0}, { 2681,   0,   0},
+  { 2770,   0,   0}, { 2778,   0,   0}, { 2786,   0,   0}, { 2794,   0,   0},
+  { 2801,   0,   0}, { 2802,   0,   0}, { 2809,   0,   0}, { 2922,   0,   0},
+  { 2930,   0,   0}, { 4913,   0,   0}, { 4921,   0,   0}, { 4922,   0,   0},
+  { 4929,   0,   0}, { 4930,   0,   0}, { 4937,   0,   0}, { 4961,   0,   0},
+  { 4962,   0,   0}, { 4970,   0,   0}, { 5041,   0,   0}, { 5049,   0,   0},
+  { 5057,   0,   0}, { 5064,   0,   0}, { 5065,   0,   0}, { 5072,   0,   0},
+  { 5120,   0,   0}, { 5184,   0,   0}, { 5192,   0,   0}, { 5200,   0,   0},
+  { 5208,   0,   0}, { 5248,   0,   0}, { 5304,   0,   0}, { 5312,   0,   0},
+  { 5320,   0,   0}, { 5328,   0,   0}, { 5336,   0,   0}, { 5353,   0,   0},
+  { 5376,   0,   0}, { 5384,   0,   0}, { 5432,   0,   0}, { 5440,   0,   0},
+  { 5448,   0,   0}, { 5456,   0,   0}, { 5464,   0,   0}, { 5498,   0,   0},
+  { 5512,   0,   0}, { 5560,   0,   0}, { 5568,   0,   0}, { 5576,   0,   0},
+  { 5584,   0,   0}, { 5592,   0,   0}, { 5608,   0,   0}, { 5617,   0,   0},
+  { 5625,   0,   0}, { 5640,   0,   0}, { 5704,   0,   0}, { 5712,   0,   0},
+  { 5720,   0,   0}, { 5728,   0,   0}, { 5745,   0,   0}, { 5865,   0,   0},
+  { 5873,   0,   0}, { 5993,   0,   0}, { 6001,   0,   0}, { 6016,   0,   0},
+  { 6121,   0,   0}, { 6129,   0,   0}, { 2522,   0,   0}, { 2530,   0,   0},
+  { 2642,   0,   0}, { 2666,   0,   0}, { 2779,   0,   0}, { 2787,   0,   0},
+  { 2795,   0,   0}, { 4993,   0,   0}, { 5050,   0,   0}, { 5073,   0,   0},
+  { 5081,   0,   0}, { 5089,   0,   0}, { 5129,   0,   0}, { 5169,   0,   0},
+  { 5177,   0,   0}, { 5185,   0,   0}, { 5297,   0,   0}, { 5305,   0,   0},
+  { 5313,   0,   0}, { 5425,   0,   0}, { 5433,   0,   0}, { 5472,   0,   0},
+  { 5481,   0,   0}, { 5600,   0,   0}, { 5601,   0,   0}, { 5609,   0,   0},
+  { 5626,   0,   0}, { 5632,   0,   0}, { 5713,   0,   0}, { 5721,   0,   0},
+  { 5729,   0,   0}, { 5737,   0,   0}, { 5760,   0,   0}, { 5857,   0,   0},
+  { 5874,   0,   0}, { 5881,   0,   0}, { 5882,   0,   0}, { 5883,   0,   0},
+  { 5888,   0,   0}, { 6002,   0,   0}, { 6009,   0,   0}, { 6010,   0,   0},
+  { 6137,   0,   0}, {  386,   0,  63}, {  513,   0,  63}, { 1683,   0,  63},
+  { 1691,   0,  63}, { 1698,   0,  63}, { 1699,   0,  63}, { 1707,   0,  63},
+  { 1819,   0,  63}, { 1826,   0,  63}, { 1827,   0,  63}, { 1835,   0,  63},
+  { 1947,   0,  63}, { 1954,   0,  63}, { 1955,   0,  63}, { 2523,   0,   0},
+  { 2531,   0,   0}, { 2650,   0,   0}, { 2651,   0,   0}, { 2658,   0,   0},
+  { 2916,   0,  63}, { 2924,   0,  63}, { 3035,   0,  63}, { 3036,   0,  63},
+  { 3043,   0,  63}, { 3044,   0,  63}, { 3171,   0,  63}, { 3172,   0,  63},
+  { 3179,   0,  63}, { 4946,   0,  63}, { 4954,   0,  63}, { 5042,   0,  63},
+  { 5058,   0,   0}, { 5066,   0,   0}, { 5067,   0,   0}, { 5074,   0,   0},
+  { 5082,   0,   0}, { 5121,   0,   0}, { 5178,   0,   0}, { 5186,   0,   0},
+  { 5193,   0,   0}, { 5194,   0,   0}, { 5195,   0,   0}, { 5201,   0,   0},
+  { 5202,   0,   0}, { 5209,   0,   0}, { 5217,   0,   0}, { 5257,   0,   0},
+  { 5265,   0,  63}, { 5306,   0,   0}, { 5314,   0,   0}, { 5321,   0,   0},
+  { 5322,   0,   0}, { 5323,   0,   0}, { 5329,   0,   0}, { 5330,   0,   0},
+  { 5337,   0,   0}, { 5338,   0,   0}, { 5345,   0,   0}, { 5417,   0,  63},
+  { 5434,   0,   0}, { 5441,   0,   0}, { 5442,   0,   0}, { 5449,   0,   0},
+  { 5450,   0,   0}, { 5457,   0,   0}, { 5458,   0,   0}, { 5465,   0,   0},
+  { 5466,   0,   0}, { 5473,   0,   0}, { 5474,   0,   0}, { 5482,   0,   0},
+  { 5490,   0,   0}, { 5504,   0,  63}, { 5521,   0,  63}, { 5545,   0,  63},
+  { 5553,   0,  63}, { 5561,   0,   0}, { 5569,   0,   0}, { 5577,   0,   0},
+  { 5585,   0,   0}, { 5586,   0,   0}, { 5593,   0,   0}, { 5594,   0,   0},
+  { 5602,   0,   0}, { 5610,   0,   0}, { 5618,   0,   0}, { 5619,   0,   0},
+  { 5627,   0,   0}, { 5649,   0,  63}, { 5697,   0,   0}, { 5705,   0,   0},
+  { 5730,   0,   0}, { 5738,   0,   0}, { 5739,   0,   0}, { 5746,   0,   0},
+  { 5747,   0,   0}, { 5754,   0,   0}, { 5755,   0,   0}, { 5756,   0,   0},
+  { 5841,   0,  63}, { 5849,   0,  63}, { 5866,   0,   0}, { 5875,   0,   0},
+  { 5897,   0,   0}, { 5994,   0,  63}, { 6017,   0,   0}, { 6025,   0,   0},
+  { 6081,   0,  63}, { 1410,   0,  51}, { 1547,   0,  51}, { 1828,   0,  51},
+  { 2132,   0,  51}, { 2140,   0,  51}, { 2147,   0,  51}, { 2148,   0,  51},
+  { 2276,   0,  51}, { 2908,   0,  51}, { 3045,   0,  51}, { 4939,   0,  51},
+  { 4947,   0,  51}, { 4955,   0,  51}, { 5075,   0,  51}, { 5090,   0,   0},
+  { 5099,   0,   0}, { 5170,   0,  51}, { 5203,   0,   0}, { 5210,   0,   0},
+  { 5218,   0,   0}, { 5227,   0,   0}, { 5249,   0,  51}, { 5250,   0,  51},
+  { 5331,   0,  51}, { 5346,   0,   0}, { 5354,   0,   0}, { 5355,   0,   0},
+  { 5377,   0,  51}, { 5378,   0,  51}, { 5385,   0,  51}, { 5483,   0,   0},
+  { 5505,   0,  51}, { 5513,   0,  51}, { 5514,   0,  51}, { 5562,   0,  51},
+  { 5570,   0,  51}, { 5578,   0,  51}, { 5611,   0,  51}, { 5633,   0,  51},
+  { 5641,   0,  51}, { 5642,   0,  51}, { 5689,   0,  51}, { 5698,   0,  51},
+  { 5761,   0,  51}, { 5762,   0,  51}, { 5769,   0,  51}, { 5858,   0,  51},
+  { 5884,   0,   0}, { 5889,   0,  51}, { 5083,   0,  42}, { 5091,   0,  42},
+  { 5211,   0,  42}, { 5219,   0,  42}, { 5339,   0,  42}, { 5347,   0,  42},
+  { 5363,   0,  42}, { 5364,   0,  42}, { 5475,   0,  42}, { 5491,   0,  42},
+  { 5492,   0,  42}, { 5499,   0,  42}, { 5500,   0,  42}, { 5628,   0,  42},
+  { 5867,   0,  42}, { 5876,   0,  42}, { 5995,   0,  42}, { 2141,   0,  36},
+  { 2149,   0,  36}, { 5620,   0,  36}, { 5748,   0,  36}, {  390,   0,  63},
+  {  517,   0,  63}, { 1941,   0,  63}, { 2126,   0,  63}, { 3133,   0,  63},
+  { 3141,   0,  63}, { 5188,   0,  63}, { 5212,   0,  63}, { 5501,   0,  63},
+  { 1845,   0,  56}, { 5757,   0,  56}, { 2278,   0,  46}, { 3278,   0,  63},
+  { 6014,   0,  63}, { 2181,   0,  58}, {   47,   0,  63}, {   55,   0,  63},
+  {   63,   0,  63}, {  175,   0,  63}, {  183,   0,  63}, {  191,   0,  63},
+  {  311,   0,  63}, {  319,   0,  63}, {  447,   0,  63}, {  567,   0,  63},
+  {  575,   0,  63}, {  583,   0,  63}, {  591,   0,  63}, {  687,   0,  63},
+  {  695,   0,  63}, {  703,   0,  63}, {  711,   0,  63}, {  719,   0,  63},
+  {  727,   0,  63}, {  815,   0,  63}, {  823,   0,  63}, {  831,   0,  63},
+  {  839,   0,  63}, {  847,   0,  63}, {  855,   0,  63}, {  863,   0,  63},
+  {  943,   0,  63}, {  951,   0,  63}, {  959,   0,  63}, {  967,   0,  63},
+  {  975,   0,  63}, {  983,   0,  63}, {  991,   0,  63}, { 1031,   0,  63},
+  { 1039,   0,  63}, { 1047,   0,  63}, { 1063,   0,  63}, { 1071,   0,  63},
+  { 1079,   0,  63}, { 1087,   0,  63}, { 1095,   0,  63}, { 1103,   0,  63},
+  { 1111,   0,  63}, { 1119,   0,  63}, { 1159,   0,  63}, { 1167,   0,  63},
+  { 1175,   0,  63}, { 1183,   0,  63}, { 1191,   0,  63}, { 1199,   0,  63},
+  { 1207,   0,  63}, { 1215,   0,  63}, { 1223,   0,  63}, { 1231,   0,  63},
+  { 1239,   0,  63}, { 1247,   0,  63}, { 1255,   0,  63}, { 1263,   0,  63},
+  { 1287,   0,  63}, { 1295,   0,  63}, { 1303,   0,  63}, { 1311,   0,  63},
+  { 1319,   0,  63}, { 1327,   0,  63}, { 1335,   0,  63}, { 1343,   0,  63},
+  { 1351,   0,  63}, { 1359,   0,  63}, { 1367,   0,  63}, { 1375,   0,  63},
+  { 1383,   0,  63}, { 1391,   0,  63}, { 1399,   0,  63}, { 1415,   0,  63},
+  { 1423,   0,  63}, { 1431,   0,  63}, { 1439,   0,  63}, { 1447,   0,  63},
+  { 1455,   0,  63}, { 1463,   0,  63}, { 1471,   0,  63}, { 1479,   0,  63},
+  { 1487,   0,  63}, { 1495,   0,  63}, { 1503,   0,  63}, { 1511,   0,  63},
+  { 1519,   0,  63}, { 1527,   0,  63}, { 1575,   0,  63}, { 1583,   0,  63},
+  { 1591,   0,  63}, { 1599,   0,  63}, { 1607,   0,  63}, { 1615,   0,  63},
+  { 1622,   0,  63}, { 1623,   0,  63}, { 1631,   0,  63}, { 1639,   0,  63},
+  { 1647,   0,  63}, { 1655,   0,  63}, { 1703,   0,  63}, { 1711,   0,  63},
+  { 1719,   0,  63}, { 1727,   0,  63}, { 1735,   0,  63}, { 1743,   0,  63},
+  { 1751,   0,  63}, { 1759,   0,  63}, { 1767,   0,  63}, { 1775,   0,  63},
+  { 1783,   0,  63}, { 1831,   0,  63}, { 1839,   0,  63}, { 1846,   0,  63},
+  { 1847,   0,  63}, { 1855,   0,  63}, { 1863,   0,  63}, { 1871,   0,  63},
+  { 1879,   0,  63}, { 1887,   0,  63}, { 1895,   0,  63}, { 1903,   0,  63},
+  { 1911,   0,  63}, { 1959,   0,  63}, { 1967,   0,  63}, { 1975,   0,  63},
+  { 1983,   0,  63}, { 1991,   0,  63}, { 2183,   0,  63}, { 2198,   0,  63},
+  { 2215,   0,  63}, { 2294,   0,  63}, { 2302,   0,  63}, { 2311,   0,  63},
+  { 2422,   0,  63}, { 2439,   0,  63}, { 2575,   0,  63}, { 2583,   0,  63},
+  { 2591,   0,  63}, { 2703,   0,  63}, { 2711,   0,  63}, { 2719,   0,  63},
+  { 2759,   0,  63}, { 2767,   0,  63}, { 2831,   0,  63}, { 2839,   0,  63},
+  { 2847,   0,  63}, { 2887,   0,  63}, { 2895,   0,  63}, { 2903,   0,  63},
+  { 2959,   0,  63}, { 2967,   0,  63}, { 3023,   0,  63}, { 3031,   0,  63},
+  { 3079,   0,  63}, { 3087,   0,  63}, { 3095,   0,  63}, { 3111,   0,  63},
+  { 3119,   0,  63}, { 3127,   0,  63}, { 3143,   0,  63}, { 3151,   0,  63},
+  { 3159,   0,  63}, { 3167,   0,  63}, { 3207,   0,  63}, { 3215,   0,  63},
+  { 3223,   0,  63}, { 3231,   0,  63}, { 3239,   0,  63}, { 3247,   0,  63},
+  { 3255,   0,  63}, { 3263,   0,  63}, { 3271,   0,  63}, { 3279,   0,  63},
+  { 3287,   0,  63}, { 3295,   0,  63}, { 3335,   0,  63}, { 3343,   0,  63},
+  { 3351,   0,  63}, { 3359,   0,  63}, { 3367,   0,  63}, { 3375,   0,  63},
+  { 3383,   0,  63}, { 3391,   0,  63}, { 3399,   0,  63}, { 3407,   0,  63},
+  { 3415,   0,  63}, { 3423,   0,  63}, { 3463,   0,  63}, { 3471,   0,  63},
+  { 3479,   0,  63}, { 3487,   0,  63}, { 3495,   0,  63}, { 3503,   0,  63},
+  { 3511,   0,  63}, { 3519,   0,  63}, { 3527,   0,  63}, { 3535,   0,  63},
+  { 3543,   0,  63}, { 3551,   0,  63}, { 3623,   0,  63}, { 3631,   0,  63},
+  { 3639,   0,  63}, { 3647,   0,  63}, { 3655,   0,  63}, { 3663,   0,  63},
+  { 3671,   0,  63}, { 3679,   0,  63}, { 3687,   0,  63}, { 3695,   0,  63},
+  { 3703,   0,  63}, { 3751,   0,  63}, { 3759,   0,  63}, { 3767,   0,  63},
+  { 3775,   0,  63}, { 3783,   0,  63}, { 3791,   0,  63}, { 3799,   0,  63},
+  { 3807,   0,  63}, { 3815,   0,  63}, { 3823,   0,  63}, { 3831,   0,  63},
+  { 3879,   0,  63}, { 3887,   0,  63}, { 3895,   0,  63}, { 3903,   0,  63},
+  { 3911,   0,  63}, { 3919,   0,  63}, { 3927,   0,  63}, { 3935,   0,  63},
+  { 3943,   0,  63}, { 3951,   0,  63}, { 3959,   0,  63}, { 4007,   0,  63},
+  { 4015,   0,  63}, { 4023,   0,  63}, { 4031,   0,  63}, { 4039,   0,  63},
+  { 4047,   0,  63}, { 4205,   0,  63}, { 4214,   0,  63}, { 4231,   0,  63},
+  { 4359,   0,  63}, { 4487,   0,  63}, { 4582,   0,  63}, { 4615,   0,  63},
+  { 4623,   0,  63}, { 4631,   0,  63}, { 4639,   0,  63}, { 4647,   0,  63},
+  { 4655,   0,  63}, { 4663,   0,  63}, { 4671,   0,  63}, { 4679,   0,  63},
+  { 4687,   0,  63}, { 4695,   0,  63}, { 4711,   0,  63}, { 4719,   0,  63},
+  { 4743,   0,  63}, { 4751,   0,  63}, { 4758,   0,  63}, { 4759,   0,  63},
+  { 4766,   0,  63}, { 4767,   0,  63}, { 4775,   0,  63}, { 4783,   0,  63},
+  { 4791,   0,  63}, { 4799,   0,  63}, { 4807,   0,  63}, { 4815,   0,  63},
+  { 4823,   0,  63}, { 4831,   0,  63}, { 4871,   0,  63}, { 4879,   0,  63},
+  { 4886,   0,  63}, { 4887,   0,  63}, { 4894,   0,  63}, { 4895,   0,  63},
+  { 4903,   0,  63}, { 4911,   0,  63}, { 4918,   0,  63}, { 4919,   0,  63},
+  { 4927,   0,  63}, { 4935,   0,  63}, { 4942,   0,  63}, { 4943,   0,  63},
+  { 4951,   0,  63}, { 4959,   0,  63}, { 4983,   0,  63}, { 4999,   0,  63},
+  { 5007,   0,  63}, { 5014,   0,  63}, { 5015,   0,  63}, { 5022,   0,  63},
+  { 5023,   0,  63}, { 5031,   0,  63}, { 5038,   0,  63}, { 5039,   0,  63},
+  { 5046,   0,  63}, { 5047,   0,  63}, { 5054,   0,  63}, { 5055,   0,  63},
+  { 5063,   0,  63}, { 5070,   0,  63}, { 5071,   0,  63}, { 5079,   0,  63},
+  { 5087,   0,  63}, { 5095,   0,  63}, { 5103,   0,  63}, { 5111,   0,  63},
+  { 5126,   0,  63}, { 5127,   0,  63}, { 5134,   0,  63}, { 5135,   0,  63},
+  { 5142,   0,  63}, { 5143,   0,  63}, { 5150,   0,  63}, { 5151,   0,  63},
+  { 5158,   0,  63}, { 5159,   0,  63}, { 5166,   0,  63}, { 5167,   0,  63},
+  { 5174,   0,  63}, { 5175,   0,  63}, { 5182,   0,  63}, { 5183,   0,  63},
+  { 5190,   0,  63}, { 5191,   0,  63}, { 5198,   0,  63}, { 5199,   0,  63},
+  { 5206,   0,  63}, { 5207,   0,  63}, { 5215,   0,  63}, { 5253,   0,  63},
+  { 5254,   0,  63}, { 5255,   0,  63}, { 5261,   0,  63}, { 5262,   0,  63},
+  { 5263,   0,  63}, { 5270,   0,  63}, { 5271,   0,  63}, { 5278,   0,  63},
+  { 5279,   0,  63}, { 5286,   0,  63}, { 5287,   0,  63}, { 5294,   0,  63},
+  { 5295,   0,  63}, { 5302,   0,  63}, { 5303,   0,  63}, { 5310,   0,  63},
+  { 5311,   0,  63}, { 5318,   0,  63}, { 5319,   0,  63}, { 5326,   0,  63},
+  { 5327,   0,  63}, { 5334,   0,  63}, { 5335,   0,  63}, { 5343,   0,  63},
+  { 5382,   0,  63}, { 5383,   0,  63}, { 5389,   0,  63}, { 5390,   0,  63},
+  { 5391,   0,  63}, { 5398,   0,  63}, { 5399,   0,  63}, { 5406,   0,  63},
+  { 5407,   0,  63}, { 5415,   0,  63}, { 5422,   0,  63}, { 5423,   0,  63},
+  { 5430,   0,  63}, { 5431,   0,  63}, { 5438,   0,  63}, { 5439,   0,  63},
+  { 5446,   0,  63}, { 5447,   0,  63}, { 5454,   0,  63}, { 5455,   0,  63},
+  { 5462,   0,  63}, { 5463,   0,  63}, { 5471,   0,  63}, { 5511,   0,  63},
+  { 5518,   0,  63}, { 5519,   0,  63}, { 5526,   0,  63}, { 5527,   0,  63},
+  { 5534,   0,  63}, { 5535,   0,  63}, { 5543,   0,  63}, { 5551,   0,  63},
+  { 5559,   0,  63}, { 5567,   0,  63}, { 5575,   0,  63}, { 5583,   0,  63},
+  { 5591,   0,  63}, { 5599,   0,  63}, { 5607,   0,  63}, { 5615,   0,  63},
+  { 5646,   0,  63}, { 5654,   0,  63}, { 5662,   0,  63}, { 5671,   0,  63},
+  { 5679,   0,  63}, { 5687,   0,  63}, { 5695,   0,  63}, { 5703,   0,  63},
+  { 5710,   0,  63}, { 5711,   0,  63}, { 5718,   0,  63}, { 5719,   0,  63},
+  { 5726,   0,  63}, { 5727,   0,  63}, { 5735,   0,  63}, { 5743,   0,  63},
+  { 5751,   0,  63}, { 5782,   0,  63}, { 5790,   0,  63}, { 5799,   0,  63},
+  { 5807,   0,  63}, { 5815,   0,  63}, { 5823,   0,  63}, { 5830,   0,  63},
+  { 5831,   0,  63}, { 5838,   0,  63}, { 5839,   0,  63}, { 5846,   0,  63},
+  { 5847,   0,  63}, { 5854,   0,  63}, { 5855,   0,  63}, { 5862,   0,  63},
+  { 5863,   0,  63}, { 5871,   0,  63}, { 5879,   0,  63}, { 5918,   0,  63},
+  { 5927,   0,  63}, { 5935,   0,  63}, { 5943,   0,  63}, { 5950,   0,  63},
+  { 5951,   0,  63}, { 5958,   0,  63}, { 5959,   0,  63}, { 5966,   0,  63},
+  { 5967,   0,  63}, { 5974,   0,  63}, { 5975,   0,  63}, { 5982,   0,  63},
+  { 5983,   0,  63}, { 5990,   0,  63}, { 5991,   0,  63}, { 5999,   0,  63},
+  { 6007,   0,  63}, { 6055,   0,  63}, { 6063,   0,  63}, { 6071,   0,  63},
+  { 6079,   0,  63}, { 6087,   0,  63}, { 6095,   0,  63}, { 6103,   0,  63},
+  { 6111,   0,  63}, { 6119,   0,  63}, { 6127,   0,  63}, { 6135,   0,  63},
+  {   95,   0,  60}, {  223,   0,  60}, {  343,   0,  60}, {  351,   0,  60},
+  {  455,   0,  60}, {  463,   0,  60}, {  471,   0,  60}, {  479,   0,  60},
+  { 2223,   0,  60}, { 2286,   0,  60}, { 2343,   0,  60}, { 2351,   0,  60},
+  { 2359,   0,  60}, { 2471,   0,  60}, { 2479,   0,  60}, { 2487,   0,  60},
+  { 3559,   0,  60}, { 3567,   0,  60}, { 4111,   0,  60}, { 4119,   0,  60},
+  { 4127,   0,  60}, { 4342,   0,  60}, { 4727,   0,  60}, { 4839,   0,  60},
+  { 4847,   0,  60}, { 4855,   0,  60}, { 4967,   0,  60}, { 4975,   0,  60},
+  { 5223,   0,  60}, { 5231,   0,  60}, { 5239,   0,  60}, { 5351,   0,  60},
+  { 5359,   0,  60}, { 5367,   0,  60}, { 5479,   0,  60}, { 5487,   0,  60},
+  { 5495,   0,  60}, { 5623,   0,  60}, { 6020,   0,  60}, {   71,   0,  56},
+  {   79,   0,  56}, {   87,   0,  56}, {  199,   0,  56}, {  207,   0,  56},
+  {  215,   0,  56}, {  327,   0,  56}, {  335,   0,  56}, { 1543,   0,  56},
+  { 1551,   0,  56}, { 1559,   0,  56}, { 1567,   0,  56}, { 1671,   0,  56},
+  { 1679,   0,  56}, { 1687,   0,  56}, { 1695,   0,  56}, { 1799,   0,  56},
+  { 1807,   0,  56}, { 1815,   0,  56}, { 1823,   0,  56}, { 2063,   0,  56},
+  { 2071,   0,  56}, { 2079,   0,  56}, { 2191,   0,  56}, { 2199,   0,  56},
+  { 2207,   0,  56}, { 2319,   0,  56}, { 2327,   0,  56}, { 2335,   0,  56},
+  { 2447,   0,  56}, { 2455,   0,  56}, { 2463,   0,  56}, { 4430,   0,  56},
+  { 4446,   0,  56}, { 4462,   0,  56}, { 4479,   0,  56}, { 4543,   0,  56},
+  { 6029,   0,  56}, { 3175,   0,  53}, { 3183,   0,  53}, { 3303,   0,  53},
+  { 3311,   0,  53}, { 3319,   0,  53}, { 3431,   0,  53}, { 3439,   0,  53},
+  { 3447,   0,  53}, { 3575,   0,  53}, { 3591,   0,  53}, { 3599,   0,  53},
+  { 3607,   0,  53}, { 3615,   0,  53}, { 3719,   0,  53}, { 3727,   0,  53},
+  { 3735,   0,  53}, { 3743,   0,  53}, { 3847,   0,  53}, { 3855,   0,  53},
+  { 3863,   0,  53}, { 3871,   0,  53}, { 4206,   0,  53}, { 4223,   0,  53},
+  { 4239,   0,  53}, { 4247,   0,  53}, { 4255,   0,  53}, { 4263,   0,  53},
+  { 4271,   0,  53}, { 4279,   0,  53}, { 4287,   0,  53}, { 4351,   0,  53},
+  { 4367,   0,  53}, { 4375,   0,  53}, { 4383,   0,  53}, { 4391,   0,  53},
+  { 4399,   0,  53}, { 4407,   0,  53}, { 4415,   0,  53}, { 4438,   0,  53},
+  { 4495,   0,  53}, { 4503,   0,  53}, { 4511,   0,  53}, { 4519,   0,  53},
+  { 4527,   0,  53}, { 4535,   0,  53}, { 5893,   0,  53}, { 2303,   0,  51},
+  { 2431,   0,  51}, { 2559,   0,  51}, { 4326,   0,  51}, { 4334,   0,  51},
+  { 4454,   0,  51}, { 6021,   0,  51}, { 6038,   0,  51}, { 5639,   0,  48},
+  { 5647,   0,  48}, { 5655,   0,  48}, { 5663,   0,  48}, { 5766,   0,  48},
+  { 5767,   0,  48}, { 5774,   0,  48}, { 5775,   0,  48}, { 5783,   0,  48},
+  { 5791,   0,  48}, { 5894,   0,  48}, { 5895,   0,  48}, { 5902,   0,  48},
+  { 5903,   0,  48}, { 5910,   0,  48}, { 5911,   0,  48}, { 5919,   0,  48},
+  { 6022,   0,  48}, { 6023,   0,  48}, { 6030,   0,  48}, { 6031,   0,  48},
+  { 6039,   0,  48}, { 6047,   0,  48}, { 4199,   0,  46}, { 4207,   0,  46},
+  { 4215,   0,  46}, { 4343,   0,  44}, { 2279,   0,  42}, { 2407,   0,  42},
+  { 2535,   0,  42}, { 4295,   0,  42}, { 4303,   0,  42}, { 4311,   0,  42},
+  { 4319,   0,  42}, { 4327,   0,  42}, { 4335,   0,  42}, { 4423,   0,  42},
+  { 4431,   0,  42}, { 4439,   0,  42}, { 4447,   0,  42}, { 4455,   0,  42},
+  { 4463,   0,  42}, { 4471,   0,  42}, { 4551,   0,  42}, { 4559,   0,  42},
+  { 4567,   0,  42}, { 4575,   0,  42}, { 4583,   0,  42}, { 4591,   0,  42},
+  { 4599,   0,  42}, { 2287,   0,  40}, { 2543,   0,  40}, { 2295,   0,  39},
+  { 2415,   0,  39}, { 2423,   0,  39}, { 2551,   0,  39}, {   17,   0, 127},
+  {   25,   0, 127}, {  137,   0, 127}, {  145,   0, 127}, {  257,   0, 127},
+  {  265,   0, 127}, {  273,   0, 127}, {  384,   0, 127}, {  393,   0, 127},
+  {  512,   0, 127}, {  640,   0, 127}, {  897,   0, 127}, { 1025,   0, 127},
+  { 1152,   0, 127}, { 1153,   0, 127}, { 1170,   0, 127}, { 1280,   0, 127},
+  { 1281,   0, 127}, { 1289,   0, 127}, { 1298,   0, 127}, { 1306,   0, 127},
+  { 1408,   0, 127}, { 1425,   0, 127}, { 1433,   0, 127}, { 1545,   0, 127},
+  { 1553,   0, 127}, { 1554,   0, 127}, { 1568,   0, 127}, { 1665,   0, 127},
+  { 1673,   0, 127}, { 1674,   0, 127}, { 1681,   0, 127}, { 1682,   0, 127},
+  { 1696,   0, 127}, { 1697,   0, 127}, { 1801,   0, 127}, { 1809,   0, 127},
+  { 1810,   0, 127}, { 1825,   0, 127}, { 1842,   0, 127}, { 1866,   0, 127},
+  { 1874,   0, 127}, { 1882,   0, 127}, { 1953,   0, 127}, { 1969,   0, 127},
+  { 1970,   0, 127}, { 1977,   0, 127}, { 1984,   0, 127}, { 1985,   0, 127},
+  { 1993,   0, 127}, { 2001,   0, 127}, { 2049,   0, 127}, { 2065,   0, 127},
+  { 2066,   0, 127}, { 2098,   0, 127}, { 2106,   0, 127}, { 2113,   0, 127},
+  { 2114,   0, 127}, { 2186,   0, 127}, { 2226,   0, 127}, { 2233,   0, 127},
+  { 2234,   0, 127}, { 2241,   0, 127}, { 2242,   0, 127}, { 2353,   0, 127},
+  { 2361,   0, 127}, { 2362,   0, 127}, { 2369,   0, 127}, { 2481,   0, 127},
+  { 2488,   0, 127}, { 2489,   0, 127}, { 2497,   0, 127}, { 2609,   0, 127},
+  { 2616,   0, 127}, { 2617,   0, 127}, { 2624,   0, 127}, { 2745,   0, 127},
+  { 2753,   0, 127}, { 2881,   0, 127}, { 3033,   0, 127}, { 3034,   0, 127},
+  { 3041,   0, 127}, { 3042,   0, 127}, { 3161,   0, 127}, { 3170,   0, 127},
+  { 3178,   0, 127}, { 3290,   0, 127}, { 3298,   0, 127}, { 3307,   0, 127},
+  { 4128,   0, 127}, { 4129,   0, 127}, { 4136,   0, 127}, { 4137,   0, 127},
+  { 4138,   0, 127}, { 4144,   0, 127}, { 4145,   0, 127}, { 4146,   0, 127},
+  { 4152,   0, 127}, { 4153,   0, 127}, { 4160,   0, 127}, { 4168,   0, 127},
+  { 4257,   0, 127}, { 4264,   0, 127}, { 4265,   0, 127}, { 4266,   0, 127},
+  { 4272,   0, 127}, { 4273,   0, 127}, { 4274,   0, 127}, { 4275,   0, 127},
+  { 4280,   0, 127}, { 4281,   0, 127}, { 4282,   0, 127}, { 4289,   0, 127},
+  { 4290,   0, 127}, { 4297,   0, 127}, { 4298,   0, 127}, { 4393,   0, 127},
+  { 4401,   0, 127}, { 4409,   0, 127}, { 4410,   0, 127}, { 4417,   0, 127},
+  { 4418,   0, 127}, { 4569,   0, 127}, { 4577,   0, 127}, { 4681,   0, 127},
+  { 4689,   0, 127}, { 4697,   0, 127}, { 4705,   0, 127}, { 4793,   0, 127},
+  { 4801,   0, 127}, { 4809,   0, 127}, { 4810,   0, 127}, { 4817,   0, 127},
+  { 4818,   0, 127}, { 4825,   0, 127}, { 4865,   0, 127}, { 4881,   0, 127},
+  { 4896,   0, 127}, { 4978,   0, 127}, { 5016,   0, 127}, { 5024,   0, 127},
+  { 5144,   0, 127}, { 5152,   0, 127}, { 5272,   0, 127}, { 5280,   0, 127},
+  { 5400,   0, 127}, { 5408,   0, 127}, { 5528,   0, 127}, { 5536,   0, 127},
+  { 5544,   0, 127}, { 5656,   0, 127}, { 5664,   0, 127}, { 5672,   0, 127},
+  { 5673,   0, 127}, { 5784,   0, 127}, { 5785,   0, 127}, { 5792,   0, 127},
+  { 5800,   0, 127}, { 5801,   0, 127}, { 5808,   0, 127}, { 5809,   0, 127},
+  { 5905,   0, 127}, { 5912,   0, 127}, { 5913,   0, 127}, { 5920,   0, 127},
+  { 5928,   0, 127}, { 5929,   0, 127}, { 5936,   0, 127}, { 5937,   0, 127},
+  { 5944,   0, 127}, { 5952,   0, 127}, { 5976,   0, 127}, { 5985,   0, 127},
+  { 6033,   0, 127}, { 6040,   0, 127}, { 6080,   0, 127}, { 6104,   0, 127},
+  { 6112,   0, 127}, { 6113,   0, 127}, {   10,   0,  85}, {   18,   0,  85},
+  {  138,   0,  85}, {  258,   0,  85}, {  266,   0,  85}, {  385,   0,  85},
+  {  641,   0,  85}, {  642,   0,  85}, {  649,   0,  85}, {  769,   0,  85},
+  {  770,   0,  85}, {  771,   0,  85}, {  778,   0,  85}, {  898,   0,  85},
+  {  899,   0,  85}, {  906,   0,  85}, { 1026,   0,  85}, { 1034,   0,  85},
+  { 1035,   0,  85}, { 1154,   0,  85}, { 1162,   0,  85}, { 1282,   0,  85},
+  { 1290,   0,  85}, { 1409,   0,  85}, { 1417,   0,  85}, { 1418,   0,  85},
+  { 1546,   0,  85}, { 1561,   0,  85}, { 1562,   0,  85}, { 1569,   0,  85},
+  { 1689,   0,  85}, { 1690,   0,  85}, { 1706,   0,  85}, { 1818,   0,  85},
+  { 1834,   0,  85}, { 1946,   0,  85}, { 1962,   0,  85}, { 1963,   0,  85},
+  { 2050,   0,  85}, { 2099,   0,  85}, { 2107,   0,  85}, { 2108,   0,  85},
+  { 2115,   0,  85}, { 2116,   0,  85}, { 2123,   0,  85}, { 2124,   0,  85},
+  { 2155,   0,  85}, { 2235,   0,  85}, { 2243,   0,  85}, { 2244,   0,  85},
+  { 2251,   0,  85}, { 2252,   0,  85}, { 2284,   0,  85}, { 2354,   0,  85},
+  { 2363,   0,  85}, { 2370,   0,  85}, { 2371,   0,  85}, { 2379,   0,  85},
+  { 2490,   0,  85}, { 2762,   0,  85}, { 2771,   0,  85}, { 2890,   0,  85},
+  { 2898,   0,  85}, { 2899,   0,  85}, { 2907,   0,  85}, { 2915,   0,  85},
+  { 2923,   0,  85}, { 3050,   0,  85}, { 3051,   0,  85}, { 3058,   0,  85},
+  { 4826,   0,  85}, { 4834,   0,  85}, { 4938,   0,  85}, { 5001,   0,  85},
+  { 5681,   0,  85}, { 5817,   0,  85}, { 5825,   0,  85}, { 5833,   0,  85},
+  { 5945,   0,  85}, { 5953,   0,  85}, { 5961,   0,  85}, { 5969,   0,  85},
+  { 6064,   0,  85}, { 6072,   0,  85}, {   19,   0, 127}, {   27,   0, 127},
+  {   28,   0, 127}, {   35,   0, 127}, {   43,   0, 127}, {  146,   0, 127},
+  {  147,   0, 127}, {  148,   0, 127}, {  155,   0, 127}, {  156,   0, 127},
+  {  163,   0, 127}, {  164,   0, 127}, {  171,   0, 127}, {  267,   0, 127},
+  {  274,   0, 127}, {  275,   0, 127}, {  282,   0, 127}, {  283,   0, 127},
+  {  284,   0, 127}, {  290,   0, 127}, {  291,   0, 127}, {  299,   0, 127},
+  {  307,   0, 127}, {  394,   0, 127}, {  410,   0, 127}, {  418,   0, 127},
+  {  419,   0, 127}, {  435,   0, 127}, {  444,   0, 127}, {  521,   0, 127},
+  {  529,   0, 127}, {  530,   0, 127}, {  546,   0, 127}, {  563,   0, 127},
+  {  572,   0, 127}, {  650,   0, 127}, {  651,   0, 127}, {  658,   0, 127},
+  {  659,   0, 127}, {  667,   0, 127}, {  683,   0, 127}, {  691,   0, 127},
+  {  692,   0, 127}, {  699,   0, 127}, {  700,   0, 127}, {  708,   0, 127},
+  {  779,   0, 127}, {  780,   0, 127}, {  787,   0, 127}, {  795,   0, 127},
+  {  819,   0, 127}, {  827,   0, 127}, {  828,   0, 127}, {  835,   0, 127},
+  {  836,   0, 127}, {  844,   0, 127}, {  907,   0, 127}, {  915,   0, 127},
+  {  955,   0, 127}, {  963,   0, 127}, { 1083,   0, 127}, { 1171,   0, 127},
+  { 1187,   0, 127}, { 1220,   0, 127}, { 2059,   0, 127}, { 2076,   0, 127},
+  { 2083,   0, 127}, { 2091,   0, 127}, { 2092,   0, 127}, { 2100,   0, 127},
+  { 2101,   0, 127}, { 2109,   0, 127}, { 2110,   0, 127}, { 2117,   0, 127},
+  { 2118,   0, 127}, { 2179,   0, 127}, { 2195,   0, 127}, { 2196,   0, 127},
+  { 2203,   0, 127}, { 2204,   0, 127}, { 2205,   0, 127}, { 2211,   0, 127},
+  { 2212,   0, 127}, { 2218,   0, 127}, { 2219,   0, 127}, { 2220,   0, 127},
+  { 2227,   0, 127}, { 2228,   0, 127}, { 2229,   0, 127}, { 2236,   0, 127},
+  { 2237,   0, 127}, { 2245,   0, 127}, { 2323,   0, 127}, { 2324,   0, 127},
+  { 2331,   0, 127}, { 2332,   0, 127}, { 2338,   0, 127}, { 2339,   0, 127},
+  { 2340,   0, 127}, { 2346,   0, 127}, { 2347,   0, 127}, { 2348,   0, 127},
+  { 2355,   0, 127}, { 2435,   0, 127}, { 2443,   0, 127}, { 2444,   0, 127},
+  { 2451,   0, 127}, { 2459,   0, 127}, { 2466,   0, 127}, { 2467,   0, 127},
+  { 2474,   0, 127}, { 2475,   0, 127}, { 2482,   0, 127}, { 2562,   0, 127},
+  { 2570,   0, 127}, { 2571,   0, 127}, { 2579,   0, 127}, { 2580,   0, 127},
+  { 2594,   0, 127}, { 2602,   0, 127}, { 2603,   0, 127}, { 2610,   0, 127},
+  { 2700,   0, 127}, { 2708,   0, 127}, { 2731,   0, 127}, { 2739,   0, 127},
+  { 2754,   0, 127}, { 2852,   0, 127}, { 2883,   0, 127}, { 2891,   0, 127},
+  { 2972,   0, 127}, { 2979,   0, 127}, { 2986,   0, 127}, { 2987,   0, 127},
+  { 2988,   0, 127}, { 2994,   0, 127}, { 2995,   0, 127}, { 3002,   0, 127},
+  { 3010,   0, 127}, { 3099,   0, 127}, { 3107,   0, 127}, { 3115,   0, 127},
+  { 3116,   0, 127}, { 3123,   0, 127}, { 3130,   0, 127}, { 3131,   0, 127},
+  { 3138,   0, 127}, { 3139,   0, 127}, { 4403,   0, 127}, { 4412,   0, 127},
+  { 4427,   0, 127}, { 4539,   0, 127}, { 4547,   0, 127}, { 4666,   0, 127},
+  { 4698,   0, 127}, { 4706,   0, 127}, { 4794,   0, 127}, { 4802,   0, 127},
+  { 4842,   0, 127}, { 4843,   0, 127}, { 5009,   0, 127}, { 5017,   0, 127},
+  { 5025,   0, 127}, { 5145,   0, 127}, { 5153,   0, 127}, { 5273,   0, 127},
+  { 5281,   0, 127}, { 5401,   0, 127}, { 5409,   0, 127}, { 5537,   0, 127},
+  { 5921,   0, 127}, { 5962,   0, 127}, { 5977,   0, 127}, { 6089,   0, 127},
+  { 6098,   0, 127}, {   29,   0, 102}, {   36,   0, 102}, {  276,   0, 102},
+  {  402,   0, 102}, {  403,   0, 102}, {  411,   0, 102}, {  412,   0, 102},
+  {  427,   0, 102}, {  428,   0, 102}, {  436,   0, 102}, {  445,   0, 102},
+  {  453,   0, 102}, {  514,   0, 102}, {  522,   0, 102}, {  531,   0, 102},
+  {  538,   0, 102}, {  539,   0, 102}, {  547,   0, 102}, {  555,   0, 102},
+  {  556,   0, 102}, {  564,   0, 102}, {  565,   0, 102}, {  573,   0, 102},
+  {  581,   0, 102}, {  643,   0, 102}, {  660,   0, 102}, {  701,   0, 102},
+  {  709,   0, 102}, {  772,   0, 102}, { 1748,   0, 102}, { 2051,   0, 102},
+  { 2077,   0, 102}, { 2084,   0, 102}, { 2093,   0, 102}, { 2102,   0, 102},
+  { 2125,   0, 102}, { 2316,   0, 102}, { 2333,   0, 102}, { 2452,   0, 102},
+  { 2460,   0, 102}, { 2468,   0, 102}, { 2587,   0, 102}, { 2588,   0, 102},
+  { 2595,   0, 102}, { 2596,   0, 102}, { 2716,   0, 102}, { 2724,   0, 102},
+  { 2837,   0, 102}, { 2875,   0, 102}, { 2900,   0, 102}, { 2996,   0, 102},
+  { 3003,   0, 102}, { 3018,   0, 102}, { 3019,   0, 102}, { 3027,   0, 102},
+  { 3028,   0, 102}, { 3124,   0, 102}, { 3147,   0, 102}, { 3148,   0, 102},
+  { 3155,   0, 102}, { 3156,   0, 102}, { 3157,   0, 102}, { 3164,   0, 102},
+  { 3276,   0, 102}, { 3284,   0, 102}, { 3292,   0, 102}, { 3300,   0, 102},
+  { 4314,   0, 102}, { 4420,   0, 102}, { 4610,   0, 102}, { 4971,   0, 102},
+  { 5033,   0, 102}, { 5137,   0, 102}, { 5161,   0, 102}, { 5289,   0, 102},
+  { 5393,   0, 102}, { 5818,   0, 102}, { 5842,   0, 102}, { 5850,   0, 102},
+  { 5954,   0, 102}, { 5970,   0, 102}, { 5978,   0, 102}, { 5986,   0, 102},
+  { 6049,   0, 102}, { 6090,   0, 102}, { 6106,   0, 102}, {   37,   0, 127},
+  {   44,   0, 127}, {  157,   0, 127}, {  165,   0, 127}, {  259,   0,  85},
+  {  268,   0,  85}, {  285,   0, 127}, {  300,   0, 127}, {  308,   0, 127},
+  {  316,   0, 127}, {  395,   0,  85}, {  396,   0,  85}, {  404,   0,  85},
+  {  405,   0,  85}, {  420,   0, 127}, {  437,   0, 127}, {  515,   0,  85},
+  {  523,   0,  85}, {  524,   0,  85}, {  532,   0,  85}, {  540,   0, 127},
+  {  548,   0, 127}, {  574,   0,  85}, {  582,   0,  85}, {  589,   0, 127},
+  {  644,   0,  85}, {  652,   0,  85}, {  684,   0, 127}, {  693,   0, 127},
+  {  717,   0, 127}, {  829,   0, 127}, {  916,   0, 127}, {  948,   0, 127},
+  {  972,   0, 127}, { 1076,   0, 127}, { 1100,   0, 127}, { 1539,   0,  85},
+  { 1676,   0,  85}, { 1740,   0,  85}, { 1812,   0,  85}, { 1820,   0,  85},
+  { 1829,   0,  85}, { 1836,   0,  85}, { 1876,   0,  85}, { 1940,   0,  85},
+  { 1948,   0,  85}, { 1956,   0,  85}, { 2060,   0,  85}, { 2133,   0,  85},
+  { 2164,   0, 127}, { 2171,   0, 127}, { 2300,   0, 127}, { 2325,   0,  85},
+  { 2436,   0, 127}, { 2564,   0, 127}, { 2892,   0,  85}, { 3004,   0,  85},
+  { 3011,   0,  85}, { 3012,   0,  85}, { 3020,   0,  85}, { 3029,   0,  85},
+  { 3037,   0,  85}, { 3132,   0,  85}, { 3140,   0,  85}, { 3165,   0,  85},
+  { 3388,   0, 127}, { 3515,   0, 127}, { 3523,   0, 127}, { 3651,   0, 127},
+  { 4276,   0, 127}, { 4428,   0, 127}, { 4483,   0, 127}, { 4564,   0, 127},
+  { 4604,   0, 127}, { 4611,   0, 127}, { 4739,   0, 127}, { 4819,   0, 127},
+  { 4844,   0, 127}, { 4906,   0, 127}, { 4914,   0, 127}, { 4963,   0,  85},
+  { 5034,   0, 127}, { 5051,   0,  85}, { 5059,   0,  85}, { 5162,   0,  85},
+  { 5179,   0,  85}, { 5187,   0,  85}, { 5290,   0,  85}, { 5298,   0,  85},
+  { 5315,   0,  85}, { 5426,   0,  85}, { 5690,   0,  85}, { 5706,   0,  85},
+  { 5714,   0,  85}, { 5722,   0,  85}, { 5810,   0, 127}, { 5826,   0,  85},
+  { 5834,   0,  85}, { 5890,   0,  85}, { 6018,   0,  85}, {  260,   0,  72},
+  {  261,   0,  72}, {  269,   0,  72}, {  277,   0,  72}, {  387,   0,  72},
+  {  388,   0,  72}, {  389,   0,  72}, {  397,   0,  72}, {  516,   0,  72},
+  {  525,   0,  72}, {  645,   0,  72}, {  653,   0,  72}, {  702,   0, 109},
+  {  837,   0, 109}, { 1821,   0,  72}, { 1837,   0,  72}, { 1964,   0,  72},
+  { 2052,   0,  72}, { 2180,   0,  72}, { 2188,   0, 109}, { 2197,   0, 109},
+  { 3005,   0,  72}, { 3013,   0,  72}, { 3021,   0,  72}, { 3149,   0,  72},
+  { 3268,   0,  72}, { 3316,   0, 109}, { 3324,   0, 109}, { 3516,   0, 109},
+  { 3524,   0, 109}, { 3532,   0, 109}, { 3644,   0, 109}, { 3652,   0, 109},
+  { 4436,   0, 109}, { 4605,   0, 109}, { 4733,   0, 109}, { 4994,   0, 109},
+  { 5084,   0,  72}, { 5092,   0,  72}, { 5220,   0,  72}, { 5258,   0, 109},
+  { 5307,   0, 109}, { 5373,   0,  72}, { 5386,   0, 109}, { 5394,   0, 109},
+  { 5418,   0, 109}, { 5451,   0, 109}, { 5459,   0, 109}, { 5522,   0, 109},
+  { 5546,   0, 109}, { 5554,   0, 109}, { 5650,   0, 109}, { 5674,   0, 109},
+  { 5682,   0, 109}, { 5770,   0, 109}, { 5898,   0, 109}, { 5938,   0, 109},
+  { 5987,   0,  72}, { 6026,   0, 109}, {  166,   0, 127}, {  173,   0, 127},
+  {  181,   0, 127}, {  293,   0, 127}, {  301,   0, 127}, {  309,   0, 127},
+  {  317,   0, 127}, {  325,   0, 127}, {  381,   0, 127}, {  413,   0, 127},
+  {  446,   0, 127}, {  454,   0, 127}, {  501,   0, 127}, {  533,   0, 127},
+  {  541,   0, 127}, {  558,   0, 127}, {  566,   0, 127}, {  629,   0, 127},
+  {  637,   0, 127}, {  661,   0, 127}, {  669,   0, 127}, {  677,   0, 127},
+  {  685,   0, 127}, {  710,   0,  95}, {  765,   0, 127}, {  766,   0, 127},
+  {  789,   0, 127}, {  813,   0, 127}, {  821,   0, 127}, {  845,   0, 127},
+  {  853,   0, 127}, {  917,   0, 127}, {  949,   0, 127}, {  957,   0,  95},
+  {  965,   0,  95}, {  981,   0, 127}, { 1014,   0, 127}, { 1142,   0, 127},
+  { 1269,   0, 127}, { 1270,   0, 127}, { 1278,   0, 127}, { 1373,   0, 127},
+  { 1381,   0, 127}, { 1397,   0, 127}, { 1405,   0, 127}, { 1501,   0, 127},
+  { 1525,   0, 127}, { 1533,   0, 127}, { 1629,   0, 127}, { 1637,   0, 127},
+  { 1645,   0, 127}, { 1653,   0, 127}, { 1661,   0, 127}, { 1756,   0, 127},
+  { 1764,   0, 127}, { 1772,   0, 127}, { 1773,   0, 127}, { 1781,   0, 127},
+  { 1789,   0, 127}, { 1909,   0, 127}, { 1918,   0, 127}, { 1949,   0,  95},
+  { 1950,   0,  95}, { 1957,   0,  95}, { 2037,   0, 127}, { 2046,   0, 127},
+  { 2069,   0,  95}, { 2173,   0, 127}, { 2308,   0,  95}, { 3181,   0,  95},
+  { 3525,   0, 127}, { 4117,   0, 127}, { 4228,   0, 127}, { 4253,   0, 127},
+  { 4341,   0, 127}, { 4364,   0, 127}, { 4381,   0, 127}, { 4389,   0, 127},
+  { 4397,   0, 127}, { 4405,   0, 127}, { 4484,   0, 127}, { 4492,   0, 127},
+  { 4508,   0, 127}, { 4509,   0, 127}, { 4516,   0, 127}, { 4517,   0, 127},
+  { 4525,   0, 127}, { 4581,   0, 127}, { 4597,   0, 127}, { 4612,   0, 127},
+  { 4636,   0, 127}, { 4644,   0, 127}, { 4653,   0, 127}, { 4661,   0, 127},
+  { 4670,   0, 127}, { 4677,   0, 127}, { 4678,   0, 127}, { 4717,   0, 127},
+  { 4725,   0, 127}, { 4734,   0,  95}, { 4747,   0, 127}, { 4755,   0, 127},
+  { 4763,   0, 127}, { 4764,   0, 127}, { 4772,   0, 127}, { 4780,   0, 127},
+  { 4788,   0, 127}, { 4789,   0, 127}, { 4797,   0, 127}, { 4804,   0, 127},
+  { 4805,   0, 127}, { 4812,   0, 127}, { 4813,   0, 127}, { 4821,   0, 127},
+  { 4829,   0, 127}, { 4837,   0, 127}, { 4875,   0, 127}, { 4882,   0, 127},
+  { 4883,   0, 127}, { 4891,   0, 127}, { 4899,   0, 127}, { 4907,   0, 127},
+  { 4915,   0, 127}, { 4916,   0, 127}, { 4924,   0, 127}, { 4931,   0, 127},
+  { 4932,   0, 127}, { 4940,   0, 127}, { 4941,   0, 127}, { 4948,   0, 127},
+  { 4956,   0,  95}, { 4964,   0,  95}, { 4972,   0,  95}, { 4995,   0, 127},
+  { 5002,   0, 127}, { 5003,   0, 127}, { 5010,   0, 127}, { 5011,   0, 127},
+  { 5018,   0, 127}, { 5043,   0, 127}, { 5060,   0, 127}, { 5068,   0, 127},
+  { 5076,   0,  95}, { 5100,   0,  95}, { 5101,   0,  95}, { 5122,   0, 127},
+  { 5123,   0, 127}, { 5130,   0, 127}, { 5131,   0, 127}, { 5138,   0, 127},
+  { 5139,   0, 127}, { 5146,   0, 127}, { 5154,   0, 127}, { 5171,   0,  95},
+  { 5204,   0,  95}, { 5228,   0,  95}, { 5229,   0,  95}, { 5237,   0,  95},
+  { 5251,   0, 127}, { 5259,   0, 127}, { 5266,   0, 127}, { 5267,   0, 127},
+  { 5274,   0, 127}, { 5275,   0, 127}, { 5283,   0, 127}, { 5291,   0, 127},
+  { 5299,   0, 127}, { 5316,   0, 127}, { 5356,   0,  95}, { 5365,   0,  95},
+  { 5387,   0, 127}, { 5395,   0, 127}, { 5402,   0, 127}, { 5403,   0, 127},
+  { 5411,   0, 127}, { 5419,   0, 127}, { 5427,   0, 127}, { 5435,   0, 127},
+  { 5436,   0, 127}, { 5443,   0, 127}, { 5444,   0, 127}, { 5484,   0,  95},
+  { 5523,   0, 127}, { 5530,   0, 127}, { 5531,   0, 127}, { 5547,   0, 127},
+  { 5555,   0, 127}, { 5556,   0, 127}, { 5563,   0, 127}, { 5564,   0, 127},
+  { 5571,   0, 127}, { 5579,   0, 127}, { 5659,   0, 127}, { 5667,   0, 127},
+  { 5675,   0, 127}, { 5683,   0, 127}, { 5691,   0, 127}, { 5699,   0, 127},
+  { 5763,   0,  95}, { 5778,   0, 127}, { 5851,   0,  95}, { 5859,   0,  95},
+  { 5891,   0, 127}, { 5906,   0, 127}, { 5923,   0, 127}, { 5979,   0,  95},
+  { 6019,   0, 127}, { 6051,   0, 127}, { 6066,   0, 127}, { 6067,   0, 127},
+  { 6075,   0, 127}, { 6083,   0, 127}, { 6091,   0, 127}, { 6099,   0,  95},
+  {   60,   0, 113}, {   68,   0, 113}, {  158,   0, 113}, {  174,   0, 113},
+  {  286,   0, 113}, {  294,   0, 113}, {  302,   0, 113}, {  373,   0, 113},
+  {  414,   0, 113}, {  422,   0, 113}, {  430,   0, 113}, {  438,   0, 113},
+  {  518,   0,  85}, {  694,   0, 113}, {  797,   0, 113}, {  805,   0, 113},
+  {  878,   0, 113}, {  894,   0, 113}, {  925,   0, 113}, {  933,   0, 113},
+  {  941,   0, 113}, { 1045,   0, 113}, { 1101,   0, 113}, { 1237,   0, 113},
+  { 1262,   0, 113}, { 1365,   0, 113}, { 1389,   0, 113}, { 1390,   0, 113},
+  { 1398,   0, 113}, { 1406,   0, 113}, { 1509,   0, 113}, { 1510,   0, 113},
+  { 1517,   0, 113}, { 1534,   0, 113}, { 1790,   0, 113}, { 1901,   0, 113},
+  { 1958,   0, 113}, { 1965,   0,  85}, { 2029,   0, 113}, { 2038,   0, 113},
+  { 2189,   0,  85}, { 2974,   0, 113}, { 2982,   0, 113}, { 3110,   0, 113},
+  { 3389,   0,  85}, { 3517,   0, 113}, { 4100,   0, 113}, { 4141,   0, 113},
+  { 4245,   0, 113}, { 4356,   0, 113}, { 4413,   0, 113}, { 4469,   0, 113},
+  { 4534,   0, 113}, { 4573,   0, 113}, { 4620,   0, 113}, { 4628,   0, 113},
+  { 4637,   0, 113}, { 4645,   0, 113}, { 4654,   0, 113}, { 4662,   0, 113},
+  { 4686,   0, 113}, { 4702,   0, 113}, { 4718,   0, 113}, { 4756,   0, 113},
+  { 4853,   0, 113}, { 4867,   0, 113}, { 4884,   0, 113}, { 4892,   0, 113},
+  { 4908,   0, 113}, { 4949,   0, 113}, { 4965,   0, 113}, { 5019,   0, 113},
+  { 5035,   0, 113}, { 5093,   0,  85}, { 5163,   0, 113}, { 5196,   0, 113},
+  { 5308,   0, 113}, { 5324,   0, 113}, { 5348,   0,  85}, { 5379,   0, 113},
+  { 5420,   0, 113}, { 5428,   0, 113}, { 5467,   0,  85}, { 5507,   0,  85},
+  { 5515,   0, 113}, { 5539,   0, 113}, { 5587,   0, 113}, { 5635,   0,  85},
+  { 5643,   0, 113}, { 5651,   0, 113}, { 5707,   0, 113}, { 5715,   0, 113},
+  { 5731,   0, 113}, { 5771,   0, 113}, { 5779,   0, 113}, { 5787,   0, 113},
+  { 5795,   0, 113}, { 5827,   0, 113}, { 5835,   0, 113}, { 5843,   0, 113},
+  { 5899,   0, 113}, { 5931,   0, 113}, { 5939,   0, 113}, { 5947,   0, 113},
+  { 5955,   0, 113}, { 5971,   0,  85}, { 6027,   0, 113}, { 6043,   0, 113},
+  { 6052,   0, 113}, { 6059,   0, 113}, { 6060,   0, 113}, { 6068,   0, 113},
+  { 6076,   0, 113}, { 6084,   0, 113}, {   46,   0, 102}, {   53,   0, 102},
+  {  189,   0, 102}, {  197,   0, 102}, {  278,   0, 102}, {  310,   0, 102},
+  {  398,   0, 102}, {  406,   0, 102}, {  510,   0, 102}, {  526,   0, 102},
+  {  534,   0, 102}, {  542,   0, 102}, {  550,   0, 102}, {  678,   0, 102},
+  {  686,   0, 102}, {  718,   0, 102}, {  886,   0, 102}, {  998,   0, 102},
+  { 1006,   0, 102}, { 1110,   0, 102}, { 1126,   0, 102}, { 1134,   0, 102},
+  { 1189,   0, 102}, { 1246,   0, 102}, { 1254,   0, 102}, { 1374,   0, 102},
+  { 1382,   0, 102}, { 1518,   0, 102}, { 1526,   0, 102}, { 1654,   0, 102},
+  { 1662,   0, 102}, { 1749,   0, 102}, { 1757,   0, 102}, { 1765,   0, 102},
+  { 1782,   0, 102}, { 2293,   0,  76}, { 2301,   0, 102}, { 3102,   0, 102},
+  { 3261,   0,  76}, { 3269,   0,  76}, { 3397,   0,  76}, { 3405,   0,  76},
+  { 4109,   0, 102}, { 4125,   0, 102}, { 4133,   0, 102}, { 4277,   0, 102},
+  { 4350,   0, 102}, { 4373,   0, 102}, { 4421,   0, 102}, { 4478,   0, 102},
+  { 4485,   0, 102}, { 4501,   0, 102}, { 4518,   0, 102}, { 4629,   0, 102},
+  { 4694,   0, 102}, { 4726,   0, 102}, { 4748,   0, 102}, { 4765,   0, 102},
+  { 4773,   0, 102}, { 4781,   0, 102}, { 4814,   0, 102}, { 4845,   0, 102},
+  { 4854,   0, 102}, { 4862,   0,  76}, { 4868,   0, 102}, { 4876,   0, 102},
+  { 4900,   0, 102}, { 4917,   0, 102}, { 4933,   0, 102}, { 4957,   0, 102},
+  { 4982,   0, 102}, { 4990,   0, 102}, { 5027,   0, 102}, { 5044,   0, 102},
+  { 5052,   0, 102}, { 5077,   0, 102}, { 5085,   0, 102}, { 5147,   0, 102},
+  { 5172,   0, 102}, { 5213,   0,  76}, { 5252,   0, 102}, { 5260,   0, 102},
+  { 5292,   0, 102}, { 5300,   0, 102}, { 5332,   0, 102}, { 5340,   0,  76},
+  { 5452,   0, 102}, { 5572,   0, 102}, { 5595,   0, 102}, { 5603,   0, 102},
+  { 5629,   0,  76}, { 5676,   0, 102}, { 5684,   0, 102}, { 5692,   0, 102},
+  { 5700,   0, 102}, { 5803,   0, 102}, { 5804,   0, 102}, { 5811,   0, 102},
+  { 5812,   0, 102}, { 5819,   0, 102}, { 5820,   0, 102}, { 5828,   0, 102},
+  { 5868,   0, 102}, { 5885,   0,  76}, { 5907,   0, 102}, { 5908,   0, 102},
+  { 5915,   0, 102}, { 5916,   0, 102}, { 5924,   0, 102}, { 5932,   0, 102},
+  { 5940,   0, 102}, { 5948,   0, 102}, { 5956,   0, 102}, { 5963,   0, 102},
+  { 6028,   0, 102}, { 6034,   0, 102}, { 6035,   0, 102}, { 6036,   0, 102},
+  { 6044,   0, 102}, { 6053,   0, 102}, {  462,   0,  92}, {  519,   0,  92},
+  {  647,   0,  92}, {  654,   0,  92}, {  670,   0,  92}, {  726,   0,  92},
+  {  775,   0,  92}, {  903,   0,  92}, {  910,   0,  92}, {  982,   0,  92},
+  { 1038,   0,  92}, { 1053,   0,  92}, { 1069,   0,  92}, { 1151,   0,  92},
+  { 1229,   0,  92}, { 1279,   0,  92}, { 1407,   0,  92}, { 1502,   0,  92},
+  { 1535,   0,  92}, { 1621,   0,  92}, { 1638,   0,  92}, { 1646,   0,  92},
+  { 1741,   0,  69}, { 1942,   0,  69}, { 1973,   0,  69}, { 2309,   0,  92},
+  { 2317,   0,  92}, { 2854,   0,  92}, { 2990,   0,  92}, { 3118,   0,  92},
+  { 3134,   0,  69}, { 4101,   0,  92}, { 4237,   0,  92}, { 4365,   0,  92},
+  { 4493,   0,  92}, { 4526,   0,  92}, { 4542,   0,  92}, { 4550,   0,  92},
+  { 4613,   0,  92}, { 4621,   0,  92}, { 4710,   0,  92}, { 4740,   0,  92},
+  { 4846,   0,  92}, { 4909,   0,  92}, { 4925,   0,  92}, { 4974,   0,  92},
+  { 5004,   0,  92}, { 5012,   0,  92}, { 5028,   0,  92}, { 5036,   0,  92},
+  { 5069,   0,  92}, { 5094,   0,  92}, { 5155,   0,  92}, { 5164,   0,  92},
+  { 5180,   0,  92}, { 5205,   0,  92}, { 5221,   0,  92}, { 5333,   0,  92},
+  { 5357,   0,  92}, { 5380,   0,  92}, { 5388,   0,  92}, { 5412,   0,  92},
+  { 5460,   0,  92}, { 5468,   0,  92}, { 5476,   0,  92}, { 5493,   0,  92},
+  { 5502,   0,  92}, { 5532,   0,  92}, { 5540,   0,  92}, { 5548,   0,  92},
+  { 5580,   0,  92}, { 5588,   0,  92}, { 5668,   0,  92}, { 5708,   0,  92},
+  { 5716,   0,  92}, { 5723,   0,  92}, { 5772,   0,  92}, { 5780,   0,  92},
+  { 5788,   0,  92}, { 5796,   0,  92}, { 5844,   0,  92}, { 5852,   0,  92},
+  { 5860,   0,  92}, { 5964,   0,  92}, { 6061,   0,  92}, { 6069,   0,  92},
+  { 6092,   0,  92}, {   61,   0,  85}, {  135,   0,  85}, {  182,   0,  85},
+  {  263,   0,  85}, {  382,   0,  85}, {  391,   0,  85}, {  639,   0,  85},
+  {  662,   0,  85}, {  782,   0,  85}, {  790,   0,  85}, {  838,   0,  85},
+  {  846,   0,  85}, {  854,   0,  85}, {  918,   0,  85}, {  934,   0,  85},
+  { 1054,   0,  85}, { 1062,   0,  85}, { 1077,   0,  85}, { 1143,   0,  85},
+  { 1181,   0,  85}, { 1197,   0,  85}, { 1238,   0,  85}, { 1310,   0,  85},
+  { 1318,   0,  85}, { 1663,   0,  85}, { 1766,   0,  85}, { 1774,   0,  85},
+  { 1791,   0,  85}, { 1966,   0,  85}, { 1974,   0,  85}, { 2846,   0,  85},
+  { 4102,   0,  85}, { 4103,   0,  85}, { 4110,   0,  85}, { 4126,   0,  85},
+  { 4134,   0,  85}, { 4229,   0,  85}, { 4230,   0,  85}, { 4238,   0,  85},
+  { 4357,   0,  85}, { 4358,   0,  85}, { 4366,   0,  85}, { 4374,   0,  85},
+  { 4382,   0,  85}, { 4486,   0,  85}, { 4502,   0,  85}, { 4510,   0,  85},
+  { 4558,   0,  85}, { 4598,   0,  85}, { 4646,   0,  85}, { 4741,   0,  85},
+  { 4749,   0,  85}, { 4757,   0,  85}, { 4798,   0,  85}, { 4806,   0,  85},
+  { 4822,   0,  85}, { 4830,   0,  85}, { 5020,   0,  85}, { 5053,   0,  85},
+  { 5061,   0,  85}, { 5086,   0,  85}, { 5102,   0,  85}, { 5124,   0,  85},
+  { 5132,   0,  85}, { 5140,   0,  85}, { 5148,   0,  85}, { 5156,   0,  85},
+  { 5181,   0,  85}, { 5214,   0,  85}, { 5222,   0,  85}, { 5230,   0,  85},
+  { 5276,   0,  85}, { 5284,   0,  85}, { 5341,   0,  85}, { 5349,   0,  85},
+  { 5396,   0,  85}, { 5404,   0,  85}, { 5469,   0,  85}, { 5477,   0,  85},
+  { 5485,   0,  85}, { 5494,   0,  85}, { 5508,   0,  85}, { 5524,   0,  85},
+  { 5596,   0,  85}, { 5604,   0,  85}, { 5612,   0,  85}, { 5613,   0,  85},
+  { 5621,   0,  85}, { 5622,   0,  85}, { 5630,   0,  85}, { 5636,   0,  85},
+  { 5652,   0,  85}, { 5660,   0,  85}, { 5724,   0,  85}, { 5732,   0,  85},
+  { 5740,   0,  85}, { 5741,   0,  85}, { 5749,   0,  85}, { 5758,   0,  85},
+  { 5764,   0,  85}, { 5836,   0,  85}, { 5900,   0,  85}, { 5917,   0,  85},
+  { 5925,   0,  85}, { 5933,   0,  85}, { 5941,   0,  85}, { 5980,   0,  85},
+  { 5989,   0,  85}, { 5997,   0,  85}, { 6005,   0,  85}, { 6100,   0,  85},
+  { 6134,   0,  85}, {   54,   0,  78}, {   62,   0,  78}, {  143,   0,  78},
+  {  151,   0,  78}, {  159,   0,  78}, {  190,   0,  78}, {  271,   0,  78},
+  {  279,   0,  78}, {  287,   0,  78}, {  318,   0,  78}, {  399,   0,  78},
+  {  407,   0,  78}, {  415,   0,  78}, {  423,   0,  78}, {  767,   0,  78},
+  {  798,   0,  78}, {  806,   0,  78}, {  814,   0,  78}, {  822,   0,  78},
+  {  830,   0,  78}, {  895,   0,  78}, {  926,   0,  78}, {  942,   0,  78},
+  {  974,   0,  78}, { 1023,   0,  78}, { 1046,   0,  78}, { 1302,   0,  78},
+  { 1358,   0,  78}, { 1366,   0,  78}, { 1494,   0,  78}, { 1630,   0,  78},
+  { 1758,   0,  78}, { 1919,   0,  78}, { 2023,   0,  78}, { 2031,   0,  78},
+  { 2039,   0,  78}, { 2047,   0,  78}, { 2438,   0,  78}, { 2446,   0,  78},
+  { 3126,   0,  78}, { 3270,   0,  78}, { 3502,   0,  78}, { 4254,   0,  78},
+  { 4262,   0,  78}, { 4390,   0,  78}, { 4398,   0,  78}, { 4406,   0,  78},
+  { 4453,   0,  78}, { 4494,   0,  78}, { 4566,   0,  78}, { 4590,   0,  78},
+  { 4735,   0,  78}, { 4782,   0,  78}, { 4790,   0,  78}, { 4838,   0,  78},
+  { 4863,   0,  78}, { 4893,   0,  78}, { 4901,   0,  78}, { 4934,   0,  78},
+  { 4950,   0,  78}, { 4958,   0,  78}, { 4991,   0,  78}, { 4996,   0,  78},
+  { 5029,   0,  78}, { 5045,   0,  78}, { 5119,   0,  78}, { 5189,   0,  78},
+  { 5268,   0,  78}, { 5325,   0,  78}, { 5342,   0,  78}, { 5350,   0,  78},
+  { 5358,   0,  78}, { 5366,   0,  78}, { 5461,   0,  78}, { 5516,   0,  78},
+  { 5517,   0,  78}, { 5525,   0,  78}, { 5533,   0,  78}, { 5541,   0,  78},
+  { 5573,   0,  78}, { 5597,   0,  78}, { 5605,   0,  78}, { 5644,   0,  78},
+  { 5645,   0,  78}, { 5693,   0,  78}, { 5701,   0,  78}, { 5709,   0,  78},
+  { 5733,   0,  78}, { 5750,   0,  78}, { 5789,   0,  78}, { 5797,   0,  78},
+  { 5821,   0,  78}, { 5829,   0,  78}, { 5837,   0,  78}, { 5861,   0,  78},
+  { 5869,   0,  78}, { 5877,   0,  78}, { 5878,   0,  78}, { 5886,   0,  78},
+  { 5892,   0,  78}, { 5909,   0,  78}, { 5949,   0,  78}, { 5957,   0,  78},
+  { 5972,   0,  78}, { 5973,   0,  78}, { 5981,   0,  78}, { 6006,   0,  78},
+  { 6037,   0,  78}, { 6045,   0,  78}, { 6054,   0,  78}, { 6085,   0,  78},
+  { 6109,   0,  78}, { 6117,   0,  78}, {   70,   0,  72}, {   78,   0,  72},
+  {  167,   0,  72}, {  198,   0,  72}, {  206,   0,  72}, {  295,   0,  72},
+  {  326,   0,  72}, {  334,   0,  72}, {  607,   0,  72}, {  958,   0,  72},
+  {  966,   0,  72}, { 1070,   0,  72}, { 1174,   0,  72}, { 1182,   0,  72},
+  { 1190,   0,  72}, { 1230,   0,  72}, { 1326,   0,  72}, { 1878,   0,  72},
+  { 1998,   0,  72}, { 2015,   0,  72}, { 2166,   0,  72}, { 2182,   0,  72},
+  { 2326,   0,  72}, { 2430,   0,  72}, { 2599,   0,  72}, { 2607,   0,  72},
+  { 2615,   0,  72}, { 2623,   0,  72}, { 2727,   0,  72}, { 2735,   0,  72},
+  { 2743,   0,  72}, { 2751,   0,  72}, { 2855,   0,  72}, { 2863,   0,  72},
+  { 2871,   0,  72}, { 2879,   0,  72}, { 2983,   0,  72}, { 2991,   0,  72},
+  { 2999,   0,  72}, { 3007,   0,  72}, { 3015,   0,  72}, { 3246,   0,  72},
+  { 3262,   0,  72}, { 3374,   0,  72}, { 3390,   0,  72}, { 3398,   0,  72},
+  { 3406,   0,  72}, { 4118,   0,  72}, { 4246,   0,  72}, { 4422,   0,  72},
+  { 4574,   0,  72}, { 4607,   0,  72}, { 4614,   0,  72}, { 4622,   0,  72},
+  { 4638,   0,  72}, { 4774,   0,  72}, { 4869,   0,  72}, { 4877,   0,  72},
+  { 4966,   0,  72}, { 4997,   0,  72}, { 5013,   0,  72}, { 5021,   0,  72},
+  { 5037,   0,  72}, { 5125,   0,  72}, { 5141,   0,  72}, { 5149,   0,  72},
+  { 5157,   0,  72}, { 5165,   0,  72}, { 5197,   0,  72}, { 5247,   0,  72},
+  { 5285,   0,  72}, { 5309,   0,  72}, { 5317,   0,  72}, { 5375,   0,  72},
+  { 5405,   0,  72}, { 5413,   0,  72}, { 5421,   0,  72}, { 5437,   0,  72},
+  { 5445,   0,  72}, { 5453,   0,  72}, { 5470,   0,  72}, { 5478,   0,  72},
+  { 5486,   0,  72}, { 5503,   0,  72}, { 5509,   0,  72}, { 5542,   0,  72},
+  { 5549,   0,  72}, { 5565,   0,  72}, { 5581,   0,  72}, { 5589,   0,  72},
+  { 5598,   0,  72}, { 5606,   0,  72}, { 5614,   0,  72}, { 5631,   0,  72},
+  { 5637,   0,  72}, { 5653,   0,  72}, { 5661,   0,  72}, { 5669,   0,  72},
+  { 5670,   0,  72}, { 5677,   0,  72}, { 5717,   0,  72}, { 5725,   0,  72},
+  { 5759,   0,  72}, { 5781,   0,  72}, { 5805,   0,  72}, { 5813,   0,  72},
+  { 5845,   0,  72}, { 5853,   0,  72}, { 5887,   0,  72}, { 5901,   0,  72},
+  { 5965,   0,  72}, { 5998,   0,  72}, { 6015,   0,  72}, { 6062,   0,  72},
+  { 6093,   0,  72}, { 6101,   0,  72}, { 6143,   0,  72}, {   39,   0,  68},
+  {  303,   0,  68}, {  431,   0,  68}, {  439,   0,  68}, {  527,   0,  68},
+  {  535,   0,  68}, {  543,   0,  68}, {  551,   0,  68}, {  559,   0,  68},
+  {  599,   0,  68}, {  615,   0,  68}, {  623,   0,  68}, {  631,   0,  68},
+  {  655,   0,  68}, {  663,   0,  68}, {  671,   0,  68}, {  679,   0,  68},
+  {  735,   0,  68}, {  743,   0,  68}, {  751,   0,  68}, {  759,   0,  68},
+  {  783,   0,  68}, {  791,   0,  68}, {  799,   0,  68}, {  807,   0,  68},
+  {  871,   0,  68}, {  879,   0,  68}, {  887,   0,  68}, {  911,   0,  68},
+  {  919,   0,  68}, {  927,   0,  68}, {  935,   0,  68}, {  950,   0,  68},
+  {  999,   0,  68}, { 1007,   0,  68}, { 1015,   0,  68}, { 1055,   0,  68},
+  { 1078,   0,  68}, { 1086,   0,  68}, { 1094,   0,  68}, { 1102,   0,  68},
+  { 1127,   0,  68}, { 1135,   0,  68}, { 1198,   0,  68}, { 1206,   0,  68},
+  { 1222,   0,  68}, { 1271,   0,  68}, { 1614,   0,  68}, { 1742,   0,  68},
+  { 1750,   0,  68}, { 1838,   0,  68}, { 1870,   0,  68}, { 1935,   0,  68},
+  { 1943,   0,  68}, { 1951,   0,  68}, { 1999,   0,  68}, { 2007,   0,  68},
+  { 2158,   0,  68}, { 2190,   0,  68}, { 2310,   0,  68}, { 2318,   0,  68},
+  { 2975,   0,  68}, { 3135,   0,  68}, { 3254,   0,  68}, { 3382,   0,  68},
+  { 4142,   0,  68}, { 4270,   0,  68}, { 4333,   0,  68}, { 4630,   0,  68},
+  { 4703,   0,  68}, { 4742,   0,  68}, { 4750,   0,  68}, { 4870,   0,  68},
+  { 4878,   0,  68}, { 4885,   0,  68}, { 4902,   0,  68}, { 4910,   0,  68},
+  { 4926,   0,  68}, { 4998,   0,  68}, { 5005,   0,  68}, { 5006,   0,  68},
+  { 5030,   0,  68}, { 5062,   0,  68}, { 5078,   0,  68}, { 5133,   0,  68},
+  { 5173,   0,  68}, { 5269,   0,  68}, { 5277,   0,  68}, { 5293,   0,  68},
+  { 5301,   0,  68}, { 5381,   0,  68}, { 5397,   0,  68}, { 5414,   0,  68},
+  { 5429,   0,  68}, { 5510,   0,  68}, { 5550,   0,  68}, { 5557,   0,  68},
+  { 5558,   0,  68}, { 5566,   0,  68}, { 5574,   0,  68}, { 5582,   0,  68},
+  { 5590,   0,  68}, { 5638,   0,  68}, { 5678,   0,  68}, { 5685,   0,  68},
+  { 5686,   0,  68}, { 5694,   0,  68}, { 5702,   0,  68}, { 5734,   0,  68},
+  { 5742,   0,  68}, { 5765,   0,  68}, { 5773,   0,  68}, { 5798,   0,  68},
+  { 5806,   0,  68}, { 5814,   0,  68}, { 5822,   0,  68}, { 5870,   0,  68},
+  { 5926,   0,  68}, { 5934,   0,  68}, { 5942,   0,  68}, { 6046,   0,  68},
+  { 6070,   0,  68}, { 6078,   0,  68}, { 6086,   0,  68}, { 6094,   0,  68},
+  { 6102,   0,  68}, { 6110,   0,  68}, { 6118,   0,  68}, { 6126,   0,  68},
+  {   26,   0, 170}, {   34,   0, 170}, {   89,   0, 170}, {  153,   0, 170},
+  {  154,   0, 170}, {  162,   0, 170}, {  281,   0, 170}, {  289,   0, 170},
+  {  298,   0, 170}, {  401,   0, 170}, {  409,   0, 170}, {  417,   0, 170},
+  {  426,   0, 170}, {  443,   0, 170}, {  451,   0, 170}, {  452,   0, 170},
+  {  506,   0, 170}, {  537,   0, 170}, {  545,   0, 170}, {  554,   0, 170},
+  {  571,   0, 170}, {  579,   0, 170}, {  580,   0, 170}, {  588,   0, 170},
+  {  634,   0, 170}, {  666,   0, 170}, {  707,   0, 170}, {  716,   0, 170},
+  {  786,   0, 170}, {  811,   0, 170}, {  954,   0, 170}, { 1043,   0, 170},
+  { 1050,   0, 170}, { 1057,   0, 170}, { 1090,   0, 170}, { 1091,   0, 170},
+  { 1179,   0, 170}, { 1211,   0, 170}, { 1219,   0, 170}, { 1619,   0, 170},
+  { 1715,   0, 170}, { 1755,   0, 170}, { 1793,   0, 170}, { 1802,   0, 170},
+  { 1811,   0, 170}, { 1843,   0, 170}, { 1850,   0, 170}, { 1858,   0, 170},
+  { 1867,   0, 170}, { 1921,   0, 170}, { 1929,   0, 170}, { 1930,   0, 170},
+  { 1938,   0, 170}, { 1939,   0, 170}, { 1971,   0, 170}, { 2058,   0, 170},
+  { 2067,   0, 170}, { 2074,   0, 170}, { 2075,   0, 170}, { 2082,   0, 170},
+  { 2090,   0, 170}, { 2178,   0, 170}, { 2187,   0, 170}, { 2194,   0, 170},
+  { 2202,   0, 170}, { 2210,   0, 170}, { 2307,   0, 170}, { 2315,   0, 170},
+  { 2330,   0, 170}, { 2434,   0, 170}, { 2442,   0, 170}, { 2450,   0, 170},
+  { 2458,   0, 170}, { 2473,   0, 170}, { 2561,   0, 170}, { 2569,   0, 170},
+  { 2577,   0, 170}, { 2578,   0, 170}, { 2586,   0, 170}, { 2601,   0, 170},
+  { 2689,   0, 170}, { 2690,   0, 170}, { 2691,   0, 170}, { 2698,   0, 170},
+  { 2699,   0, 170}, { 2706,   0, 170}, { 2707,   0, 170}, { 2714,   0, 170},
+  { 2715,   0, 170}, { 2722,   0, 170}, { 2723,   0, 170}, { 2730,   0, 170},
+  { 2737,   0, 170}, { 2738,   0, 170}, { 2746,   0, 170}, { 2818,   0, 170},
+  { 2819,   0, 170}, { 2826,   0, 170}, { 2827,   0, 170}, { 2828,   0, 170},
+  { 2834,   0, 170}, { 2835,   0, 170}, { 2836,   0, 170}, { 2842,   0, 170},
+  { 2843,   0, 170}, { 2844,   0, 170}, { 2850,   0, 170}, { 2851,   0, 170},
+  { 2858,   0, 170}, { 2859,   0, 170}, { 2865,   0, 170}, { 2866,   0, 170},
+  { 2867,   0, 170}, { 2873,   0, 170}, { 2874,   0, 170}, { 2882,   0, 170},
+  { 2963,   0, 170}, { 2971,   0, 170}, { 3091,   0, 170}, { 3211,   0, 170},
+  { 3219,   0, 170}, { 3227,   0, 170}, { 3235,   0, 170}, { 3243,   0, 170},
+  { 3427,   0, 170}, { 3435,   0, 170}, { 4121,   0, 170}, { 4130,   0, 170},
+  { 4139,   0, 170}, { 4306,   0, 170}, { 4402,   0, 170}, { 4411,   0, 170},
+  { 4419,   0, 170}, { 4426,   0, 170}, { 4434,   0, 170}, { 4521,   0, 170},
+  { 4529,   0, 170}, { 4530,   0, 170}, { 4538,   0, 170}, { 4546,   0, 170},
+  { 4554,   0, 170}, { 4562,   0, 170}, { 4586,   0, 170}, { 4649,   0, 170},
+  { 4674,   0, 170}, { 4682,   0, 170}, { 4690,   0, 170}, { 4714,   0, 170},
+  { 4737,   0, 170}, { 4785,   0, 170}, { 4905,   0, 170}, { 4986,   0, 170},
+  { 5665,   0, 170}, { 5777,   0, 170}, { 5793,   0, 170}, { 6097,   0, 170},
+  { 6105,   0, 170}, {  179,   0, 191}, {  243,   0, 191}, {  483,   0, 191},
+  {  499,   0, 191}, {  507,   0, 191}, {  596,   0, 191}, {  603,   0, 191},
+  {  611,   0, 191}, {  732,   0, 191}, {  740,   0, 191}, {  763,   0, 191},
+  {  852,   0, 191}, {  860,   0, 191}, {  930,   0, 191}, {  939,   0, 191},
+  {  979,   0, 191}, {  986,   0, 191}, {  987,   0, 191}, { 1058,   0, 191},
+  { 1067,   0, 191}, { 1107,   0, 191}, { 1114,   0, 191}, { 1122,   0, 191},
+  { 1228,   0, 191}, { 1235,   0, 191}, { 1242,   0, 191}, { 1491,   0, 191},
+  { 1529,   0, 191}, { 1657,   0, 191}, { 1763,   0, 191}, { 4114,   0, 191},
+  { 4122,   0, 191}, { 4123,   0, 191}, { 4226,   0, 191}, { 4242,   0, 191},
+  { 4249,   0, 191}, { 4250,   0, 191}, { 4258,   0, 191}, { 4267,   0, 191},
+  { 4354,   0, 191}, { 4362,   0, 191}, { 4377,   0, 191}, { 4378,   0, 191},
+  { 4385,   0, 191}, { 4386,   0, 191}, { 4394,   0, 191}, { 4442,   0, 191},
+  { 4450,   0, 191}, { 4451,   0, 191}, { 4459,   0, 191}, { 4490,   0, 191},
+  { 4513,   0, 191}, { 4563,   0, 191}, { 4570,   0, 191}, { 4578,   0, 191},
+  { 4587,   0, 191}, { 4618,   0, 191}, { 4641,   0, 191}, { 4683,   0, 191},
+  { 4746,   0, 191}, { 4761,   0, 191}, { 4769,   0, 191}, { 4777,   0, 191},
+  { 4889,   0, 191}, { 4897,   0, 191}, { 5657,   0, 191}, {  172,   0, 153},
+  {  292,   0, 153}, {  324,   0, 153}, {  332,   0, 153}, {  460,   0, 153},
+  {  461,   0, 153}, {  635,   0, 153}, {  675,   0, 153}, {  788,   0, 153},
+  {  820,   0, 153}, {  947,   0, 153}, {  956,   0, 153}, {  964,   0, 153},
+  { 1084,   0, 153}, { 1092,   0, 153}, { 2068,   0, 153}, { 2563,   0, 153},
+  { 2572,   0, 153}, { 2692,   0, 153}, { 4131,   0, 153}, { 4140,   0, 153},
+  { 4259,   0, 153}, { 4395,   0, 153}, { 4435,   0, 153}, { 4443,   0, 153},
+  { 4468,   0, 153}, { 4482,   0, 153}, { 4522,   0, 153}, { 4531,   0, 153},
+  { 4555,   0, 153}, { 4556,   0, 153}, { 4571,   0, 153}, { 4572,   0, 153},
+  { 4579,   0, 153}, { 4580,   0, 153}, { 4658,   0, 153}, { 4675,   0, 153},
+  { 4691,   0, 153}, { 4699,   0, 153}, { 4707,   0, 153}, { 4715,   0, 153},
+  { 4738,   0, 153}, { 4786,   0, 153}, { 4811,   0, 153}, { 4827,   0, 153},
+  { 4835,   0, 153}, { 4836,   0, 153}, { 4866,   0, 153}, { 5529,   0, 153},
+  { 5802,   0, 153}, {   59,   0, 170}, {  244,   0, 170}, {  245,   0, 170},
+  {  492,   0, 170}, {  508,   0, 170}, {  621,   0, 170}, {  628,   0, 170},
+  {  749,   0, 170}, {  861,   0, 170}, {  869,   0, 170}, {  877,   0, 170},
+  {  885,   0, 170}, {  893,   0, 170}, {  924,   0, 170}, {  989,   0, 170},
+  {  997,   0, 170}, { 1022,   0, 170}, { 1068,   0, 170}, { 1116,   0, 170},
+  { 1125,   0, 170}, { 1141,   0, 170}, { 1149,   0, 170}, { 1244,   0, 170},
+  { 1245,   0, 170}, { 1276,   0, 170}, { 1364,   0, 170}, { 1396,   0, 170},
+  { 1403,   0, 170}, { 1404,   0, 170}, { 1523,   0, 170}, { 1531,   0, 170},
+  { 1643,   0, 170}, { 1651,   0, 170}, { 1659,   0, 170}, { 1771,   0, 170},
+  { 1779,   0, 170}, { 1787,   0, 170}, { 1915,   0, 170}, { 2044,   0, 170},
+  { 4099,   0, 170}, { 4107,   0, 170}, { 4108,   0, 170}, { 4115,   0, 170},
+  { 4132,   0, 170}, { 4212,   0, 170}, { 4221,   0, 170}, { 4235,   0, 170},
+  { 4236,   0, 170}, { 4243,   0, 170}, { 4251,   0, 170}, { 4260,   0, 170},
+  { 4268,   0, 170}, { 4340,   0, 170}, { 4349,   0, 170}, { 4355,   0, 170},
+  { 4363,   0, 170}, { 4371,   0, 170}, { 4379,   0, 170}, { 4387,   0, 170},
+  { 4388,   0, 170}, { 4396,   0, 170}, { 4404,   0, 170}, { 4491,   0, 170},
+  { 4499,   0, 170}, { 4507,   0, 170}, { 4514,   0, 170}, { 4515,   0, 170},
+  { 4523,   0, 170}, { 4532,   0, 170}, { 4540,   0, 170}, { 4548,   0, 170},
+  { 4549,   0, 170}, { 4642,   0, 170}, { 4650,   0, 170}, { 4659,   0, 170},
+  { 4667,   0, 170}, { 4676,   0, 170}, { 4692,   0, 170}, { 4700,   0, 170},
+  { 4708,   0, 170}, { 4762,   0, 170}, { 4778,   0, 170}, { 4803,   0, 170},
+  { 5666,   0, 170}, { 5786,   0, 170}, { 5794,   0, 170}, {   38,   0, 145},
+  {   45,   0, 145}, {   52,   0, 145}, {   67,   0, 145}, {   75,   0, 145},
+  {  180,   0, 145}, {  188,   0, 145}, {  196,   0, 145}, {  204,   0, 145},
+  {  421,   0, 145}, {  429,   0, 145}, {  509,   0, 145}, {  549,   0, 145},
+  {  557,   0, 145}, {  636,   0, 145}, {  668,   0, 145}, {  676,   0, 145},
+  {  757,   0, 145}, {  796,   0, 145}, {  804,   0, 145}, {  812,   0, 145},
+  {  932,   0, 145}, {  940,   0, 145}, {  973,   0, 145}, { 1052,   0, 145},
+  { 1060,   0, 145}, { 1150,   0, 145}, { 1253,   0, 145}, { 1261,   0, 145},
+  { 1277,   0, 145}, { 1372,   0, 145}, { 1380,   0, 145}, { 1388,   0, 145},
+  { 1500,   0, 145}, { 1508,   0, 145}, { 1516,   0, 145}, { 1524,   0, 145},
+  { 1532,   0, 145}, { 1628,   0, 145}, { 1636,   0, 145}, { 1644,   0, 145},
+  { 1652,   0, 145}, { 1660,   0, 145}, { 1780,   0, 145}, { 1788,   0, 145},
+  { 1900,   0, 145}, { 1907,   0, 145}, { 1908,   0, 145}, { 1916,   0, 145},
+  { 1917,   0, 145}, { 2036,   0, 145}, { 2045,   0, 145}, { 4116,   0, 145},
+  { 4124,   0, 145}, { 4222,   0, 145}, { 4244,   0, 145}, { 4252,   0, 145},
+  { 4261,   0, 145}, { 4269,   0, 145}, { 4372,   0, 145}, { 4380,   0, 145},
+  { 4500,   0, 145}, { 4524,   0, 145}, { 4533,   0, 145}, { 4541,   0, 145},
+  { 4557,   0, 145}, { 4565,   0, 145}, { 4589,   0, 145}, { 4619,   0, 145},
+  { 4627,   0, 145}, { 4635,   0, 145}, { 4643,   0, 145}, { 4651,   0, 145},
+  { 4652,   0, 145}, { 4660,   0, 145}, { 4668,   0, 145}, { 4669,   0, 145},
+  { 4684,   0, 145}, { 4685,   0, 145}, { 4693,   0, 145}, { 4701,   0, 145},
+  { 4709,   0, 145}, { 4770,   0, 145}, { 4771,   0, 145}, { 4779,   0, 145},
+  { 4787,   0, 145}, { 4795,   0, 145}, { 4796,   0, 145}, { 4820,   0, 145},
+  { 4828,   0, 145}, { 4874,   0, 145}, { 4890,   0, 145}, { 4898,   0, 145},
+  { 4923,   0, 145}, { 5026,   0, 145}, { 5282,   0, 145}, { 5410,   0, 145},
+  { 5538,   0, 145}, { 5658,   0, 145}, { 5914,   0, 145}, { 5922,   0, 145},
+  { 5930,   0, 145}, { 6042,   0, 145}, { 6050,   0, 145}, { 6058,   0, 145},
+  {   24,   0, 255}, {   32,   0, 255}, {   72,   0, 255}, {   80,   0, 255},
+  {   88,   0, 255}, {   96,   0, 255}, {  152,   0, 255}, {  200,   0, 255},
+  {  208,   0, 255}, {  216,   0, 255}, {  224,   0, 255}, {  225,   0, 255},
+  {  232,   0, 255}, {  233,   0, 255}, {  241,   0, 255}, {  249,   0, 255},
+  {  280,   0, 255}, {  320,   0, 255}, {  328,   0, 255}, {  336,   0, 255},
+  {  344,   0, 255}, {  352,   0, 255}, {  353,   0, 255}, {  360,   0, 255},
+  {  361,   0, 255}, {  368,   0, 255}, {  369,   0, 255}, {  377,   0, 255},
+  {  392,   0, 255}, {  400,   0, 255}, {  440,   0, 255}, {  448,   0, 255},
+  {  456,   0, 255}, {  464,   0, 255}, {  472,   0, 255}, {  480,   0, 255},
+  {  488,   0, 255}, {  489,   0, 255}, {  496,   0, 255}, {  497,   0, 255},
+  {  504,   0, 255}, {  505,   0, 255}, {  520,   0, 255}, {  528,   0, 255},
+  {  560,   0, 255}, {  568,   0, 255}, {  576,   0, 255}, {  584,   0, 255},
+  {  592,   0, 255}, {  600,   0, 255}, {  608,   0, 255}, {  616,   0, 255},
+  {  617,   0, 255}, {  624,   0, 255}, {  625,   0, 255}, {  632,   0, 255},
+  {  648,   0, 255}, {  656,   0, 255}, {  696,   0, 255}, {  704,   0, 255},
+  {  712,   0, 255}, {  720,   0, 255}, {  728,   0, 255}, {  736,   0, 255},
+  {  744,   0, 255}, {  752,   0, 255}, {  753,   0, 255}, {  760,   0, 255},
+  {  761,   0, 255}, {  768,   0, 255}, {  776,   0, 255}, {  777,   0, 255},
+  {  784,   0, 255}, {  785,   0, 255}, {  824,   0, 255}, {  832,   0, 255},
+  {  840,   0, 255}, {  848,   0, 255}, {  856,   0, 255}, {  864,   0, 255},
+  {  872,   0, 255}, {  880,   0, 255}, {  888,   0, 255}, {  889,   0, 255},
+  {  896,   0, 255}, {  904,   0, 255}, {  905,   0, 255}, {  912,   0, 255},
+  {  913,   0, 255}, {  920,   0, 255}, {  952,   0, 255}, {  960,   0, 255},
+  {  968,   0, 255}, {  976,   0, 255}, {  984,   0, 255}, {  992,   0, 255},
+  { 1000,   0, 255}, { 1008,   0, 255}, { 1016,   0, 255}, { 1024,   0, 255},
+  { 1032,   0, 255}, { 1033,   0, 255}, { 1040,   0, 255}, { 1041,   0, 255},
+  { 1042,   0, 255}, { 1048,   0, 255}, { 1064,   0, 255}, { 1072,   0, 255},
+  { 1080,   0, 255}, { 1088,   0, 255}, { 1096,   0, 255}, { 1104,   0, 255},
+  { 1112,   0, 255}, { 1120,   0, 255}, { 1128,   0, 255}, { 1136,   0, 255},
+  { 1144,   0, 255}, { 1160,   0, 255}, { 1161,   0, 255}, { 1168,   0, 255},
+  { 1169,   0, 255}, { 1176,   0, 255}, { 1177,   0, 255}, { 1178,   0, 255},
+  { 1184,   0, 255}, { 1185,   0, 255}, { 1192,   0, 255}, { 1193,   0, 255},
+  { 1200,   0, 255}, { 1208,   0, 255}, { 1216,   0, 255}, { 1224,   0, 255},
+  { 1288,   0, 255}, { 1296,   0, 255}, { 1297,   0, 255}, { 1304,   0, 255},
+  { 1305,   0, 255}, { 1312,   0, 255}, { 1313,   0, 255}, { 1320,   0, 255},
+  { 1321,   0, 255}, { 1322,   0, 255}, { 1328,   0, 255}, { 1329,   0, 255},
+  { 1336,   0, 255}, { 1344,   0, 255}, { 1352,   0, 255}, { 1416,   0, 255},
+  { 1424,   0, 255}, { 1432,   0, 255}, { 1440,   0, 255}, { 1448,   0, 255},
+  { 1456,   0, 255}, { 1457,   0, 255}, { 1464,   0, 255}, { 1465,   0, 255},
+  { 1472,   0, 255}, { 1480,   0, 255}, { 1536,   0, 255}, { 1544,   0, 255},
+  { 1552,   0, 255}, { 1560,   0, 255}, { 1576,   0, 255}, { 1577,   0, 255},
+  { 1584,   0, 255}, { 1585,   0, 255}, { 1586,   0, 255}, { 1592,   0, 255},
+  { 1593,   0, 255}, { 1600,   0, 255}, { 1608,   0, 255}, { 1616,   0, 255},
+  { 1624,   0, 255}, { 1632,   0, 255}, { 1640,   0, 255}, { 1664,   0, 255},
+  { 1672,   0, 255}, { 1680,   0, 255}, { 1688,   0, 255}, { 1704,   0, 255},
+  { 1705,   0, 255}, { 1712,   0, 255}, { 1713,   0, 255}, { 1714,   0, 255},
+  { 1720,   0, 255}, { 1721,   0, 255}, { 1728,   0, 255}, { 1729,   0, 255},
+  { 1736,   0, 255}, { 1737,   0, 255}, { 1744,   0, 255}, { 1745,   0, 255},
+  { 1746,   0, 255}, { 1752,   0, 255}, { 1753,   0, 255}, { 1754,   0, 255},
+  { 1760,   0, 255}, { 1761,   0, 255}, { 1762,   0, 255}, { 1768,   0, 255},
+  { 1769,   0, 255}, { 1776,   0, 255}, { 1784,   0, 255}, { 1792,   0, 255},
+  { 1800,   0, 255}, { 1808,   0, 255}, { 1816,   0, 255}, { 1817,   0, 255},
+  { 1824,   0, 255}, { 1832,   0, 255}, { 1833,   0, 255}, { 1840,   0, 255},
+  { 1841,   0, 255}, { 1848,   0, 255}, { 1849,   0, 255}, { 1856,   0, 255},
+  { 1857,   0, 255}, { 1864,   0, 255}, { 1865,   0, 255}, { 1872,   0, 255},
+  { 1873,   0, 255}, { 1880,   0, 255}, { 1881,   0, 255}, { 1888,   0, 255},
+  { 1889,   0, 255}, { 1896,   0, 255}, { 1897,   0, 255}, { 1904,   0, 255},
+  { 1905,   0, 255}, { 1912,   0, 255}, { 1928,   0, 255}, { 1936,   0, 255},
+  { 1937,   0, 255}, { 1944,   0, 255}, { 1945,   0, 255}, { 1952,   0, 255},
+  { 1960,   0, 255}, { 1961,   0, 255}, { 1968,   0, 255}, { 1976,   0, 255},
+  { 1992,   0, 255}, { 2000,   0, 255}, { 2008,   0, 255}, { 2016,   0, 255},
+  { 2024,   0, 255}, { 2032,   0, 255}, { 2040,   0, 255}, { 2048,   0, 255},
+  { 2072,   0, 255}, { 2073,   0, 255}, { 2080,   0, 255}, { 2088,   0, 255},
+  { 2089,   0, 255}, { 2096,   0, 255}, { 2097,   0, 255}, { 2104,   0, 255},
+  { 2105,   0, 255}, { 2168,   0, 255}, { 2185,   0, 255}, { 2193,   0, 255},
+  { 2200,   0, 255}, { 2208,   0, 255}, { 2216,   0, 255}, { 2217,   0, 255},
+  { 2224,   0, 255}, { 2225,   0, 255}, { 2232,   0, 255}, { 2305,   0, 255},
+  { 2306,   0, 255}, { 2313,   0, 255}, { 2328,   0, 255}, { 2344,   0, 255},
+  { 2352,   0, 255}, { 2360,   0, 255}, { 2432,   0, 255}, { 2440,   0, 255},
+  { 2472,   0, 255}, { 2480,   0, 255}, { 2592,   0, 255}, { 2600,   0, 255},
+  { 2608,   0, 255}, { 2728,   0, 255}, { 2736,   0, 255}, { 2744,   0, 255},
+  { 2752,   0, 255}, { 2864,   0, 255}, { 2872,   0, 255}, { 2880,   0, 255},
+  { 2889,   0, 255}, { 2944,   0, 255}, { 2952,   0, 255}, { 2960,   0, 255},
+  { 2968,   0, 255}, { 2976,   0, 255}, { 3008,   0, 255}, { 3016,   0, 255},
+  { 3017,   0, 255}, { 3024,   0, 255}, { 3025,   0, 255}, { 3072,   0, 255},
+  { 3080,   0, 255}, { 3088,   0, 255}, { 3096,   0, 255}, { 3104,   0, 255},
+  { 3144,   0, 255}, { 3152,   0, 255}, { 3153,   0, 255}, { 3160,   0, 255},
+  { 3168,   0, 255}, { 3169,   0, 255}, { 3177,   0, 255}, { 3216,   0, 255},
+  { 3224,   0, 255}, { 3232,   0, 255}, { 3240,   0, 255}, { 3272,   0, 255},
+  { 3280,   0, 255}, { 3281,   0, 255}, { 3288,   0, 255}, { 3289,   0, 255},
+  { 3296,   0, 255}, { 3297,   0, 255}, { 3305,   0, 255}, { 3306,   0, 255},
+  { 3313,   0, 255}, { 3314,   0, 255}, { 3321,   0, 255}, { 3344,   0, 255},
+  { 3352,   0, 255}, { 3360,   0, 255}, { 3368,   0, 255}, { 3376,   0, 255},
+  { 3400,   0, 255}, { 3408,   0, 255}, { 3416,   0, 255}, { 3424,   0, 255},
+  { 3425,   0, 255}, { 3432,   0, 255}, { 3433,   0, 255}, { 3441,   0, 255},
+  { 3472,   0, 255}, { 3480,   0, 255}, { 3488,   0, 255}, { 3496,   0, 255},
+  { 3504,   0, 255}, { 3600,   0, 255}, { 3608,   0, 255}, { 3616,   0, 255},
+  { 3624,   0, 255}, { 3632,   0, 255}, { 3640,   0, 255}, { 3736,   0, 255},
+  { 3744,   0, 255}, { 3752,   0, 255}, { 3760,   0, 255}, { 3768,   0, 255},
+  { 3824,   0, 255}, { 3832,   0, 255}, { 3840,   0, 255}, { 3864,   0, 255},
+  { 3872,   0, 255}, { 3880,   0, 255}, { 3888,   0, 255}, { 3896,   0, 255},
+  { 3936,   0, 255}, { 3944,   0, 255}, { 3952,   0, 255}, { 3960,   0, 255},
+  { 3968,   0, 255}, { 3976,   0, 255}, { 3992,   0, 255}, { 4000,   0, 255},
+  { 4008,   0, 255}, { 4016,   0, 255}, { 4024,   0, 255}, { 4040,   0, 255},
+  { 4048,   0, 255}, { 4056,   0, 255}, { 4064,   0, 255}, { 4072,   0, 255},
+  { 4080,   0, 255}, { 4081,   0, 255}, { 4096,   0, 255}, { 4104,   0, 255},
+  { 4112,   0, 255}, { 4113,   0, 255}, { 4120,   0, 255}, { 4176,   0, 255},
+  { 4192,   0, 255}, { 4200,   0, 255}, { 4208,   0, 255}, { 4216,   0, 255},
+  { 4224,   0, 255}, { 4232,   0, 255}, { 4240,   0, 255}, { 4248,   0, 255},
+  { 4256,   0, 255}, { 4288,   0, 255}, { 4296,   0, 255}, { 4304,   0, 255},
+  { 4305,   0, 255}, { 4312,   0, 255}, { 4320,   0, 255}, { 4321,   0, 255},
+  { 4328,   0, 255}, { 4329,   0, 255}, { 4330,   0, 255}, { 4336,   0, 255},
+  { 4337,   0, 255}, { 4338,   0, 255}, { 4344,   0, 255}, { 4345,   0, 255},
+  { 4352,   0, 255}, { 4360,   0, 255}, { 4368,   0, 255}, { 4376,   0, 255},
+  { 4384,   0, 255}, { 4392,   0, 255}, { 4400,   0, 255}, { 4408,   0, 255},
+  { 4416,   0, 255}, { 4425,   0, 255}, { 4457,   0, 255}, { 4464,   0, 255},
+  { 4465,   0, 255}, { 4472,   0, 255}, { 4473,   0, 255}, { 4480,   0, 255},
+  { 4488,   0, 255}, { 4496,   0, 255}, { 4504,   0, 255}, { 4528,   0, 255},
+  { 4536,   0, 255}, { 4560,   0, 255}, { 4561,   0, 255}, { 4568,   0, 255},
+  { 4585,   0, 255}, { 4592,   0, 255}, { 4593,   0, 255}, { 4600,   0, 255},
+  { 4601,   0, 255}, { 4608,   0, 255}, { 4616,   0, 255}, { 4624,   0, 255},
+  { 4656,   0, 255}, { 4664,   0, 255}, { 4672,   0, 255}, { 4680,   0, 255},
+  { 4688,   0, 255}, { 4696,   0, 255}, { 4728,   0, 255}, { 4736,   0, 255},
+  { 4744,   0, 255}, { 4752,   0, 255}, { 4760,   0, 255}, { 4776,   0, 255},
+  { 4873,   0, 255}, { 4880,   0, 255}, { 4888,   0, 255}, { 4985,   0, 255},
+  { 5960,   0, 255}, { 5968,   0, 255}, { 6088,   0, 255}, { 6096,   0, 255},
+  {   33,   0, 255}, {   40,   0, 255}, {   41,   0, 255}, {   42,   0, 255},
+  {   48,   0, 255}, {   49,   0, 255}, {   56,   0, 255}, {   64,   0, 255},
+  {   97,   0, 255}, {  105,   0, 255}, {  113,   0, 255}, {  160,   0, 255},
+  {  161,   0, 255}, {  168,   0, 255}, {  169,   0, 255}, {  170,   0, 255},
+  {  176,   0, 255}, {  177,   0, 255}, {  178,   0, 255}, {  184,   0, 255},
+  {  185,   0, 255}, {  186,   0, 255}, {  192,   0, 255}, {  193,   0, 255},
+  {  201,   0, 255}, {  209,   0, 255}, {  217,   0, 255}, {  226,   0, 255},
+  {  242,   0, 255}, {  288,   0, 255}, {  296,   0, 255}, {  297,   0, 255},
+  {  304,   0, 255}, {  305,   0, 255}, {  306,   0, 255}, {  312,   0, 255},
+  {  313,   0, 255}, {  314,   0, 255}, {  315,   0, 255}, {  321,   0, 255},
+  {  322,   0, 255}, {  323,   0, 255}, {  329,   0, 255}, {  330,   0, 255},
+  {  337,   0, 255}, {  338,   0, 255}, {  345,   0, 255}, {  362,   0, 255},
+  {  370,   0, 255}, {  378,   0, 255}, {  408,   0, 255}, {  416,   0, 255},
+  {  424,   0, 255}, {  425,   0, 255}, {  432,   0, 255}, {  433,   0, 255},
+  {  434,   0, 255}, {  441,   0, 255}, {  442,   0, 255}, {  449,   0, 255},
+  {  450,   0, 255}, {  457,   0, 255}, {  458,   0, 255}, {  459,   0, 255},
+  {  465,   0, 255}, {  466,   0, 255}, {  473,   0, 255}, {  481,   0, 255},
+  {  490,   0, 255}, {  498,   0, 255}, {  536,   0, 255}, {  544,   0, 255},
+  {  552,   0, 255}, {  553,   0, 255}, {  561,   0, 255}, {  562,   0, 255},
+  {  569,   0, 255}, {  570,   0, 255}, {  577,   0, 255}, {  578,   0, 255},
+  {  585,   0, 255}, {  586,   0, 255}, {  587,   0, 255}, {  593,   0, 255},
+  {  594,   0, 255}, {  595,   0, 255}, {  601,   0, 255}, {  609,   0, 255},
+  {  618,   0, 255}, {  657,   0, 255}, {  664,   0, 255}, {  665,   0, 255},
+  {  672,   0, 255}, {  673,   0, 255}, {  674,   0, 255}, {  680,   0, 255},
+  {  681,   0, 255}, {  682,   0, 255}, {  688,   0, 255}, {  689,   0, 255},
+  {  690,   0, 255}, {  697,   0, 255}, {  698,   0, 255}, {  705,   0, 255},
+  {  706,   0, 255}, {  713,   0, 255}, {  714,   0, 255}, {  715,   0, 255},
+  {  721,   0, 255}, {  722,   0, 255}, {  723,   0, 255}, {  729,   0, 255},
+  {  737,   0, 255}, {  745,   0, 255}, {  746,   0, 255}, {  754,   0, 255},
+  {  792,   0, 255}, {  793,   0, 255}, {  794,   0, 255}, {  800,   0, 255},
+  {  801,   0, 255}, {  802,   0, 255}, {  808,   0, 255}, {  809,   0, 255},
+  {  810,   0, 255}, {  816,   0, 255}, {  817,   0, 255}, {  818,   0, 255},
+  {  825,   0, 255}, {  826,   0, 255}, {  833,   0, 255}, {  834,   0, 255},
+  {  841,   0, 255}, {  842,   0, 255}, {  843,   0, 255}, {  849,   0, 255},
+  {  850,   0, 255}, {  851,   0, 255}, {  857,   0, 255}, {  865,   0, 255},
+  {  873,   0, 255}, {  874,   0, 255}, {  881,   0, 255}, {  882,   0, 255},
+  {  914,   0, 255}, {  921,   0, 255}, {  922,   0, 255}, {  928,   0, 255},
+  {  929,   0, 255}, {  936,   0, 255}, {  937,   0, 255}, {  938,   0, 255},
+  {  944,   0, 255}, {  945,   0, 255}, {  946,   0, 255}, {  953,   0, 255},
+  {  961,   0, 255}, {  962,   0, 255}, {  969,   0, 255}, {  970,   0, 255},
+  {  971,   0, 255}, {  977,   0, 255}, {  978,   0, 255}, {  985,   0, 255},
+  {  993,   0, 255}, { 1001,   0, 255}, { 1009,   0, 255}, { 1017,   0, 255},
+  { 1049,   0, 255}, { 1056,   0, 255}, { 1065,   0, 255}, { 1066,   0, 255},
+  { 1073,   0, 255}, { 1074,   0, 255}, { 1081,   0, 255}, { 1082,   0, 255},
+  { 1089,   0, 255}, { 1097,   0, 255}, { 1098,   0, 255}, { 1099,   0, 255},
+  { 1105,   0, 255}, { 1106,   0, 255}, { 1113,   0, 255}, { 1121,   0, 255},
+  { 1129,   0, 255}, { 1137,   0, 255}, { 1145,   0, 255}, { 1186,   0, 255},
+  { 1194,   0, 255}, { 1195,   0, 255}, { 1201,   0, 255}, { 1202,   0, 255},
+  { 1203,   0, 255}, { 1209,   0, 255}, { 1210,   0, 255}, { 1217,   0, 255},
+  { 1218,   0, 255}, { 1225,   0, 255}, { 1226,   0, 255}, { 1227,   0, 255},
+  { 1232,   0, 255}, { 1233,   0, 255}, { 1234,   0, 255}, { 1240,   0, 255},
+  { 1241,   0, 255}, { 1248,   0, 255}, { 1249,   0, 255}, { 1256,   0, 255},
+  { 1257,   0, 255}, { 1264,   0, 255}, { 1265,   0, 255}, { 1272,   0, 255},
+  { 1273,   0, 255}, { 1330,   0, 255}, { 1337,   0, 255}, { 1338,   0, 255},
+  { 1345,   0, 255}, { 1346,   0, 255}, { 1353,   0, 255}, { 1354,   0, 255},
+  { 1355,   0, 255}, { 1360,   0, 255}, { 1361,   0, 255}, { 1362,   0, 255},
+  { 1368,   0, 255}, { 1369,   0, 255}, { 1376,   0, 255}, { 1377,   0, 255},
+  { 1384,   0, 255}, { 1385,   0, 255}, { 1392,   0, 255}, { 1393,   0, 255},
+  { 1400,   0, 255}, { 1401,   0, 255}, { 1473,   0, 255}, { 1481,   0, 255},
+  { 1482,   0, 255}, { 1488,   0, 255}, { 1489,   0, 255}, { 1490,   0, 255},
+  { 1496,   0, 255}, { 1497,   0, 255}, { 1504,   0, 255}, { 1512,   0, 255},
+  { 1520,   0, 255}, { 1528,   0, 255}, { 1601,   0, 255}, { 1609,   0, 255},
+  { 1610,   0, 255}, { 1617,   0, 255}, { 1618,   0, 255}, { 1625,   0, 255},
+  { 1626,   0, 255}, { 1633,   0, 255}, { 1641,   0, 255}, { 1648,   0, 255},
+  { 1649,   0, 255}, { 1656,   0, 255}, { 1722,   0, 255}, { 1730,   0, 255},
+  { 1738,   0, 255}, { 1739,   0, 255}, { 1747,   0, 255}, { 1770,   0, 255},
+  { 1777,   0, 255}, { 1920,   0, 255}, { 2081,   0, 255}, { 2201,   0, 255},
+  { 2209,   0, 255}, { 2291,   0, 255}, { 2314,   0, 255}, { 2321,   0, 255},
+  { 2322,   0, 255}, { 2329,   0, 255}, { 2336,   0, 255}, { 2337,   0, 255},
+  { 2345,   0, 255}, { 2433,   0, 255}, { 2441,   0, 255}, { 2448,   0, 255},
+  { 2449,   0, 255}, { 2456,   0, 255}, { 2457,   0, 255}, { 2464,   0, 255},
+  { 2465,   0, 255}, { 2560,   0, 255}, { 2568,   0, 255}, { 2576,   0, 255},
+  { 2584,   0, 255}, { 2585,   0, 255}, { 2593,   0, 255}, { 2688,   0, 255},
+  { 2696,   0, 255}, { 2697,   0, 255}, { 2704,   0, 255}, { 2705,   0, 255},
+  { 2712,   0, 255}, { 2713,   0, 255}, { 2720,   0, 255}, { 2721,   0, 255},
+  { 2729,   0, 255}, { 2816,   0, 255}, { 2817,   0, 255}, { 2824,   0, 255},
+  { 2825,   0, 255}, { 2832,   0, 255}, { 2833,   0, 255}, { 2840,   0, 255},
+  { 2841,   0, 255}, { 2848,   0, 255}, { 2849,   0, 255}, { 2856,   0, 255},
+  { 2857,   0, 255}, { 2945,   0, 255}, { 2946,   0, 255}, { 2953,   0, 255},
+  { 2954,   0, 255}, { 2961,   0, 255}, { 2962,   0, 255}, { 2969,   0, 255},
+  { 2970,   0, 255}, { 2977,   0, 255}, { 2978,   0, 255}, { 2984,   0, 255},
+  { 2985,   0, 255}, { 2992,   0, 255}, { 2993,   0, 255}, { 3000,   0, 255},
+  { 3001,   0, 255}, { 3009,   0, 255}, { 3073,   0, 255}, { 3081,   0, 255},
+  { 3082,   0, 255}, { 3089,   0, 255}, { 3090,   0, 255}, { 3097,   0, 255},
+  { 3098,   0, 255}, { 3105,   0, 255}, { 3112,   0, 255}, { 3113,   0, 255},
+  { 3120,   0, 255}, { 3121,   0, 255}, { 3128,   0, 255}, { 3129,   0, 255},
+  { 3136,   0, 255}, { 3145,   0, 255}, { 3200,   0, 255}, { 3201,   0, 255},
+  { 3202,   0, 255}, { 3208,   0, 255}, { 3209,   0, 255}, { 3210,   0, 255},
+  { 3217,   0, 255}, { 3218,   0, 255}, { 3225,   0, 255}, { 3226,   0, 255},
+  { 3233,   0, 255}, { 3234,   0, 255}, { 3241,   0, 255}, { 3242,   0, 255},
+  { 3248,   0, 255}, { 3249,   0, 255}, { 3250,   0, 255}, { 3256,   0, 255},
+  { 3257,   0, 255}, { 3258,   0, 255}, { 3264,   0, 255}, { 3265,   0, 255},
+  { 3266,   0, 255}, { 3273,   0, 255}, { 3274,   0, 255}, { 3282,   0, 255},
+  { 3328,   0, 255}, { 3329,   0, 255}, { 3336,   0, 255}, { 3337,   0, 255},
+  { 3345,   0, 255}, { 3346,   0, 255}, { 3353,   0, 255}, { 3354,   0, 255},
+  { 3361,   0, 255}, { 3362,   0, 255}, { 3369,   0, 255}, { 3370,   0, 255},
+  { 3377,   0, 255}, { 3378,   0, 255}, { 3384,   0, 255}, { 3385,   0, 255},
+  { 3386,   0, 255}, { 3392,   0, 255}, { 3393,   0, 255}, { 3394,   0, 255},
+  { 3401,   0, 255}, { 3402,   0, 255}, { 3403,   0, 255}, { 3409,   0, 255},
+  { 3410,   0, 255}, { 3411,   0, 255}, { 3417,   0, 255}, { 3418,   0, 255},
+  { 3426,   0, 255}, { 3434,   0, 255}, { 3442,   0, 255}, { 3456,   0, 255},
+  { 3464,   0, 255}, { 3497,   0, 255}, { 3505,   0, 255}, { 3512,   0, 255},
+  { 3513,   0, 255}, { 3520,   0, 255}, { 3521,   0, 255}, { 3528,   0, 255},
+  { 3529,   0, 255}, { 3530,   0, 255}, { 3536,   0, 255}, { 3537,   0, 255},
+  { 3538,   0, 255}, { 3544,   0, 255}, { 3545,   0, 255}, { 3552,   0, 255},
+  { 3553,   0, 255}, { 3554,   0, 255}, { 3560,   0, 255}, { 3561,   0, 255},
+  { 3568,   0, 255}, { 3569,   0, 255}, { 3576,   0, 255}, { 3584,   0, 255},
+  { 3592,   0, 255}, { 3625,   0, 255}, { 3633,   0, 255}, { 3634,   0, 255},
+  { 3641,   0, 255}, { 3648,   0, 255}, { 3649,   0, 255}, { 3656,   0, 255},
+  { 3657,   0, 255}, { 3658,   0, 255}, { 3664,   0, 255}, { 3665,   0, 255},
+  { 3666,   0, 255}, { 3672,   0, 255}, { 3673,   0, 255}, { 3680,   0, 255},
+  { 3681,   0, 255}, { 3682,   0, 255}, { 3688,   0, 255}, { 3689,   0, 255},
+  { 3696,   0, 255}, { 3697,   0, 255}, { 3704,   0, 255}, { 3712,   0, 255},
+  { 3720,   0, 255}, { 3728,   0, 255}, { 3753,   0, 255}, { 3754,   0, 255},
+  { 3761,   0, 255}, { 3762,   0, 255}, { 3763,   0, 255}, { 3769,   0, 255},
+  { 3770,   0, 255}, { 3776,   0, 255}, { 3777,   0, 255}, { 3778,   0, 255},
+  { 3784,   0, 255}, { 3785,   0, 255}, { 3786,   0, 255}, { 3792,   0, 255},
+  { 3793,   0, 255}, { 3794,   0, 255}, { 3800,   0, 255}, { 3801,   0, 255},
+  { 3802,   0, 255}, { 3808,   0, 255}, { 3809,   0, 255}, { 3810,   0, 255},
+  { 3816,   0, 255}, { 3817,   0, 255}, { 3818,   0, 255}, { 3825,   0, 255},
+  { 3848,   0, 255}, { 3856,   0, 255}, { 3881,   0, 255}, { 3889,   0, 255},
+  { 3890,   0, 255}, { 3897,   0, 255}, { 3898,   0, 255}, { 3904,   0, 255},
+  { 3905,   0, 255}, { 3906,   0, 255}, { 3912,   0, 255}, { 3913,   0, 255},
+  { 3914,   0, 255}, { 3920,   0, 255}, { 3921,   0, 255}, { 3922,   0, 255},
+  { 3928,   0, 255}, { 3929,   0, 255}, { 3930,   0, 255}, { 3937,   0, 255},
+  { 3938,   0, 255}, { 3945,   0, 255}, { 3946,   0, 255}, { 3953,   0, 255},
+  { 3984,   0, 255}, { 3993,   0, 255}, { 4009,   0, 255}, { 4017,   0, 255},
+  { 4025,   0, 255}, { 4032,   0, 255}, { 4041,   0, 255}, { 4049,   0, 255},
+  { 4057,   0, 255}, { 4065,   0, 255}, { 4073,   0, 255}, { 4074,   0, 255},
+  { 4088,   0, 255}, { 4097,   0, 255}, { 4105,   0, 255}, { 4225,   0, 255},
+  { 4233,   0, 255}, { 4241,   0, 255}, { 4313,   0, 255}, { 4353,   0, 255},
+  { 4361,   0, 255}, { 4369,   0, 255}, { 4433,   0, 255}, { 4441,   0, 255},
+  { 4449,   0, 255}, { 4458,   0, 255}, { 4466,   0, 255}, { 4467,   0, 255},
+  { 4474,   0, 255}, { 4475,   0, 255}, { 4481,   0, 255}, { 4489,   0, 255},
+  { 4497,   0, 255}, { 4512,   0, 255}, { 4520,   0, 255}, { 4537,   0, 255},
+  { 4545,   0, 255}, { 4553,   0, 255}, { 4594,   0, 255}, { 4617,   0, 255},
+  { 4632,   0, 255}, { 4640,   0, 255}, { 4648,   0, 255}, { 4657,   0, 255},
+  { 4665,   0, 255}, { 4673,   0, 255}, { 4721,   0, 255}, { 4745,   0, 255},
+  { 4753,   0, 255}, { 4768,   0, 255}, { 4850,   0, 255}, { 4857,   0, 255},
+  {   50,   0, 255}, {   57,   0, 255}, {  106,   0, 255}, {  107,   0, 255},
+  {  194,   0, 255}, {  202,   0, 255}, {  210,   0, 255}, {  234,   0, 255},
+  {  331,   0, 255}, {  339,   0, 255}, {  346,   0, 255}, {  354,   0, 255},
+  {  371,   0, 255}, {  379,   0, 255}, {  467,   0, 255}, {  474,   0, 255},
+  {  482,   0, 255}, {  491,   0, 255}, {  602,   0, 255}, {  610,   0, 255},
+  {  724,   0, 255}, {  730,   0, 255}, {  731,   0, 255}, {  738,   0, 255},
+  {  739,   0, 255}, {  747,   0, 255}, {  762,   0, 255}, {  858,   0, 255},
+  {  859,   0, 255}, {  866,   0, 255}, {  867,   0, 255}, {  875,   0, 255},
+  {  890,   0, 255}, {  994,   0, 255}, { 1002,   0, 255}, { 1010,   0, 255},
+  { 1018,   0, 255}, { 1075,   0, 255}, { 1138,   0, 255}, { 1146,   0, 255},
+  { 1274,   0, 255}, { 1363,   0, 255}, { 1505,   0, 255}, { 1513,   0, 255},
+  { 1521,   0, 255}, { 1785,   0, 255}, { 1913,   0, 255}, { 4082,   0, 255},
+  { 4322,   0, 255}, { 4505,   0, 255}, { 4625,   0, 255}, { 4633,   0, 255},
+  {   65,   0, 255}, {   73,   0, 255}, {   74,   0, 255}, {   81,   0, 255},
+  {   82,   0, 255}, {  235,   0, 255}, {  363,   0, 255}, {  364,   0, 255},
+  {  755,   0, 255}, {  876,   0, 255}, {  883,   0, 255}, {  884,   0, 255},
+  {  891,   0, 255}, {  892,   0, 255}, { 1003,   0, 255}, { 1011,   0, 255},
+  { 1012,   0, 255}, { 1019,   0, 255}, { 1130,   0, 255}, { 1131,   0, 255},
+  { 1139,   0, 255}, { 1140,   0, 255}, { 1147,   0, 255}, { 1250,   0, 255},
+  { 1258,   0, 255}, { 1259,   0, 255}, { 1266,   0, 255}, { 1267,   0, 255},
+  { 1275,   0, 255}, { 1370,   0, 255}, { 1378,   0, 255}, { 1386,   0, 255},
+  { 1387,   0, 255}, { 1394,   0, 255}, { 1395,   0, 255}, { 1402,   0, 255},
+  { 1498,   0, 255}, { 1506,   0, 255}, { 1514,   0, 255}, { 1634,   0, 255},
+  { 1642,   0, 255}, { 1778,   0, 255}, { 1786,   0, 255}, { 1914,   0, 255},
+  { 4234,   0, 255}, { 4498,   0, 255}, { 4626,   0, 255}, {   51,   0, 204},
+  {   58,   0, 204}, {   66,   0, 204}, {  187,   0, 204}, {  195,   0, 204},
+  {  203,   0, 204}, {  372,   0, 204}, {  500,   0, 204}, {  627,   0, 204},
+  {  748,   0, 204}, {  756,   0, 204}, {  764,   0, 204}, {  803,   0, 204},
+  {  868,   0, 204}, {  923,   0, 204}, {  931,   0, 204}, {  980,   0, 204},
+  {  988,   0, 204}, {  995,   0, 204}, {  996,   0, 204}, { 1004,   0, 204},
+  { 1005,   0, 204}, { 1013,   0, 204}, { 1020,   0, 204}, { 1021,   0, 204},
+  { 1051,   0, 204}, { 1059,   0, 204}, { 1108,   0, 204}, { 1115,   0, 204},
+  { 1123,   0, 204}, { 1124,   0, 204}, { 1132,   0, 204}, { 1133,   0, 204},
+  { 1148,   0, 204}, { 1236,   0, 204}, { 1243,   0, 204}, { 1251,   0, 204},
+  { 1252,   0, 204}, { 1260,   0, 204}, { 1268,   0, 204}, { 1371,   0, 204},
+  { 1379,   0, 204}, { 1492,   0, 204}, { 1499,   0, 204}, { 1507,   0, 204},
+  { 1515,   0, 204}, { 1522,   0, 204}, { 1530,   0, 204}, { 1620,   0, 204},
+  { 1627,   0, 204}, { 1635,   0, 204}, { 1650,   0, 204}, { 1658,   0, 204},
+  { 2042,   0, 204}, { 2043,   0, 204}, { 4098,   0, 204}, { 4106,   0, 204},
+  { 4227,   0, 204}, { 4370,   0, 204}, { 4506,   0, 204}, { 4634,   0, 204},
+  { 4754,   0, 204}, {  133,  31,  63}, {  773,  31,  63}, { 1684,  31,  63},
+  { 1716,  31,  63}, { 2142,  31,  31}, { 2157,  31,  63}, { 2285,  31,  63},
+  { 2350,  31,  63}, { 2382,  31,  63}, { 2389,  31,  63}, { 2405,  31,  31},
+  { 2486,  31,  63}, { 2509,  31,  63}, { 2510,  31,  63}, { 2614,  31,  63},
+  { 2630,  31,  63}, { 2654,  31,  31}, { 2725,  31,  63}, { 2741,  31,  63},
+  { 2749,  31,  63}, { 2757,  31,  63}, { 2765,  31,  63}, { 2877,  31,  63},
+  { 2893,  31,  63}, { 2901,  31,  63}, { 2909,  31,  31}, { 2917,  31,  31},
+  { 3253,  31,  63}, { 3277,  31,  63}, { 4980,  31,  63}, { 4989,  31,  63},
+  {  134,  28,  56}, { 1805,  28,  56}, { 1813,  28,  56}, { 2134,  28,  56},
+  { 2390,  28,  56}, { 2526,  28,  28}, { 2534,  28,  28}, { 2638,  28,  56},
+  { 2742,  28,  56}, { 2774,  28,  56}, { 2870,  28,  56}, { 2885,  28,  56},
+  { 2902,  28,  56}, { 2910,  28,  56}, { 3030,  28,  56}, { 3038,  28,  56},
+  { 3158,  28,  56}, {  262,  25,  51}, { 1725,  25,  51}, { 1934,  25,  51},
+  { 2005,  25,  51}, { 2150,  25,  51}, { 2270,  25,  25}, { 2518,  25,  51},
+  { 2646,  25,  51}, { 2750,  25,  51}, { 2758,  25,  51}, { 2766,  25,  51},
+  { 2782,  25,  51}, { 2862,  25,  51}, { 2878,  25,  51}, { 2886,  25,  51},
+  { 2894,  25,  51}, { 2998,  25,  51}, { 3006,  25,  51}, { 3014,  25,  51},
+  { 3142,  25,  51}, { 3150,  25,  51}, { 2262,  23,  46}, { 2406,  23,  23},
+  { 3022,  23,  46}, { 1294,  21,  63}, { 1350,  21,  63}, { 1430,  21,  63},
+  { 1606,  21,  63}, { 1678,  21,  63}, { 1702,  21,  63}, { 1814,  21,  63},
+  { 1990,  21,  63}, { 2062,  21,  63}, { 2398,  21,  21}, { 2710,  21,  63},
+  { 2926,  21,  63}, { 3054,  21,  63}, { 1166,  19,  58}, { 1334,  19,  58},
+  { 1342,  19,  58}, { 1854,  19,  58}, { 3182,  19,  58}, { 3190,  19,  58},
+  { 3454,  19,  58}, { 1214,  18,  54}, { 1726,  18,  54}, { 1734,  18,  54},
+  { 1862,  18,  54}, { 1718,  17,  51}, { 2055,  17,  51}, { 2231,  17,  51},
+  { 2239,  17,  51}, { 2367,  17,  51}, { 2495,  17,  51}, { 4055,  17,  51},
+  {  102,  15,  63}, {  127,  31,  63}, {  238,  31,  63}, {  511,  31,  63},
+  { 2271,  31,  31}, { 2503,  31,  31}, { 2663,  15,  47}, { 2671,  15,  47},
+  { 4150,  15,  63}, {  255,  30,  60}, {  383,  30,  60}, { 2175,  15,  60},
+  { 2263,  30,  30}, { 2399,  30,  30}, { 2527,  30,  30}, { 2687,  15,  45},
+  { 2815,  15,  45}, { 2943,  15,  45}, { 3071,  15,  45}, { 2679,  14,  42},
+  { 2791,  14,  42}, { 2799,  14,  42}, { 2807,  14,  42}, { 2919,  14,  42},
+  { 2927,  14,  42}, { 2935,  14,  42}, { 3047,  14,  42}, { 3055,  14,  42},
+  { 3063,  14,  42}, { 3191,  14,  42}, { 3199,  14,  42}, { 3327,  14,  42},
+  { 3455,  14,  42}, { 3583,  14,  42}, { 3983,  14,  56}, { 3991,  14,  56},
+  { 3999,  14,  56}, { 4135,  14,  56}, { 4143,  14,  56}, { 4151,  14,  56},
+  { 4159,  14,  56}, {  103,  13,  53}, {  111,  13,  53}, {  119,  13,  53},
+  {  231,  12,  51}, {  239,  12,  51}, {  247,  12,  51}, {  359,  12,  51},
+  {  367,  12,  51}, {  375,  12,  51}, {  487,  12,  51}, {  495,  12,  51},
+  {  503,  12,  51}, { 2151,  25,  51}, { 2159,  25,  51}, { 2167,  25,  51},
+  {  117,  31, 127}, {  126,  31, 127}, {  781,  31,  95}, {  902,  31,  95},
+  { 1030,  31,  95}, { 1157,  31,  95}, { 1188,  31,  95}, { 1285,  31,  95},
+  { 2445,  31,  95}, { 2566,  31,  95}, { 3508,  31,  95}, { 3661,  31,  95},
+  { 4213,  31, 127}, { 4444,  31,  95}, { 4477,  31,  95}, {  108,  28, 113},
+  {  598,  28,  85}, {  630,  28, 113}, {  638,  28, 113}, {  758,  28, 113},
+  {  774,  28,  85}, {  990,  28, 113}, { 1109,  28, 113}, { 1118,  28, 113},
+  { 1158,  28,  85}, { 1221,  28,  85}, { 1286,  28,  85}, { 1293,  28,  85},
+  { 1414,  28,  85}, { 1485,  28, 113}, { 1885,  28,  85}, { 2086,  28,  85},
+  { 2087,  28,  85}, { 2095,  28,  85}, { 2103,  28,  85}, { 2111,  28,  85},
+  { 2550,  28,  85}, { 2581,  28,  85}, { 2590,  28,  85}, { 4429,  28,  85},
+  { 4461,  28, 113}, { 4973,  28,  85}, { 4981,  28,  85}, { 5109,  28,  85},
+  { 5110,  28,  85}, { 5988,  28,  85}, { 5996,  28,  85}, { 6108,  28,  85},
+  { 6116,  28,  85}, { 6124,  28,  85}, {   15,  25, 102}, {   23,  25, 102},
+  {   31,  25, 102}, {  254,  25, 102}, {  333,  25, 102}, {  341,  25, 102},
+  {  590,  25,  76}, {  614,  25, 102}, {  646,  25,  76}, {  742,  25, 102},
+  { 1061,  25, 102}, { 1085,  25,  76}, { 1093,  25,  76}, { 1173,  25,  76},
+  { 1213,  25,  76}, { 1357,  25, 102}, { 1542,  25,  76}, { 1877,  25,  76},
+  { 1893,  25, 102}, { 1902,  25, 102}, { 1910,  25, 102}, { 1981,  25,  76},
+  { 1989,  25,  76}, { 2030,  25, 102}, { 2165,  25,  76}, { 2574,  25,  76},
+  { 2582,  25,  76}, { 2702,  25,  76}, { 2838,  25,  76}, { 3174,  25,  76},
+  { 3582,  25,  76}, { 3645,  25, 102}, { 3653,  25, 102}, { 3710,  25,  76},
+  { 4301,  25,  76}, { 4437,  25,  76}, { 4606,  25,  76}, { 5238,  25,  76},
+  { 5374,  25,  76}, {  142,  23,  69}, {  150,  23,  69}, {  213,  23,  92},
+  {  270,  23,  69}, {  470,  23,  92}, {  478,  23,  92}, {  622,  23,  92},
+  {  734,  23,  92}, { 1205,  23,  69}, { 1422,  23,  69}, { 1493,  23,  92},
+  { 1550,  23,  69}, { 1686,  23,  69}, { 1694,  23,  69}, { 1822,  23,  69},
+  { 1830,  23,  69}, { 1853,  23,  69}, { 1869,  23,  69}, { 1982,  23,  69},
+  { 2022,  23,  92}, { 2061,  23,  69}, { 2174,  23,  92}, { 2454,  23,  69},
+  { 2718,  23,  69}, { 2966,  23,  92}, { 3541,  23,  69}, { 3550,  23,  69},
+  { 6125,  23,  69}, {   69,  21,  85}, {  205,  21,  85}, {  486,  21,  85},
+  {  750,  21,  85}, {  862,  21,  85}, {  870,  21,  85}, { 1886,  21,  85},
+  { 1894,  21,  85}, { 2006,  21,  85}, { 3230,  21,  85}, { 3238,  21,  85},
+  { 3510,  21,  85}, { 3518,  21,  85}, { 6077,  21,  85}, {   77,  19,  78},
+  {   85,  19,  78}, {  214,  19,  78}, {  350,  19,  78}, {  358,  19,  78},
+  { 1486,  19,  78}, { 3414,  19,  78}, { 3526,  19,  78}, { 3534,  19,  78},
+  { 3542,  19,  78}, { 4278,  19,  78}, { 4414,  19,  78}, {   86,  18,  72},
+  {   94,  18,  72}, {  222,  18,  72}, {  230,  18,  72}, {  342,  18,  72},
+  { 3662,  18,  72}, { 3670,  18,  72}, { 3790,  18,  72}, { 4470,  18,  72},
+  { 2567,  17,  68}, { 2695,  17,  68}, { 2823,  17,  68}, { 2951,  17,  68},
+  { 3103,  17,  68}, {    3,  63,  63}, {   11,  63,  63}, {  130,  63,  63},
+  {  131,  63,  63}, {  900,  63,  63}, { 1027,  63,  63}, { 1155,  63,  63},
+  { 1163,  63,  63}, { 1291,  63,  63}, { 1299,  63,  63}, { 1426,  63,  63},
+  { 1441,  63,  63}, { 1537,  63,  63}, { 1538,  63,  63}, { 1883,  63,  63},
+  { 1891,  63,  63}, { 2010,  63,  63}, { 2380,  63,  63}, { 2396,  63,   0},
+  { 2404,  63,   0}, { 2412,  63,   0}, { 2498,  63,  63}, { 2499,  63,  63},
+  { 2507,  63,  63}, { 2508,  63,  63}, { 2515,  63,   0}, { 2626,  63,  63},
+  { 2634,  63,  63}, { 2635,  63,  63}, { 2763,  63,  63}, { 3066,  63,  63},
+  { 5098,  63,   0}, { 5114,  63,  63}, { 5225,  63,   0}, { 5226,  63,   0},
+  { 5234,  63,   0}, { 5242,  63,  63}, { 5362,  63,   0}, { 5370,  63,  63},
+  { 6003,  63,   0}, { 6011,  63,   0}, { 6041,  63,  63}, { 6057,  63,  63},
+  { 6065,  63,  63}, { 6122,  63,  63}, { 6130,  63,   0}, { 6138,  63,   0},
+  { 1156,  51,  51}, { 1570,  51,  51}, { 1579,  51,  51}, { 2011,  51,  51},
+  { 2019,  51,  51}, { 2516,  51,   0}, { 2524,  51,   0}, { 2532,  51,   0},
+  { 2533,  51,   0}, { 2539,  51,   0}, { 2540,  51,   0}, { 2643,  51,   0},
+  { 2652,  51,   0}, { 2659,  51,   0}, { 2660,  51,   0}, { 2667,  51,   0},
+  { 2668,  51,   0}, { 2780,  51,   0}, { 2788,  51,   0}, { 2796,  51,   0},
+  { 5107,  51,  51}, { 5235,  51,  51}, { 5243,  51,  51}, { 5371,  51,  51},
+  { 5372,  51,  51}, { 6073,  51,  51}, { 1283,  42,  42}, { 1411,  42,  42},
+  { 1419,  42,  42}, { 2269,  42,  42}, { 2277,  42,  42}, { 2413,  42,  42},
+  { 2517,  42,  42}, { 2525,  42,   0}, { 2636,  42,  42}, { 2644,  42,  42},
+  { 2645,  42,  42}, { 2653,  42,   0}, { 2661,  42,   0}, { 2772,  42,  42},
+  { 5506,  42,  42}, { 5634,  42,  42}, { 2781,  36,  36}, { 2789,  36,  36},
+  { 6004,  36,  36}, { 1300,  63,  63}, { 1332,  63,  63}, { 1413,  63,  63},
+  { 1436,  63,  31}, { 1437,  63,  31}, { 1541,  63,  63}, { 1548,  63,  63},
+  { 1556,  63,  31}, { 1565,  63,  31}, { 1572,  63,  31}, { 1573,  63,  31},
+  { 1797,  63,  63}, { 2013,  63,  63}, { 2021,  63,  63}, { 2214,  63,  63},
+  { 2462,  63,  63}, { 2470,  63,  63}, { 2557,  63,  63}, { 2589,  63,  63},
+  { 2662,  63,   0}, { 2670,  63,  31}, { 2941,  63,  63}, { 3053,  63,  63},
+  { 3166,  63,  63}, { 3189,  63,  63}, { 3709,  63,  63}, { 1301,  56,  56},
+  { 1308,  56,  56}, { 1316,  56,  56}, { 1341,  56,  56}, { 1421,  56,  56},
+  { 1549,  56,  56}, { 1581,  56,  56}, { 1669,  56,  56}, { 1693,  56,  56},
+  { 1701,  56,  56}, { 1709,  56,  56}, { 1997,  56,  56}, { 2014,  56,  56},
+  { 2053,  56,  56}, { 2334,  56,  56}, { 2342,  56,  56}, { 2421,  56,  56},
+  { 2478,  56,  56}, { 2542,  56,  56}, { 2606,  56,  56}, { 2813,  56,  56},
+  { 2933,  56,  56}, { 3061,  56,  56}, { 3197,  56,  56}, { 3581,  56,  56},
+  { 6142,  56,  56}, { 1309,  51,  51}, { 1317,  51,  51}, { 1333,  51,  51},
+  { 1429,  51,  51}, { 1446,  51,  51}, { 1453,  51,  51}, { 1461,  51,  51},
+  { 1557,  51,  51}, { 1558,  51,  51}, { 1574,  51,  51}, { 1588,  51,  51},
+  { 1589,  51,  51}, { 1670,  51,  51}, { 1677,  51,  51}, { 1685,  51,  51},
+  { 1733,  51,  51}, { 1798,  51,  51}, { 2598,  51,  51}, { 2726,  51,  51},
+  { 2734,  51,  51}, { 2790,  51,  25}, { 2806,  51,  51}, { 2814,  51,  51},
+  { 2918,  51,  51}, { 3046,  51,  51}, { 3062,  51,  51}, { 3069,  51,  51},
+  { 3413,  51,  51}, { 3669,  51,  51}, { 1325,  46,  46}, { 1438,  46,  46},
+  { 1470,  46,  46}, { 1566,  46,  46}, { 1598,  46,  46}, { 1717,  46,  46},
+  { 1806,  46,  46}, { 2054,  46,  46}, { 2934,  46,  46}, { 2942,  46,  46},
+  { 3070,  46,  46}, { 3198,  46,  46}, { 3366,  46,  46}, { 3486,  46,  46},
+  { 3494,  46,  46}, { 1454,  42,  42}, { 1462,  42,  42}, { 1582,  42,  42},
+  { 2119,  63,  42}, { 2127,  63,  42}, { 2135,  63,  42}, { 2143,  63,  42},
+  { 3302,  63,  63}, { 3422,  63,  42}, { 3430,  63,  42}, { 3438,  63,  63},
+  { 3622,  63,  42}, { 3678,  63,  42}, { 3686,  63,  42}, { 3806,  63,  42},
+  { 3910,  42,  63}, { 4030,  63,  42}, { 4071,  42,  63}, { 4079,  42,  63},
+  { 4087,  42,  63}, { 4095,  63,  63}, { 4324,  63,  63}, { 1590,  39,  39},
+  { 1710,  39,  39}, { 2414,  39,  58}, { 3286,  39,  39}, { 3310,  39,  58},
+  { 3326,  39,  58}, { 3446,  39,  58}, { 3566,  39,  58}, { 3574,  39,  58},
+  { 3614,  58,  39}, { 3630,  39,  58}, { 3694,  39,  58}, { 3758,  58,  58},
+  { 3798,  39,  58}, { 3886,  58,  58}, { 3894,  58,  58}, { 3902,  39,  58},
+  { 4014,  58,  58}, { 4180,  58,  58}, { 4187,  58,  58}, { 4188,  58,  58},
+  { 4196,  58,  58}, { 2070,  54,  54}, { 2631,  36,  36}, { 2639,  36,  36},
+  { 2647,  36,  36}, { 2655,  36,  36}, { 2775,  36,  36}, { 2783,  36,  36},
+  { 2911,  36,  36}, { 3039,  36,  36}, { 3318,  36,  54}, { 3558,  36,  36},
+  { 4063,  36,  36}, { 4309,  54,  54}, { 4316,  54,  54}, { 4325,  51,  51},
+  { 4445,  51,  51}, { 2247,  45,  30}, { 4189,  45,  45}, { 4317,  45,  45},
+  { 2255,  42,  28}, { 2375,  42,  28}, { 2383,  42,  28}, { 2391,  42,  28},
+  { 2511,  42,  28}, { 2519,  42,  28}, { 4181,  42,  42}, { 4197,  42,  42},
+  { 4302,  56,  42}, { 4174,  51,  38}, { 4190,  36,  36}, { 4198,  36,  36},
+  { 4310,  36,  36}, { 4318,  36,  36}, { 4167,  33,  33}, { 4175,  33,  33},
+  { 4182,  33,  33}, { 4183,  33,  33}, { 4191,  33,  33}, {  114,  63, 127},
+  {  122,  63, 127}, {  250,  63, 127}, { 1323,  63, 127}, { 1459,  63, 127},
+  { 1483,  63, 127}, { 1666,  63, 127}, { 1794,  63, 127}, { 1795,  63, 127},
+  { 1803,  63, 127}, { 1804,  63, 127}, { 1922,  63, 127}, { 1931,  63, 127},
+  { 1978,  63, 127}, { 1986,  63, 127}, { 2170,  63, 127}, { 2820,  63, 127},
+  { 2947,  63, 127}, { 2948,  63, 127}, { 2955,  63, 127}, { 2956,  63, 127},
+  { 2964,  63, 127}, { 3075,  63, 127}, { 3083,  63, 127}, { 3084,  63, 127},
+  { 3092,  63, 127}, { 3203,  63, 127}, { 3283,  63, 127}, { 3291,  63, 127},
+  { 3299,  63, 127}, { 3331,  63, 127}, { 3339,  63, 127}, { 3387,  63, 127},
+  { 3395,  63, 127}, { 3419,  63, 127}, { 3443,  63, 127}, { 3451,  63, 127},
+  { 3458,  63, 127}, { 3514,  63, 127}, { 3522,  63, 127}, { 3563,  63, 127},
+  { 3586,  63, 127}, { 3642,  63, 127}, { 3650,  63, 127}, { 3899,  63, 127},
+  { 4027,  63, 127}, { 4035,  63, 127}, { 4044,  63, 127}, { 4219,  63, 127},
+  { 4595,  63, 127}, { 4603,  63, 127}, { 4722,  63, 127}, {   12,  51, 102},
+  {   20,  51, 102}, {   21,  51, 102}, {  132,  51, 102}, {  139,  51, 102},
+  {  140,  51, 102}, {  141,  51, 102}, {  149,  51, 102}, { 1028,  51, 102},
+  { 1164,  51, 102}, { 1172,  51, 102}, { 1204,  51, 102}, { 1612,  51, 102},
+  { 1667,  51, 102}, { 1668,  51, 102}, { 1675,  51, 102}, { 1796,  51, 102},
+  { 1899,  51, 102}, { 1923,  51, 102}, { 1932,  51, 102}, { 2027,  51, 102},
+  { 2221,  51, 102}, { 2230,  51, 102}, { 2238,  51, 102}, { 2292,  51, 102},
+  { 2349,  51, 102}, { 2356,  51, 102}, { 2357,  51, 102}, { 2364,  51, 102},
+  { 2365,  51, 102}, { 2372,  51, 102}, { 2373,  51, 102}, { 2476,  51, 102},
+  { 2483,  51, 102}, { 2484,  51, 102}, { 2491,  51, 102}, { 2492,  51, 102},
+  { 2500,  51, 102}, { 2611,  51, 102}, { 2618,  51, 102}, { 2619,  51, 102},
+  { 2620,  51, 102}, { 2627,  51, 102}, { 2628,  51, 102}, { 2747,  51, 102},
+  { 2755,  51, 102}, { 2965,  51, 102}, { 2980,  51, 102}, { 2981,  51, 102},
+  { 3100,  51, 102}, { 3108,  51, 102}, { 3194,  51, 102}, { 3195,  51, 102},
+  { 3244,  51, 102}, { 3252,  51, 102}, { 3323,  51, 102}, { 3380,  51, 102},
+  { 3643,  51, 102}, { 3771,  51, 102}, { 3772,  51, 102}, { 3779,  51, 102},
+  { 3780,  51, 102}, { 4596,  51, 102}, { 4723,  51, 102}, { 4731,  51, 102},
+  { 4859,  51, 102}, { 4979,  51, 102}, { 5115,  51, 102}, {  380,  42, 127},
+  {  597,  42, 127}, {  733,  42, 127}, {  908,  42, 127}, { 1036,  42, 127},
+  { 1292,  42,  85}, { 1356,  42, 127}, { 1924,  42,  85}, { 1933,  42,  85},
+  { 2028,  42, 127}, { 2213,  42,  85}, { 2246,  42,  85}, { 2253,  42,  85},
+  { 2341,  42,  85}, { 2381,  42,  85}, { 2428,  42,  85}, { 2477,  42,  85},
+  { 2485,  42,  85}, { 2604,  42,  85}, { 2612,  42,  85}, { 2701,  42, 127},
+  { 2709,  42, 127}, { 2717,  42,  85}, { 2732,  42,  85}, { 2740,  42,  85},
+  { 2748,  42,  85}, { 2756,  42,  85}, { 2764,  42,  85}, { 2860,  42,  85},
+  { 2989,  42,  85}, { 3067,  42,  85}, { 3068,  42,  85}, { 3117,  42,  85},
+  { 3187,  42,  85}, { 3196,  42,  85}, { 3293,  42,  85}, { 3308,  42,  85},
+  { 3660,  42,  85}, { 3788,  42,  85}, { 3900,  42,  85}, { 4036,  42,  85},
+  { 4307,  42,  85}, { 4460,  42, 127}, { 4588,  42, 127}, { 4716,  42, 127},
+  { 4724,  42,  85}, { 4732,  42,  85}, { 4851,  42,  85}, { 4852,  42,  85},
+  { 4860,  42,  85}, { 5108,  42,  85}, { 5236,  42,  85}, { 5244,  42,  85},
+  { 5946,  42,  85}, { 6082,  42,  85}, {   30,  36, 109}, {  469,  36, 109},
+  {  725,  36, 109}, {  901,  36, 109}, {  909,  36, 109}, { 1029,  36, 109},
+  { 1037,  36, 109}, { 1044,  36, 109}, { 1165,  36, 109}, { 1196,  36, 109},
+  { 1212,  36,  72}, { 1284,  36,  72}, { 1412,  36,  72}, { 1540,  36,  72},
+  { 1708,  36,  72}, { 1844,  36,  72}, { 1884,  36,  72}, { 1892,  36,  72},
+  { 1972,  36,  72}, { 2020,  36,  72}, { 2156,  36,  72}, { 2172,  36, 109},
+  { 2254,  36,  72}, { 2261,  36,  72}, { 2358,  36,  72}, { 2366,  36,  72},
+  { 2374,  36,  72}, { 2437,  36, 109}, { 2453,  36,  72}, { 2461,  36,  72},
+  { 2469,  36,  72}, { 2493,  36,  72}, { 2494,  36,  72}, { 2501,  36,  72},
+  { 2502,  36,  72}, { 2565,  36, 109}, { 2573,  36, 109}, { 2597,  36,  72},
+  { 2605,  36,  72}, { 2613,  36,  72}, { 2621,  36,  72}, { 2622,  36,  72},
+  { 2629,  36,  72}, { 2637,  36,  72}, { 2693,  36, 109}, { 2733,  36,  72},
+  { 2773,  36,  72}, { 2821,  36, 109}, { 2829,  36, 109}, { 2845,  36,  72},
+  { 2853,  36,  72}, { 2861,  36,  72}, { 2868,  36,  72}, { 2869,  36,  72},
+  { 2876,  36,  72}, { 2884,  36,  72}, { 2997,  36,  72}, { 3060,  36,  72},
+  { 3125,  36,  72}, { 3173,  36,  72}, { 3188,  36,  72}, { 3260,  36,  72},
+  { 3396,  36, 109}, { 4861,  36,  72}, { 6074,  36, 109}, { 6107,  36,  72},
+  { 6115,  36,  72}, {    6,  63,  95}, {    7,  63,  95}, {   14,  63,  95},
+  {   91,  63, 127}, {  219,  63, 127}, {  477,  63,  95}, {  605,  63,  95},
+  {  606,  63,  95}, { 1613,  63,  95}, { 5118,  63,  95}, { 5246,  63,  95},
+  {   22,  56,  85}, {  212,  56, 113}, {  220,  56, 113}, {  228,  56, 113},
+  {  349,  56, 113}, {  357,  56, 113}, {  365,  56, 113}, {  485,  56, 113},
+  {  493,  56, 113}, { 3325,  56,  85}, {   84,  51, 102}, {   92,  51, 102},
+  {  101,  51, 102}, {  221,  51, 102}, {  229,  51, 102}, {  494,  51, 102},
+  { 1861,  51,  76}, { 2429,  51,  76}, { 2694,  51,  76}, { 2822,  51,  76},
+  { 3094,  51, 102}, { 3309,  51,  76}, { 3317,  51,  76}, { 3445,  51,  76},
+  { 3453,  51,  76}, { 3509,  51,  76}, { 3637,  51,  76}, { 3781,  51,  76},
+  { 3789,  51,  76}, { 3830,  51,  76}, { 3958,  51,  76}, { 4149,  51,  76},
+  {   76,  46,  92}, {   93,  46,  92}, {  237,  46,  92}, {  502,  46,  92},
+  { 1478,  46,  69}, { 2206,  46,  69}, { 2558,  46,  69}, { 2830,  46,  69},
+  { 3222,  46,  69}, { 3381,  46,  69}, { 3533,  46,  92}, { 3702,  46,  69},
+  { 3838,  46,  69}, {  109,  63,  85}, { 3646,  42,  85}, { 3774,  42,  85},
+  { 3782,  42,  85}, { 4286,  42,  85}, { 4294,  42,  85}, {  366,  39,  78},
+  { 3638,  39,  78}, { 3654,  39,  78}, { 3711,  39,  78}, { 3839,  39,  78},
+  { 3967,  39,  78}, {  374,  36,  72}, { 3766,  36,  72}, {  110,  34,  68},
+  {  246,  34,  68}, {  218,  63, 191}, {  355,  63, 191}, {  619,  63, 191},
+  { 1906,  63, 191}, { 2041,  63, 191}, { 3962,  63, 191}, { 4083,  63, 191},
+  { 4090,  63, 191}, { 4331,  63, 191}, {   98,  51, 153}, {  115,  51, 153},
+  {  116,  51, 153}, {  123,  51, 153}, {  251,  51, 153}, {  252,  51, 153},
+  {  340,  51, 153}, {  347,  51, 153}, {  468,  51, 153}, {  475,  51, 153},
+  {  484,  51, 153}, {  604,  51, 153}, {  612,  51, 153}, {  620,  51, 153},
+  { 2035,  51, 153}, { 4220,  51, 153}, { 4347,  51, 153}, { 4348,  51, 153},
+  { 4476,  51, 153}, {  227,  42, 170}, {   90,  36, 145}, {   99,  36, 145},
+  {  253,  36, 145}, {  741,  36, 145}, { 1117,  36, 145}, {  211,  51, 204},
+  {  236,  51, 204}, {  120, 255,   0}, { 3192, 255,   0}, {    1, 127,   0},
+  { 3065, 127,   0}, { 3193, 127,   0}, { 5105, 127,   0}, { 5233, 127,   0},
+  { 5240, 127,   0}, { 5241, 127,   0}, {    2,  85,   0}, { 2138,  85,   0},
+  { 2146,  85,   0}, { 2260,  85,   0}, { 2267,  85,   0}, { 2388,  85,   0},
+  { 2420,  85,   0}, { 2547,  85,   0}, { 2810,  85,   0}, { 2931,  85,   0},
+  { 2938,  85,   0}, { 5106,  85,   0}, { 2139, 127,   0}, { 2268, 127,   0},
+  { 2555, 127,   0}, { 2682, 127,   0}, { 2803, 127,   0}, { 2811, 127,   0},
+  { 2939, 127,   0}, { 4154, 127,  63}, { 4170, 127,  63}, { 4283, 127,  63},
+  { 4291, 127,  63}, { 1307, 102,  51}, { 1315, 102,  51}, { 1434, 102,  51},
+  { 1442, 102,  51}, { 2556, 102,   0}, { 2683, 102,   0}, { 3059, 102,  51},
+  { 3315, 102,  51}, { 4155, 153,  51}, { 4162, 153,  51}, { 4178, 102,  51},
+  { 4185, 102,  51}, { 4284, 153,  51}, { 6012, 102,   0}, { 6139, 102,   0},
+  {    4, 127,  42}, { 1435,  85,  42}, { 1443,  85,  42}, { 1451,  85,  42},
+  { 1563,  85,  42}, { 1571,  85,  42}, { 2541,  85,   0}, { 2548,  85,   0},
+  { 2549,  85,   0}, { 2669,  85,   0}, { 2675,  85,   0}, { 2676,  85,   0},
+  { 2677,  85,   0}, { 2684,  85,   0}, { 2804,  85,   0}, { 2932, 127,  42},
+  { 3052,  85,  42}, { 3180,  85,  42}, { 4148, 170,  42}, { 4163, 170,  42},
+  { 4171, 170,  42}, { 4292, 170,  42}, { 6123,  85,  42}, { 6131,  85,  42},
+  { 6132,  85,  42}, { 6140,  85,  42}, { 1420,  72,  36}, { 1427,  72,  36},
+  { 1428,  72,  36}, { 1444,  72,  36}, { 1555,  72,  36}, { 1564,  72,  36},
+  { 1580,  72,  36}, { 1692,  72,  36}, { 1700,  72,  36}, { 2004,  72,  36},
+  { 2012,  72,  36}, { 2397, 109,   0}, { 2678,  72,  36}, { 2685,  72,  36},
+  { 2686,  72,  36}, { 2797,  72,  36}, { 2805,  72,  36}, { 2812,  72,  36},
+  { 4156, 182,  36}, { 4164, 182,  36}, { 4172, 145,  36}, { 1460,  95,  63},
+  { 1469,  95,  63}, { 1477,  95,  63}, { 1605,  95,  63}, { 1926,  95,  63},
+  { 3221, 127,  63}, { 3301,  95,  63}, { 3373,  95,  63}, { 3421,  95,  63},
+  { 3429,  95,  63}, { 3461,  95,  63}, { 3477,  95,  63}, { 3493, 127,  63},
+  { 3549,  95,  63}, { 3557,  95,  63}, { 3573,  95,  63}, { 3588,  95,  63},
+  { 3589,  95,  63}, { 3604,  95,  63}, { 3605,  95,  63}, { 3620, 127,  63},
+  { 3621, 127,  63}, { 3636,  95,  63}, { 3677,  95,  63}, { 3693, 127,  63},
+  { 3813, 127,  63}, { 3821, 127,  63}, { 3844, 159,  63}, { 3909,  95,  63},
+  { 3972, 159,  63}, { 3980, 159,  63}, { 3981, 159,  63}, { 4004, 159,  63},
+  { 4012, 159,  63}, { 4029,  95,  63}, { 4037,  95,  63}, { 4045,  95,  63},
+  { 4062, 159,  63}, { 4157, 191,  31}, { 4165, 191,  31}, { 4186, 127,  63},
+  { 4194, 127,  63}, { 1445,  85,  28}, { 2925,  85,  28}, { 3206,  85,  56},
+  { 3213,  85,  56}, { 3214,  85,  56}, { 3333,  85,  56}, { 3341,  85,  56},
+  { 3349,  85,  56}, { 3469,  85,  56}, { 3485,  85,  56}, { 3565, 141,  56},
+  { 3597,  85,  56}, { 3613,  85,  56}, { 3685, 141,  56}, { 3725, 113,  56},
+  { 3733,  85,  56}, { 3741, 113,  56}, { 3797,  85,  56}, { 3845, 141,  56},
+  { 3853, 141,  56}, { 3861, 141,  56}, { 3901, 113,  56}, { 3917,  85,  56},
+  { 3934, 113,  56}, { 3973, 170,  56}, { 3997, 113,  56}, { 4005, 141,  56},
+  { 4013, 113,  56}, { 4158, 141,  28}, { 4166, 141,  28}, { 4179, 141,  56},
+  { 4285,  85,  56}, { 4293,  85,  56}, { 1597,  76,  51}, { 2798,  76,  25},
+  { 3334, 102,  51}, { 3342, 102,  51}, { 3350,  76,  51}, { 3358,  76,  51},
+  { 3462, 102,  51}, { 3501,  76,  51}, { 3590, 127,  51}, { 3598, 102,  51},
+  { 3629,  76,  51}, { 3717, 127,  51}, { 3877, 102,  51}, { 3885, 127,  51},
+  { 3893, 102,  51}, { 4021,  76,  51}, { 4038,  76,  51}, { 4054, 102,  51},
+  { 1927,  69,  46}, { 3294,  69,  46}, { 3437,  92,  46}, { 3470,  92,  46},
+  { 3478,  92,  46}, { 3606,  92,  46}, { 3749, 115,  46}, { 3757,  92,  46},
+  { 3846, 139,  46}, { 3869, 115,  46}, { 3870, 115,  46}, { 3926,  69,  46},
+  { 3974, 139,  46}, { 4046,  69,  46}, { 3718, 148,  42}, { 3726, 127,  42},
+  { 3742,  85,  42}, { 3750,  85,  42}, { 3878,  85,  63}, { 3975, 127,  42},
+  { 3989, 148,  42}, { 4022,  85,  42}, { 3982, 156,  39}, { 4173, 117,  39},
+  { 3734, 109,  36}, { 3854, 127,  36}, { 3862, 109,  36}, { 3990, 145,  36},
+  { 3998,  91,  54}, {  633, 127, 127}, { 1449, 127, 127}, { 1458, 127, 127},
+  { 1890, 127, 127}, { 1898, 127, 127}, { 2017, 127, 127}, { 2025, 127, 127},
+  { 2026, 127, 127}, { 2033, 127, 127}, { 2298, 127, 127}, { 3449, 127, 127},
+  { 4184, 127, 127}, { 4201, 127, 127}, { 4202, 127, 127}, { 4209, 127, 127},
+  { 4217, 127, 127}, { 4346, 127, 127}, {  121,  85,  85}, { 1314,  85,  85},
+  { 1450,  85,  85}, { 1578,  85,  85}, { 1875,  85,  85}, { 1994,  85,  85},
+  { 1995,  85,  85}, { 2002,  85,  85}, { 2003,  85,  85}, { 2009,  85,  85},
+  { 2018,  85,  85}, { 2625,  85,  85}, { 3026,  85,  85}, { 3154,  85,  85},
+  { 3162,  85,  85}, { 3163,  85,  85}, { 3186,  85,  85}, { 3322, 170,  85},
+  { 4147,  85,  85}, { 4161,  85,  85}, { 4169,  85,  85}, { 4177,  85,  85},
+  { 4193, 170,  85}, { 4210, 170,  85}, { 4218, 170,  85}, { 4299,  85,  85},
+  { 5113,  85,  85}, { 6048,  85,  85}, { 6056,  85,  85}, { 1339, 127, 127},
+  { 1466, 127, 127}, { 1467, 127, 127}, { 1603, 127, 127}, { 3475, 127, 127},
+  { 3499, 127, 127}, { 3570, 127, 127}, { 3571, 127, 127}, { 3578, 127, 127},
+  { 3603, 127, 127}, { 3611, 127, 127}, { 3618, 127, 127}, { 3619, 127, 127},
+  { 3635, 127, 127}, { 3675, 127, 127}, { 3683, 127, 127}, { 3698, 127, 127},
+  { 3699, 127, 127}, { 3706, 127, 127}, { 3746, 127, 127}, { 3755, 127, 127},
+  { 3803, 127, 127}, { 3811, 127, 127}, { 3827, 127, 127}, { 3834, 127, 127},
+  { 3835, 127, 127}, { 3859, 127, 127}, { 3866, 127, 127}, { 3883, 127, 127},
+  { 3916, 127, 127}, { 3969, 127, 127}, { 3986, 127, 127}, { 3987, 127, 127},
+  { 4019, 127, 127}, { 4052, 127, 127}, { 4059, 127, 127}, { 4067, 127, 127},
+  { 4075, 127, 127}, { 4211, 127, 127}, { 1475, 153, 102}, { 1595, 153, 102},
+  { 1851, 102, 102}, { 1852, 102, 102}, { 1859, 102, 102}, { 1979, 102, 102},
+  { 2957, 102, 102}, { 3076, 102, 102}, { 3212, 102, 102}, { 3220, 102, 102},
+  { 3363, 153, 102}, { 3412, 102, 102}, { 3436, 102, 102}, { 3459, 102, 102},
+  { 3467, 102, 102}, { 3483, 153, 102}, { 3491, 153, 102}, { 3500, 153, 102},
+  { 3531, 102, 102}, { 3547, 102, 102}, { 3555, 102, 102}, { 3556, 102, 102},
+  { 3579, 153, 102}, { 3595, 102, 102}, { 3627, 153, 102}, { 3659, 102, 102},
+  { 3668, 153, 102}, { 3707, 153, 102}, { 3715, 102, 102}, { 3723, 102, 102},
+  { 3739, 153, 102}, { 3747, 153, 102}, { 3748, 153, 102}, { 3851, 102, 102},
+  { 3867, 153, 102}, { 3868, 153, 102}, { 3874, 153, 102}, { 3875, 153, 102},
+  { 3931, 153, 102}, { 3939, 153, 102}, { 3994, 153, 102}, { 3995, 153, 102},
+  { 4002, 153, 102}, { 4060, 153, 102}, {  124,  85, 127}, {  476,  85, 127},
+  { 1484,  85,  85}, { 1604,  85,  85}, { 1732,  85,  85}, { 2949, 127,  85},
+  { 2973,  85,  85}, { 3077, 127,  85}, { 3078, 127,  85}, { 3085, 127,  85},
+  { 3093,  85,  85}, { 3101,  85,  85}, { 3109,  85,  85}, { 3204, 127,  85},
+  { 3228,  85,  85}, { 3236,  85,  85}, { 3340,  85,  85}, { 3348, 127,  85},
+  { 3356, 127,  85}, { 3364, 127,  85}, { 3372, 127,  85}, { 3428, 127,  85},
+  { 3444,  85,  85}, { 3452,  85,  85}, { 3468,  85,  85}, { 3484, 127,  85},
+  { 3548, 127,  85}, { 3564, 127,  85}, { 3587,  85,  85}, { 3628, 170,  85},
+  { 3676, 127,  85}, { 3684, 127,  85}, { 3708, 170,  85}, { 3740, 170,  85},
+  { 3756, 170,  85}, { 3796, 170,  85}, { 3804, 170,  85}, { 3812, 170,  85},
+  { 3828, 170,  85}, { 3843, 127,  85}, { 3860, 127,  85}, { 3924, 170,  85},
+  { 3932, 170,  85}, { 3933, 170,  85}, { 3940, 170,  85}, { 3970, 127,  85},
+  { 3971, 127,  85}, { 3979, 127,  85}, { 4011, 170,  85}, { 4061, 170,  85},
+  { 4068, 170,  85}, { 4092,  85, 127}, { 4987,  85,  85}, { 4988,  85,  85},
+  { 6114,  85,  85}, {    5,  72,  72}, {   13,  72,  72}, {  125,  72, 109},
+  {  348,  72, 109}, {  613, 109, 109}, { 1180,  72,  72}, { 1324,  72,  72},
+  { 1340,  72,  72}, { 1348,  72,  72}, { 1349,  72,  72}, { 1452,  72,  72},
+  { 1468,  72,  72}, { 1476,  72,  72}, { 1596,  72,  72}, { 1724, 109,  72},
+  { 1860, 109,  72}, { 1868,  72,  72}, { 1925,  72,  72}, { 1980, 109,  72},
+  { 1987, 109,  72}, { 1988, 109,  72}, { 1996, 109,  72}, { 2085,  72,  72},
+  { 2094,  72,  72}, { 2222,  72,  72}, { 2940,  72,  72}, { 3205,  72,  72},
+  { 3229, 109,  72}, { 3237, 109,  72}, { 3245, 109,  72}, { 3285,  72,  72},
+  { 3332, 109,  72}, { 3357, 109,  72}, { 3365, 109,  72}, { 3404, 109,  72},
+  { 3420,  72,  72}, { 3460,  72,  72}, { 3476,  72,  72}, { 3492, 109,  72},
+  { 3540, 109,  72}, { 3572, 109,  72}, { 3580, 109,  72}, { 3596, 109,  72},
+  { 3612, 145,  72}, { 3692, 145,  72}, { 3700, 109,  72}, { 3701, 109,  72},
+  { 3716, 109,  72}, { 3724, 109,  72}, { 3732, 145,  72}, { 3764, 109,  72},
+  { 3805, 109,  72}, { 3820, 182,  72}, { 3836, 109, 109}, { 3837, 109, 109},
+  { 3852, 145,  72}, { 3876, 182,  72}, { 3884, 145,  72}, { 3892, 109,  72},
+  { 3908,  72,  72}, { 3925, 145,  72}, { 3941, 182,  72}, { 3948, 182,  72},
+  { 3956, 109, 109}, { 3964, 109, 109}, { 3965, 109, 109}, { 3988, 145,  72},
+  { 3996, 182,  72}, { 4003, 182,  72}, { 4020, 109,  72}, { 4028,  72,  72},
+  { 4053, 145,  72}, { 4069, 182,  72}, { 4084, 109, 109}, { 4300,  72,  72},
+  { 4323, 109, 109}, { 4332, 109, 109}, { 4452,  72, 109}, { 5116,  72,  72},
+  { 5117,  72,  72}, { 5245,  72,  72}, { 6013,  72,  72}, { 6133,  72,  72},
+  { 6141,  72,  72}, { 2950,  95,  95}, { 3949, 127,  95}, { 3957, 127,  95},
+  { 4070, 127,  95}, { 4076, 127,  95}, { 4077, 127,  95}, { 4078, 127,  95},
+  { 4085, 127,  95}, { 4093, 127,  95}, {   83,  85, 113}, {  100,  85, 113},
+  { 2958,  85,  85}, { 3086,  85,  85}, { 3829,  85,  85}, { 3950,  85,  85},
+  { 3966,  85,  85}, { 4086,  85,  85}, { 4094,  85,  85}, { 2078,  76,  76},
+  { 3942,  76,  76}, { 4195, 102,  76}, { 4315,  76,  76}, { 3765,  69,  69},
+  { 3773,  69,  69}, { 3814,  69,  69}, { 3822,  69,  69}, { 3918,  69,  69},
+  { 4006,  92,  69}, { 4204,  92,  69}, { 4308,  69,  69}, {  118,  78,  78},
+  {  626,  85, 170}, { 1331,  85, 170}, { 1347,  85, 170}, { 1474,  85, 170},
+  { 1587,  85, 170}, { 1594,  85, 170}, { 1602,  85, 170}, { 1611,  85, 170},
+  { 1723,  85, 170}, { 1731,  85, 170}, { 2034,  85, 170}, { 2162,  85, 170},
+  { 2163,  85, 170}, { 2169,  85, 170}, { 2299,  85, 170}, { 3074,  85, 170},
+  { 3106,  85, 170}, { 3114,  85, 170}, { 3122,  85, 170}, { 3137,  85, 170},
+  { 3146,  85, 170}, { 3251,  85, 170}, { 3259,  85, 170}, { 3267,  85, 170},
+  { 3275,  85, 170}, { 3330,  85, 170}, { 3338,  85, 170}, { 3347,  85, 170},
+  { 3355,  85, 170}, { 3371,  85, 170}, { 3379,  85, 170}, { 3450,  85, 170},
+  { 3457,  85, 170}, { 3465,  85, 170}, { 3466,  85, 170}, { 3473,  85, 170},
+  { 3474,  85, 170}, { 3481,  85, 170}, { 3482,  85, 170}, { 3489,  85, 170},
+  { 3490,  85, 170}, { 3498,  85, 170}, { 3506,  85, 170}, { 3507,  85, 170},
+  { 3539,  85, 170}, { 3546,  85, 170}, { 3562,  85, 170}, { 3577,  85, 170},
+  { 3585,  85, 170}, { 3593,  85, 170}, { 3594,  85, 170}, { 3601,  85, 170},
+  { 3602,  85, 170}, { 3609,  85, 170}, { 3610,  85, 170}, { 3617,  85, 170},
+  { 3626,  85, 170}, { 3667,  85, 170}, { 3674,  85, 170}, { 3690,  85, 170},
+  { 3691,  85, 170}, { 3705,  85, 170}, { 3713,  85, 170}, { 3714,  85, 170},
+  { 3721,  85, 170}, { 3722,  85, 170}, { 3729,  85, 170}, { 3730,  85, 170},
+  { 3731,  85, 170}, { 3737,  85, 170}, { 3738,  85, 170}, { 3745,  85, 170},
+  { 3787,  85, 170}, { 3795,  85, 170}, { 3819,  85, 170}, { 3826,  85, 170},
+  { 3833,  85, 170}, { 3841,  85, 170}, { 3842,  85, 170}, { 3849,  85, 170},
+  { 3850,  85, 170}, { 3857,  85, 170}, { 3858,  85, 170}, { 3865,  85, 170},
+  { 3873,  85, 170}, { 3882,  85, 170}, { 3891,  85, 170}, { 3907,  85, 170},
+  { 3915,  85, 170}, { 3923,  85, 170}, { 3947,  85, 170}, { 3954,  85, 170},
+  { 3961,  85, 170}, { 3977,  85, 170}, { 3978,  85, 170}, { 3985,  85, 170},
+  { 4001,  85, 170}, { 4010,  85, 170}, { 4018,  85, 170}, { 4026,  85, 170},
+  { 4033,  85, 170}, { 4034,  85, 170}, { 4042,  85, 170}, { 4043,  85, 170},
+  { 4050,  85, 170}, { 4051,  85, 170}, { 4058,  85, 170}, { 4066,  85, 170},
+  { 4089,  85, 170}, { 4339,  85, 170}, { 4602,  85, 170}, { 4609,  85, 170},
+  { 4729,  85, 170}, { 4730,  85, 170}, { 4858,  85, 170}, { 3955, 102, 153},
+  { 3963, 102, 153}, { 4091, 102, 153}, { 4203, 102, 153}, {  356,  72, 145},
+};
+
+const uint16_t kPatternIndexBuckets[kIndexFeatureLevels][kIndexFeatureLevels]
+                                 [kIndexMaxHits + 2] = {
+  {
+    {  // syncopation 0, downbeat 0
+          0,   133,   251,   354,   397,   505,   554,   571,
+        575,   584,   586,   586,   587,   589,   590,   590,
+        590,  1052,  1091,  1129,  1175,  1183,  1206,  1209,
+       1210,  1233,  1235,  1239,  1239,  1239,  1239,  1239,
+       1239,  1239,
+    },
+    {  // syncopation 0, downbeat 1
+       1239,  1239,  1239,  1418,  1502,  1677,  1763,  1863,
+       1922,  2136,  2250,  2370,  2457,  2569,  2682,  2799,
+       2928,  2928,  2928,  2928,  2928,  2928,  2928,  2928,
+       2928,  2928,  2928,  2928,  2928,  2928,  2928,  2928,
+       2928,  2928,
+    },
+    {  // syncopation 0, downbeat 2
+       2928,  2928,  2928,  2928,  3085,  3151,  3201,  3287,
+       3392,  3392,  3392,  3392,  3392,  3392,  3392,  3392,
+       3392,  3392,  3392,  3392,  3392,  3392,  3392,  3392,
+       3392,  3392,  3392,  3392,  3392,  3392,  3392,  3392,
+       3392,  3392,
+    },
+    {  // syncopation 0, downbeat 3
+       3392,  3392,  3856,  4412,  4464,  4511,  4573,  4573,
+       4573,  4573,  4573,  4573,  4573,  4573,  4573,  4573,
+       4573,  4573,  4573,  4573,  4573,  4573,  4573,  4573,
+       4573,  4573,  4573,  4573,  4573,  4573,  4573,  4573,
+       4573,  4573,
+    },
+  },
+  {
+    {  // syncopation 1, downbeat 0
+       4573,  4573,  4573,  4573,  4573,  4573,  4573,  4573,
+       4573,  4604,  4621,  4642,  4645,  4658,  4665,  4669,
+       4676,  4685,  4695,  4717,  4720,  4732,  4732,  4732,
+       4732,  4732,  4732,  4732,  4732,  4732,  4732,  4732,
+       4732,  4732,
+    },
+    {  // syncopation 1, downbeat 1
+       4732,  4732,  4732,  4732,  4732,  4732,  4732,  4732,
+       4732,  4747,  4782,  4821,  4849,  4863,  4875,  4884,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,
+    },
+    {  // syncopation 1, downbeat 2
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,
+    },
+    {  // syncopation 1, downbeat 3
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,  4889,  4889,  4889,  4889,  4889,  4889,
+       4889,  4889,
+    },
+  },
+  {
+    {  // syncopation 2, downbeat 0
+       4889,  4889,  4889,  4889,  4889,  4936,  4962,  4978,
+       4981,  5007,  5033,  5062,  5077,  5099,  5121,  5135,
+       5137,  5137,  5140,  5149,  5149,  5150,  5154,  5154,
+       5159,  5159,  5159,  5159,  5159,  5159,  5159,  5159,
+       5159,  5159,
+    },
+    {  // syncopation 2, downbeat 1
+       5159,  5159,  5159,  5159,  5159,  5211,  5279,  5334,
+       5401,  5412,  5422,  5444,  5457,  5463,  5469,  5471,
+       5473,  5473,  5473,  5473,  5473,  5473,  5473,  5473,
+       5473,  5473,  5473,  5473,  5473,  5473,  5473,  5473,
+       5473,  5473,
+    },
+    {  // syncopation 2, downbeat 2
+       5473,  5473,  5473,  5473,  5473,  5482,  5501,  5502,
+       5507,  5507,  5507,  5507,  5507,  5507,  5507,  5507,
+       5507,  5507,  5507,  5507,  5507,  5507,  5507,  5507,
+       5507,  5507,  5507,  5507,  5507,  5507,  5507,  5507,
+       5507,  5507,
+    },
+    {  // syncopation 2, downbeat 3
+       5507,  5507,  5507,  5507,  5507,  5507,  5509,  5509,
+       5509,  5509,  5509,  5509,  5509,  5509,  5509,  5509,
+       5509,  5509,  5509,  5509,  5509,  5509,  5509,  5509,
+       5509,  5509,  5509,  5509,  5509,  5509,  5509,  5509,
+       5509,  5509,
+    },
+  },
+  {
+    {  // syncopation 3, downbeat 0
+       5509,  5509,  5511,  5518,  5530,  5541,  5556,  5582,
+       5603,  5645,  5678,  5696,  5710,  5718,  5720,  5725,
+       5725,  5725,  5725,  5725,  5725,  5725,  5725,  5725,
+       5725,  5725,  5725,  5725,  5725,  5725,  5725,  5725,
+       5725,  5725,
+    },
+    {  // syncopation 3, downbeat 1
+       5725,  5725,  5725,  5742,  5771,  5810,  5854,  5909,
+       5993,  6002,  6011,  6015,  6023,  6023,  6024,  6024,
+       6024,  6024,  6024,  6024,  6024,  6024,  6024,  6024,
+       6024,  6024,  6024,  6024,  6024,  6024,  6024,  6024,
+       6024,  6024,
+    },
+    {  // syncopation 3, downbeat 2
+       6024,  6024,  6024,  6024,  6139,  6139,  6143,  6143,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,
+    },
+    {  // syncopation 3, downbeat 3
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,  6144,  6144,  6144,  6144,  6144,  6144,
+       6144,  6144,
+    },
+  },
+};
+
+}  // namespace generative
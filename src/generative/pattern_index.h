@@ -0,0 +1,88 @@
+#ifndef GENERATIVE_PATTERN_INDEX_H_
+#define GENERATIVE_PATTERN_INDEX_H_
+
+#include <stdint.h>
+
+// Pre-rendered index of the Grids drum map, generated on the host by
+// host/pattern_indexer.cpp (make pattern-index) into pattern_index.cc.
+//
+// The index covers a grid of (drum part, x, y, density) cells. Every cell's
+// 32-step trigger pattern is rendered once and described by a few features.
+// The cells are bucketed by syncopation level, downbeat level and hit count,
+// in that order, so the cells of one (syncopation, downbeat) bucket with a hit
+// count in any range are contiguous: Randomize() draws from up to 4 x 4 such
+// runs, whatever their size.
+
+namespace generative {
+
+static const uint8_t kIndexParts = 3;            // BD, SD, HH
+static const uint8_t kIndexXYLevels = 16;        // x, y = level * 17 (0-255)
+static const uint8_t kIndexDensityLevels = 8;    // density = 31 + level * 32 (31-255)
+static const uint16_t kIndexCells =
+    kIndexParts * kIndexXYLevels * kIndexXYLevels * kIndexDensityLevels;
+static const uint8_t kIndexMaxHits = 32;
+static const uint8_t kIndexFeatureLevels = 4;
+
+// Cell id: ((part * 16 + y_level) * 16 + x_level) * 8 + density_level
+inline uint8_t IndexCellPart(uint16_t cell) { return cell >> 11; }
+inline uint8_t IndexCellY(uint16_t cell) { return ((cell >> 7) & 0x0F) * 17; }
+inline uint8_t IndexCellX(uint16_t cell) { return ((cell >> 3) & 0x0F) * 17; }
+inline uint8_t IndexCellDensity(uint16_t cell) { return 31 + (cell & 0x07) * 32; }
+
+struct PatternIndexEntry {
+    uint16_t cell;
+    uint8_t syncopation;  // share of hits on off-beat steps before a silent beat (0-255)
+    uint8_t downbeat;     // share of hits on quarter-note steps (0-255)
+};
+
+struct PatternFeatures {
+    uint8_t hits;
+    uint8_t syncopation;
+    uint8_t downbeat;
+};
+
+// Features of a 32-step trigger mask (8 steps per quarter note)
+inline PatternFeatures ComputePatternFeatures(uint32_t mask) {
+    PatternFeatures f = {0, 0, 0};
+    uint8_t on_beat = 0;
+    uint8_t syncopated = 0;
+    for (uint8_t step = 0; step < 32; ++step) {
+        if (!((mask >> step) & 1)) {
+            continue;
+        }
+        f.hits++;
+        if ((step & 0x07) == 0) {
+            on_beat++;
+        } else if ((step & 0x03) != 0) {
+            // Off the 8th-note grid: syncopated if the next 8th is silent
+            const uint8_t next = ((step | 0x03) + 1) & 0x1F;
+            if (!((mask >> next) & 1)) {
+                syncopated++;
+            }
+        }
+    }
+    if (f.hits) {
+        f.syncopation = syncopated * 255 / f.hits;
+        f.downbeat = on_beat * 255 / f.hits;
+    }
+    return f;
+}
+
+// Syncopation level 0-3 of a pattern: none, under 1/8, under 1/4, more
+inline uint8_t SyncopationLevel(uint8_t syncopation) {
+    return syncopation == 0 ? 0 : syncopation < 32 ? 1 : syncopation < 64 ? 2 : 3;
+}
+
+// Downbeat level 0-3 of a pattern: quarters of the 0-255 share
+inline uint8_t DownbeatLevel(uint8_t downbeat) { return downbeat >> 6; }
+
+// Entries sorted by (syncopation level, downbeat level, hits); entries of
+// levels s, d with h hits are
+// kPatternIndex[kPatternIndexBuckets[s][d][h] .. kPatternIndexBuckets[s][d][h + 1] - 1]
+extern const PatternIndexEntry kPatternIndex[kIndexCells];
+extern const uint16_t kPatternIndexBuckets[kIndexFeatureLevels][kIndexFeatureLevels]
+                                          [kIndexMaxHits + 2];
+
+}  // namespace generative
+
+#endif  // GENERATIVE_PATTERN_INDEX_H_
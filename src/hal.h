@@ -0,0 +1,62 @@
+/**
+ * Hardware abstraction for the application logic in app.cpp
+ *
+ * hal_pico.cpp implements it on the RP2040. The host simulator (host/sim/)
+ * implements it with virtual time, scripted inputs and a pin trace, so the
+ * button FSM, mode switching, deadlines and MIDI dispatch run unchanged on
+ * both.
+ */
+
+#ifndef HAL_H_
+#define HAL_H_
+
+#include <stdint.h>
+
+// Microseconds since boot (monotonic, never wraps in practice)
+uint64_t hal_time_us();
+
+// GPIO
+void hal_gpio_init_output(uint8_t pin);
+void hal_gpio_init_input_pullup(uint8_t pin);
+void hal_gpio_put(uint8_t pin, bool value);
+bool hal_gpio_get(uint8_t pin);
+
+// Edge interrupt on an input pin: callback runs in interrupt context on every
+// edge with the new level and the hal_time_us() it happened at
+typedef void (*hal_gpio_edge_callback_t)(uint8_t pin, bool level, uint64_t at_us);
+void hal_gpio_set_edge_irq(uint8_t pin, hal_gpio_edge_callback_t callback);
+
+// One-shot timer interrupt for the solenoid scheduler. callback runs in
+// interrupt context at (or as soon as possible after) the target time; a
+// target in the past fires at once. Setting a new target replaces the old.
+typedef void (*hal_alarm_callback_t)();
+void hal_alarm_init(hal_alarm_callback_t callback);
+void hal_alarm_set(uint64_t at_us);
+
+// Critical sections shared with the alarm callback
+uint32_t hal_irq_save();
+void hal_irq_restore(uint32_t state);
+
+// USB start-of-frame interrupt: callback runs in interrupt context with the
+// 11-bit frame number and the hal_time_us() it arrived at. Call after USB is
+// initialised.
+typedef void (*hal_sof_callback_t)(uint16_t frame, uint64_t at_us);
+void hal_usb_sof_init(hal_sof_callback_t callback);
+
+// USB MIDI receive FIFO (4-byte USB-MIDI event packets)
+uint32_t hal_midi_available();
+bool hal_midi_read(uint8_t packet[4]);
+
+// Storage partition for the uploaded MIDI file. Reads go straight through
+// hal_storage_data() (memory-mapped flash on the RP2040). Erase works on
+// whole sectors, programming on whole pages; offsets are relative to the
+// partition start.
+static const uint32_t HAL_STORAGE_SECTOR_SIZE = 4096;
+static const uint32_t HAL_STORAGE_PAGE_SIZE = 256;
+
+uint32_t hal_storage_size();
+const uint8_t* hal_storage_data();
+void hal_storage_erase_sector(uint32_t offset);
+void hal_storage_program_page(uint32_t offset, const uint8_t data[HAL_STORAGE_PAGE_SIZE]);
+
+#endif  // HAL_H_
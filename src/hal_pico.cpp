@@ -0,0 +1,144 @@
+// RP2040 implementation of hal.h (Pico SDK + TinyUSB)
+
+#include "hal.h"
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/structs/usb.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "tusb.h"
+
+// Last 256 KB of flash, well clear of the firmware image
+static const uint32_t STORAGE_SIZE = 256 * 1024;
+static const uint32_t STORAGE_OFFSET = PICO_FLASH_SIZE_BYTES - STORAGE_SIZE;
+
+uint64_t hal_time_us() {
+    return time_us_64();
+}
+
+void hal_gpio_init_output(uint8_t pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_OUT);
+    gpio_put(pin, 0);
+}
+
+void hal_gpio_init_input_pullup(uint8_t pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_IN);
+    gpio_pull_up(pin);
+}
+
+void hal_gpio_put(uint8_t pin, bool value) {
+    gpio_put(pin, value);
+}
+
+bool hal_gpio_get(uint8_t pin) {
+    return gpio_get(pin);
+}
+
+static hal_gpio_edge_callback_t gpio_edge_callbacks[NUM_BANK0_GPIOS];
+
+static void gpio_irq(uint gpio, uint32_t events) {
+    const uint64_t at_us = time_us_64();
+    // Both edges latched (a fast bounce): report where the pin ended up
+    bool level = events & GPIO_IRQ_EDGE_RISE;
+    if ((events & GPIO_IRQ_EDGE_RISE) && (events & GPIO_IRQ_EDGE_FALL)) {
+        level = gpio_get(gpio);
+    }
+    if (gpio_edge_callbacks[gpio]) {
+        gpio_edge_callbacks[gpio](static_cast<uint8_t>(gpio), level, at_us);
+    }
+}
+
+// The SDK has one GPIO callback per core: gpio_irq dispatches by pin
+void hal_gpio_set_edge_irq(uint8_t pin, hal_gpio_edge_callback_t callback) {
+    gpio_edge_callbacks[pin] = callback;
+    gpio_set_irq_enabled_with_callback(pin, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true,
+                                       gpio_irq);
+}
+
+static int alarm_num = -1;
+static hal_alarm_callback_t alarm_callback = nullptr;
+
+static void alarm_irq(uint alarm) {
+    (void)alarm;
+    alarm_callback();
+}
+
+void hal_alarm_init(hal_alarm_callback_t callback) {
+    alarm_callback = callback;
+    alarm_num = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(alarm_num, alarm_irq);
+}
+
+void hal_alarm_set(uint64_t at_us) {
+    // Returns true if the target has already passed: raise the IRQ by hand
+    if (hardware_alarm_set_target(alarm_num, from_us_since_boot(at_us))) {
+        hardware_alarm_force_irq(alarm_num);
+    }
+}
+
+uint32_t hal_irq_save() {
+    return save_and_disable_interrupts();
+}
+
+void hal_irq_restore(uint32_t state) {
+    restore_interrupts(state);
+}
+
+static hal_sof_callback_t sof_callback = nullptr;
+static uint16_t sof_last_frame = 0xFFFF;
+
+// Shares USBCTRL_IRQ with TinyUSB. Whichever handler runs first reads SOF_RD
+// (which clears the SOF status), so a new SOF is spotted by its frame number
+// rather than by the status bit.
+static void sof_irq() {
+    const uint16_t frame = usb_hw->sof_rd & USB_SOF_RD_BITS;
+    if (frame != sof_last_frame) {
+        sof_last_frame = frame;
+        sof_callback(frame, time_us_64());
+    }
+}
+
+void hal_usb_sof_init(hal_sof_callback_t callback) {
+    sof_callback = callback;
+    irq_set_enabled(USBCTRL_IRQ, false);
+    irq_add_shared_handler(USBCTRL_IRQ, sof_irq, PICO_SHARED_IRQ_HANDLER_HIGHEST_ORDER_PRIORITY);
+    irq_set_enabled(USBCTRL_IRQ, true);
+    // Keeps the SOF interrupt on; TinyUSB masks it again otherwise
+    tud_sof_cb_enable(true);
+}
+
+uint32_t hal_midi_available() {
+    return tud_midi_available();
+}
+
+bool hal_midi_read(uint8_t packet[4]) {
+    return tud_midi_packet_read(packet);
+}
+
+uint32_t hal_storage_size() {
+    return STORAGE_SIZE;
+}
+
+const uint8_t* hal_storage_data() {
+    return reinterpret_cast<const uint8_t*>(XIP_BASE + STORAGE_OFFSET);
+}
+
+// Flash is not readable while it is erased/programmed, and this code runs
+// from it: interrupts stay off for the duration (~45 ms per sector erase,
+// ~1 ms per page). The SDK flushes the XIP cache afterwards.
+void hal_storage_erase_sector(uint32_t offset) {
+    const uint32_t ints = save_and_disable_interrupts();
+    flash_range_erase(STORAGE_OFFSET + offset, FLASH_SECTOR_SIZE);
+    restore_interrupts(ints);
+}
+
+void hal_storage_program_page(uint32_t offset, const uint8_t data[HAL_STORAGE_PAGE_SIZE]) {
+    const uint32_t ints = save_and_disable_interrupts();
+    flash_range_program(STORAGE_OFFSET + offset, data, FLASH_PAGE_SIZE);
+    restore_interrupts(ints);
+}
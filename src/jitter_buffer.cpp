@@ -0,0 +1,68 @@
+#include "jitter_buffer.h"
+
+static const uint32_t HOST_TIME_MASK = (1u << 28) - 1;
+
+// The clock mapping uses the minimum offset over the current and the
+// previous window; a gap longer than two windows starts over
+static const uint64_t WINDOW_US = 1000000;
+
+static uint32_t delay_us = 0;
+
+static bool mapped = false;
+static uint32_t last_host_us = 0;     // as received, 28 bits
+static int64_t host_time_us = 0;      // unwrapped host time of the last message
+static uint64_t last_arrival_us = 0;
+static uint64_t window_start_us = 0;
+static int64_t window_min = 0;        // min(arrival - host time) in this window
+static int64_t prev_window_min = 0;   // and in the previous one
+
+void jitter_buffer_set_delay(uint32_t us) {
+    delay_us = us;
+}
+
+uint32_t jitter_buffer_delay() {
+    return delay_us;
+}
+
+uint64_t jitter_buffer_due(uint64_t arrival_us) {
+    return arrival_us + delay_us;
+}
+
+void jitter_buffer_reset() {
+    mapped = false;
+}
+
+uint64_t jitter_buffer_due_host(uint32_t host_us, uint64_t arrival_us) {
+    host_us &= HOST_TIME_MASK;
+    if (!mapped || arrival_us - last_arrival_us > 2 * WINDOW_US) {
+        mapped = true;
+        host_time_us = host_us;
+        window_start_us = arrival_us;
+        window_min = static_cast<int64_t>(arrival_us) - host_time_us;
+        prev_window_min = window_min;
+    } else {
+        // Unwrap: host time moves forward by less than half the 28-bit range
+        // between messages, anything else is a jump back
+        const uint32_t step = (host_us - last_host_us) & HOST_TIME_MASK;
+        if (step < (HOST_TIME_MASK + 1) / 2) {
+            host_time_us += step;
+        } else {
+            host_time_us -= (HOST_TIME_MASK + 1) - step;
+        }
+    }
+    last_host_us = host_us;
+    last_arrival_us = arrival_us;
+
+    const int64_t offset = static_cast<int64_t>(arrival_us) - host_time_us;
+    if (arrival_us - window_start_us >= WINDOW_US) {
+        prev_window_min = window_min;
+        window_min = offset;
+        window_start_us = arrival_us;
+    } else if (offset < window_min) {
+        window_min = offset;
+    }
+    const int64_t min_offset = window_min < prev_window_min ? window_min : prev_window_min;
+
+    const int64_t due = host_time_us + min_offset + delay_us;
+    return due > static_cast<int64_t>(arrival_us) ? static_cast<uint64_t>(due) : arrival_us;
+}
@@ -0,0 +1,41 @@
+/**
+ * Fixed-latency jitter buffer for live MIDI
+ *
+ * USB delivers MIDI in bursts on 1 ms frame boundaries and the main loop
+ * reads it once per pass, so notes sent evenly by the host arrive unevenly.
+ * With a delay set, each note is scheduled at a fixed time after it arrived
+ * instead of at once, trading that latency for steady timing:
+ *   - plain channel messages play at arrival + delay; the delay absorbs
+ *     nothing of the USB jitter but keeps the latency constant
+ *   - timestamped messages (SysEx command 0x10, below) play at the host time
+ *     they carry, mapped onto the device clock, + delay; as long as the delay
+ *     covers the transport jitter they keep the host's spacing exactly
+ *
+ *   F0 7D 4D 10 <host_us> <status & 0x7F> <data1> <data2> F7
+ *
+ * host_us is the host's send time in microseconds, modulo 2^28 (any origin;
+ * about 268 s before it wraps). The device clock mapping is the smallest
+ * (arrival - host time) seen over the last 1-2 s: the message that travelled
+ * fastest, which follows clock drift and recovers from a host clock restart.
+ */
+
+#ifndef JITTER_BUFFER_H_
+#define JITTER_BUFFER_H_
+
+#include <stdint.h>
+
+// Fixed delay added to live notes; 0 plays them on arrival
+void jitter_buffer_set_delay(uint32_t delay_us);
+uint32_t jitter_buffer_delay();
+
+// When to play a channel message that arrived at arrival_us
+uint64_t jitter_buffer_due(uint64_t arrival_us);
+
+// When to play a timestamped message that arrived at arrival_us. Never
+// earlier than arrival_us.
+uint64_t jitter_buffer_due_host(uint32_t host_us, uint64_t arrival_us);
+
+// Forget the host clock mapping
+void jitter_buffer_reset();
+
+#endif  // JITTER_BUFFER_H_
@@ -0,0 +1,77 @@
+#include "midi_parser.h"
+
+// Number of MIDI bytes carried by each Code Index Number (USB-MIDI 1.0,
+// table 4-1). 0 marks CINs we do not accept here: reserved codes (0x0, 0x1)
+// and SysEx (0x4-0x7), which goes through midi_parse_sysex() instead.
+static const uint8_t kCinLength[16] = {
+    0, 0, 2, 3, 0, 0, 0, 0, 3, 3, 3, 3, 2, 2, 3, 1
+};
+
+bool midi_parse_packet(const uint8_t packet[4], MidiEvent* event) {
+    const uint8_t cin = packet[0] & 0x0F;
+    const uint8_t status = packet[1];
+    const uint8_t length = kCinLength[cin];
+
+    event->type = MIDI_EVENT_NONE;
+    event->status = status;
+    event->channel = 0;
+    event->data1 = 0;
+    event->data2 = 0;
+
+    if (!length || !(status & 0x80)) {
+        return false;
+    }
+
+    // Channel voice messages: the CIN repeats the status high nibble.
+    // System common messages (CIN 0x2, 0x3) need a system status byte.
+    if (cin >= 0x8 && cin <= 0xE && (status >> 4) != cin) {
+        return false;
+    }
+    if ((cin == 0x2 || cin == 0x3) && status < 0xF0) {
+        return false;
+    }
+
+    // Data bytes present for this CIN must be 7-bit
+    if ((length > 1 && (packet[2] & 0x80)) || (length > 2 && (packet[3] & 0x80))) {
+        return false;
+    }
+
+    if (length > 1) event->data1 = packet[2];
+    if (length > 2) event->data2 = packet[3];
+
+    if (status < 0xF0) {
+        event->channel = (status & 0x0F) + 1;
+    }
+
+    const uint8_t msg_type = status & 0xF0;
+    if (msg_type == 0x90 && event->data2 != 0) {
+        event->type = MIDI_EVENT_NOTE_ON;
+    } else if (msg_type == 0x80 || msg_type == 0x90) {
+        event->type = MIDI_EVENT_NOTE_OFF;
+    } else {
+        event->type = MIDI_EVENT_OTHER;
+    }
+    return true;
+}
+
+uint8_t midi_parse_sysex(const uint8_t packet[4], uint8_t bytes[3], bool* end) {
+    const uint8_t cin = packet[0] & 0x0F;
+    if (cin < 0x4 || cin > 0x7) {
+        return 0;
+    }
+    // CIN 0x4: start or continue, 3 bytes. CIN 0x5-0x7: end with 1-3 bytes.
+    const uint8_t length = cin == 0x4 ? 3 : cin - 0x4;
+    *end = cin != 0x4;
+    for (uint8_t i = 0; i < length; ++i) {
+        const uint8_t b = packet[1 + i];
+        const bool last = i + 1 == length;
+        if ((b & 0x80) && !(b == 0xF0 && i == 0) && !(b == 0xF7 && last && *end)) {
+            return 0;
+        }
+        bytes[i] = b;
+    }
+    if (*end && bytes[length - 1] != 0xF7) {
+        return 0;  // CIN 0x5 also carries single-byte system common messages
+    }
+    return length;
+}
@@ -0,0 +1,40 @@
+/**
+ * USB-MIDI event packet decoding
+ *
+ * Packets come straight from the host, so every field is validated before
+ * use: the Code Index Number (CIN, low nibble of byte 0) must be one we
+ * handle, channel messages must carry a status byte matching their CIN and
+ * data bytes must be 7-bit. Anything else decodes to MIDI_EVENT_NONE.
+ */
+
+#ifndef MIDI_PARSER_H_
+#define MIDI_PARSER_H_
+
+#include <stdint.h>
+
+enum MidiEventType {
+    MIDI_EVENT_NONE,      // malformed or unsupported packet, ignore
+    MIDI_EVENT_NOTE_ON,   // velocity > 0
+    MIDI_EVENT_NOTE_OFF,  // includes Note On with velocity 0
+    MIDI_EVENT_OTHER      // any other valid channel or system message
+};
+
+struct MidiEvent {
+    uint8_t type;     // MidiEventType
+    uint8_t status;   // MIDI status byte
+    uint8_t channel;  // 1-16 for channel messages, 0 otherwise
+    uint8_t data1;    // note number for note events
+    uint8_t data2;    // velocity for note events
+};
+
+// Decode one 4-byte USB-MIDI event packet. Returns false (and sets
+// event->type to MIDI_EVENT_NONE) when the packet must be ignored.
+bool midi_parse_packet(const uint8_t packet[4], MidiEvent* event);
+
+// Extract the SysEx bytes of a USB-MIDI packet (CIN 0x4-0x7) into bytes[].
+// Returns how many there are (1-3), or 0 if the packet is not a valid SysEx
+// packet: data bytes must be 7-bit, F0 may only open a packet and F7 only
+// close one with CIN 0x5-0x7. *end is set when the packet ends the message.
+uint8_t midi_parse_sysex(const uint8_t packet[4], uint8_t bytes[3], bool* end);
+
+#endif  // MIDI_PARSER_H_
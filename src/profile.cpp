@@ -0,0 +1,51 @@
+#include "profile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+void profile_init() {
+    systick_hw->rvr = PROFILE_CYCLES_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;  // enable, processor clock, no interrupt
+}
+
+uint32_t profile_cycles() {
+    return PROFILE_CYCLES_MASK - systick_hw->cvr;
+}
+
+#if PROFILE_ENABLED
+
+ProfileStats profile_stats[PROFILE_NUM_ZONES];
+
+void profile_report(uint32_t window_ms) {
+    static const char* const zone_names[PROFILE_NUM_ZONES] = {
+        "loop", "usb", "tick", "midi", "deadline", "printf"
+    };
+
+    // Snapshot first so the report's own printf lands in the next window
+    ProfileStats snapshot[PROFILE_NUM_ZONES];
+    memcpy(snapshot, profile_stats, sizeof(snapshot));
+    memset(profile_stats, 0, sizeof(profile_stats));
+
+    const uint32_t cycles_per_us = clock_get_hz(clk_sys) / 1000000;
+    const uint64_t window_cycles = static_cast<uint64_t>(window_ms) * 1000 * cycles_per_us;
+
+    printf("[PROF] %lums window, %lu passes\n", window_ms, snapshot[PROFILE_ZONE_LOOP].count);
+    for (uint8_t i = 0; i < PROFILE_NUM_ZONES; ++i) {
+        const ProfileStats& s = snapshot[i];
+        if (!s.count) {
+            continue;
+        }
+        // Load in hundredths of a percent of the window
+        const uint32_t load = window_cycles ? s.cycles * 10000ull / window_cycles : 0;
+        printf("[PROF] %-8s n=%-6lu avg=%7lucyc max=%7lucyc (%luus) load=%lu.%02lu%%\n",
+               zone_names[i], s.count,
+               s.cycles / s.count, s.max_cycles, s.max_cycles / cycles_per_us,
+               load / 100, load % 100);
+    }
+}
+
+#endif  // PROFILE_ENABLED
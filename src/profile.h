@@ -0,0 +1,89 @@
+/**
+ * Main loop profiler
+ *
+ * Cycle counts come from SysTick, run as a free-running 24-bit down-counter
+ * at the CPU clock (wraps every ~134 ms at 125 MHz, far longer than any zone).
+ *
+ * Set PROFILE_ENABLED to 1 to accumulate per-zone statistics:
+ *
+ *     {
+ *         PROFILE_SCOPE(PROFILE_ZONE_TICK);
+ *         event = gen_controller.Tick();
+ *     }
+ *
+ * and call profile_report() about once a second from idle time. With
+ * PROFILE_ENABLED 0 the scopes compile to nothing.
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 0
+#endif
+
+enum ProfileZone {
+    PROFILE_ZONE_LOOP,       // one main loop pass, excluding the 1 ms sleep
+    PROFILE_ZONE_USB,        // tud_task()
+    PROFILE_ZONE_TICK,       // GenerativeController::Tick()
+    PROFILE_ZONE_MIDI,       // MIDI packet drain / dispatch
+    PROFILE_ZONE_DEADLINES,  // LED + solenoid deadline scan
+    PROFILE_ZONE_PRINTF,     // UART logging
+    PROFILE_NUM_ZONES
+};
+
+// Start SysTick as a free-running cycle counter
+void profile_init();
+
+// Current SysTick count, increasing; take deltas modulo PROFILE_CYCLES_MASK
+uint32_t profile_cycles();
+
+static const uint32_t PROFILE_CYCLES_MASK = 0x00FFFFFF;
+
+#if PROFILE_ENABLED
+
+struct ProfileStats {
+    uint32_t count;       // scopes closed since the last report
+    uint32_t cycles;      // total cycles spent in the zone
+    uint32_t max_cycles;  // longest single scope
+};
+
+extern ProfileStats profile_stats[PROFILE_NUM_ZONES];
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileZone zone) : zone_(zone), start_(profile_cycles()) {}
+
+    ~ProfileScope() {
+        const uint32_t elapsed = (profile_cycles() - start_) & PROFILE_CYCLES_MASK;
+        ProfileStats& stats = profile_stats[zone_];
+        stats.count++;
+        stats.cycles += elapsed;
+        if (elapsed > stats.max_cycles) {
+            stats.max_cycles = elapsed;
+        }
+    }
+
+private:
+    ProfileZone zone_;
+    uint32_t start_;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(zone) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(zone)
+
+// Print per-zone totals for the last window_ms milliseconds, then reset them
+void profile_report(uint32_t window_ms);
+
+#else
+
+#define PROFILE_SCOPE(zone) ((void)0)
+
+static inline void profile_report(uint32_t) {}
+
+#endif  // PROFILE_ENABLED
+
+#endif  // PROFILE_H_
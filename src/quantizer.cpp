@@ -0,0 +1,43 @@
+#include "quantizer.h"
+
+static const uint8_t BAR_STEPS = 32;
+
+uint64_t quantize_note(const QuantizeSettings& settings, uint64_t played_us,
+                       uint64_t earliest_us, uint64_t step_start_us, uint8_t step,
+                       uint32_t step_us) {
+    if (played_us < earliest_us) {
+        played_us = earliest_us;
+    }
+    if (settings.mode == QUANTIZE_OFF || settings.strength == 0 || step_us == 0) {
+        return played_us;
+    }
+
+    // Largest power of two <= the division, so lines stay aligned to the bar
+    uint8_t division = 1;
+    while (division * 2 <= settings.division_steps && division < BAR_STEPS) {
+        division *= 2;
+    }
+    const int64_t grid_us = static_cast<int64_t>(division) * step_us;
+
+    // A grid line at or before the anchor step, then the last line at or
+    // before the note (the anchor may lie ahead by the engine lookahead)
+    const int64_t anchor_us =
+        static_cast<int64_t>(step_start_us) - static_cast<int64_t>(step % division) * step_us;
+    int64_t since_line_us = (static_cast<int64_t>(played_us) - anchor_us) % grid_us;
+    if (since_line_us < 0) {
+        since_line_us += grid_us;
+    }
+    if (since_line_us == 0) {
+        return played_us;  // right on a line
+    }
+
+    // Forward to the next line, or back to the last one when it is nearer
+    const int64_t to_next_us = grid_us - since_line_us;
+    int64_t move_us = to_next_us;
+    if (settings.mode == QUANTIZE_NEAREST && since_line_us <= to_next_us) {
+        move_us = -since_line_us;
+    }
+    const uint8_t strength = settings.strength > 100 ? 100 : settings.strength;
+    const int64_t at_us = static_cast<int64_t>(played_us) + move_us * strength / 100;
+    return at_us < static_cast<int64_t>(earliest_us) ? earliest_us : static_cast<uint64_t>(at_us);
+}
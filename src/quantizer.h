@@ -0,0 +1,47 @@
+/**
+ * Live note quantizer for hybrid mode
+ *
+ * Moves the start of a live note towards the lines of the generative step
+ * grid:
+ *   - QUANTIZE_NEXT waits for the next grid line
+ *   - QUANTIZE_NEAREST moves an early note on to the next line and a late
+ *     note back to the line it missed
+ * A note cannot play before it was received, so a late note only moves back
+ * as far as the jitter buffer delay (jitter_buffer.h) allows: the delay is
+ * the lookahead. Without one, late notes play at once.
+ * Strength moves the note part of the way: 100% lands on the line, 50%
+ * halfway between the played time and the line, 0% leaves it alone.
+ *
+ * The grid is anchored on the start time of a known step of the running
+ * engine, so quantized notes land on the microsecond the engine's own pulses
+ * are queued at.
+ */
+
+#ifndef QUANTIZER_H_
+#define QUANTIZER_H_
+
+#include <stdint.h>
+
+enum QuantizeMode {
+    QUANTIZE_OFF,
+    QUANTIZE_NEXT,
+    QUANTIZE_NEAREST
+};
+
+struct QuantizeSettings {
+    uint8_t mode;            // QuantizeMode
+    uint8_t division_steps;  // grid line every N steps: 1, 2, 4, 8, 16 or 32
+                             // (1 step = 1/32 note); others round down
+    uint8_t strength;        // 0-100 %
+};
+
+// Time to play a note due at played_us (its receive time plus any jitter
+// buffer delay) and received at earliest_us. Step `step` (0-31) of the bar
+// started at step_start_us (in the past or up to a few steps ahead) and steps
+// are step_us long. Grid lines fall on steps that are multiples of the
+// division, counted from the bar line. Never returns less than earliest_us.
+uint64_t quantize_note(const QuantizeSettings& settings, uint64_t played_us,
+                       uint64_t earliest_us, uint64_t step_start_us, uint8_t step,
+                       uint32_t step_us);
+
+#endif  // QUANTIZER_H_
@@ -0,0 +1,155 @@
+#include "scheduler.h"
+
+#include "app.h"
+#include "hal.h"
+
+struct PendingPulse {
+    uint64_t at_us;
+    uint32_t duration_us;
+    uint8_t channel;
+    uint8_t source;
+};
+
+// Sorted by at_us; shared with the alarm interrupt
+static PendingPulse queue[SCHED_QUEUE_SIZE];
+static uint8_t queue_len = 0;
+
+static_assert(SCHED_LOGIC_CHANNEL == GPIO_COUNT, "logic channels follow the solenoids");
+static const uint8_t CHANNEL_COUNT = SCHED_LOGIC_CHANNEL + GPIO_LOGIC_COUNT;
+
+// Per channel (0 = none); arbitration only applies to solenoids
+static uint64_t off_at_us[CHANNEL_COUNT];
+static uint64_t live_until_us[GPIO_COUNT];   // end of the current live pulse
+static uint64_t mute_until_us[GPIO_COUNT];   // generative hits muted until
+
+static uint8_t rules = 0;
+static uint32_t rule_mute_us = 0;
+static uint32_t dropped = 0;
+static uint32_t rejected = 0;
+
+static uint8_t channel_pin(uint8_t channel) {
+    return channel < SCHED_LOGIC_CHANNEL ? GPIO_BASE + channel
+                                         : GPIO_LOGIC_BASE + channel - SCHED_LOGIC_CHANNEL;
+}
+
+// Arm the alarm for the earliest queued start or pending switch-off
+static void arm() {
+    uint64_t next = queue_len ? queue[0].at_us : 0;
+    for (uint8_t i = 0; i < CHANNEL_COUNT; ++i) {
+        if (off_at_us[i] && (!next || off_at_us[i] < next)) {
+            next = off_at_us[i];
+        }
+    }
+    if (next) {
+        hal_alarm_set(next);
+    }
+}
+
+static void start_pulse(const PendingPulse& p, uint64_t now_us) {
+    const uint8_t ch = p.channel;
+    if (p.source == SCHED_SOURCE_GENERATIVE) {
+        if (((rules & SCHED_RULE_LIVE_OVERRIDES) && live_until_us[ch] > now_us) ||
+            ((rules & SCHED_RULE_MUTE_AFTER_LIVE) && mute_until_us[ch] > now_us)) {
+            dropped++;
+            return;
+        }
+    } else if (p.source == SCHED_SOURCE_LIVE) {
+        live_until_us[ch] = now_us + p.duration_us;
+        mute_until_us[ch] = now_us + rule_mute_us;
+    }
+    hal_gpio_put(channel_pin(ch), 1);
+    off_at_us[ch] = now_us + p.duration_us;
+}
+
+// Alarm interrupt: start due pulses, then end expired ones. Starts go first
+// so a retrigger due at the same time as the old pulse's end leaves no gap.
+static void service() {
+    const uint64_t now_us = hal_time_us();
+    uint8_t due = 0;
+    while (due < queue_len && queue[due].at_us <= now_us) {
+        start_pulse(queue[due], now_us);
+        due++;
+    }
+    if (due) {
+        for (uint8_t i = due; i < queue_len; ++i) {
+            queue[i - due] = queue[i];
+        }
+        queue_len -= due;
+    }
+    for (uint8_t i = 0; i < CHANNEL_COUNT; ++i) {
+        if (off_at_us[i] && off_at_us[i] <= now_us) {
+            hal_gpio_put(channel_pin(i), 0);
+            off_at_us[i] = 0;
+        }
+    }
+    arm();
+}
+
+void scheduler_init() {
+    queue_len = 0;
+    for (uint8_t i = 0; i < CHANNEL_COUNT; ++i) {
+        off_at_us[i] = 0;
+    }
+    for (uint8_t i = 0; i < GPIO_COUNT; ++i) {
+        live_until_us[i] = 0;
+        mute_until_us[i] = 0;
+    }
+    hal_alarm_init(service);
+}
+
+bool scheduler_fire(uint8_t channel, uint8_t source, uint64_t at_us, uint32_t duration_us) {
+    if (channel >= CHANNEL_COUNT ||
+        (channel >= SCHED_LOGIC_CHANNEL) != (source == SCHED_SOURCE_LOGIC)) {
+        return false;
+    }
+    const uint32_t irq = hal_irq_save();
+    if (queue_len == SCHED_QUEUE_SIZE) {
+        rejected++;
+        hal_irq_restore(irq);
+        return false;
+    }
+    // Insertion keeps equal times in arrival order
+    uint8_t i = queue_len++;
+    while (i && queue[i - 1].at_us > at_us) {
+        queue[i] = queue[i - 1];
+        i--;
+    }
+    queue[i].at_us = at_us;
+    queue[i].duration_us = duration_us;
+    queue[i].channel = channel;
+    queue[i].source = source;
+    if (i == 0) {
+        arm();
+    }
+    hal_irq_restore(irq);
+    return true;
+}
+
+void scheduler_set_rules(uint8_t new_rules, uint32_t mute_us) {
+    const uint32_t irq = hal_irq_save();
+    rules = new_rules;
+    rule_mute_us = (new_rules & SCHED_RULE_MUTE_AFTER_LIVE) ? mute_us : 0;
+    hal_irq_restore(irq);
+}
+
+void scheduler_all_off() {
+    const uint32_t irq = hal_irq_save();
+    queue_len = 0;
+    for (uint8_t i = 0; i < CHANNEL_COUNT; ++i) {
+        hal_gpio_put(channel_pin(i), 0);
+        off_at_us[i] = 0;
+    }
+    for (uint8_t i = 0; i < GPIO_COUNT; ++i) {
+        live_until_us[i] = 0;
+        mute_until_us[i] = 0;
+    }
+    hal_irq_restore(irq);
+}
+
+uint32_t scheduler_dropped() {
+    return dropped;
+}
+
+uint32_t scheduler_rejected() {
+    return rejected;
+}
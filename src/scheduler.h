@@ -0,0 +1,69 @@
+/**
+ * Timestamped solenoid scheduler
+ *
+ * The foreground loop queues pulses with the hal_time_us() time they are due
+ * at; a one-shot hardware alarm (hal_alarm_set) switches the solenoids on and
+ * off at those times from interrupt context, so pulses start and end with
+ * microsecond precision whatever the loop is doing.
+ *
+ * Pulses come from two sources. In hybrid mode the generative engine and live
+ * MIDI drive the same solenoids, and arbitration between them happens here,
+ * at the moment a generative pulse is due:
+ *   - SCHED_RULE_LIVE_OVERRIDES: a generative hit is dropped while a live
+ *     pulse holds the solenoid
+ *   - SCHED_RULE_MUTE_AFTER_LIVE: a generative hit is dropped for a while
+ *     (scheduler_set_rules' mute_us, typically N steps) after a live hit
+ * With no rules, both sources simply merge. A new pulse on a solenoid that is
+ * already on retriggers it with the new length.
+ *
+ * Channels past the solenoids (SCHED_LOGIC_CHANNEL onwards) are the logic
+ * outputs for other gear. They take SCHED_SOURCE_LOGIC pulses, which no rule
+ * drops.
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdint.h>
+
+enum SchedSource {
+    SCHED_SOURCE_GENERATIVE,
+    SCHED_SOURCE_LIVE,        // MIDI input and file playback
+    SCHED_SOURCE_LOGIC        // clock, reset and gate outputs
+};
+
+enum SchedRule {
+    SCHED_RULE_LIVE_OVERRIDES = 1 << 0,
+    SCHED_RULE_MUTE_AFTER_LIVE = 1 << 1
+};
+
+// Pulses waiting for their start time. The worst case is every channel (8
+// solenoids and 5 logic outputs) on every step queued ahead: the engine runs
+// up to 13 ms ahead and live notes wait up to 127 ms in the jitter buffer, at
+// most 4 steps of 50 ms (300 BPM). app.cpp checks this against its constants.
+static const uint8_t SCHED_QUEUE_SIZE = 64;
+
+// Channel of the first logic output (GPIO_LOGIC_BASE); solenoids are 0-7
+static const uint8_t SCHED_LOGIC_CHANNEL = 8;
+
+// Take the alarm; the solenoid outputs must already be configured
+void scheduler_init();
+
+// Queue a pulse on solenoid or logic output `channel` starting at at_us (now or in the past:
+// as soon as possible). Returns false if the queue is full (counted in
+// scheduler_rejected()).
+bool scheduler_fire(uint8_t channel, uint8_t source, uint64_t at_us, uint32_t duration_us);
+
+// Arbitration rules (SchedRule bits) and the mute length after a live hit
+void scheduler_set_rules(uint8_t rules, uint32_t mute_us);
+
+// Drop queued pulses and switch every solenoid and logic output off
+void scheduler_all_off();
+
+// Generative hits dropped by arbitration since boot
+uint32_t scheduler_dropped();
+
+// Pulses refused by scheduler_fire() because the queue was full, since boot
+uint32_t scheduler_rejected();
+
+#endif  // SCHEDULER_H_
@@ -0,0 +1,247 @@
+#include "smf_player.h"
+
+#include <string.h>
+
+// Tempo until the first Set Tempo meta event (120 BPM)
+static const uint32_t kDefaultUsPerQuarter = 500000;
+
+static uint32_t read_be(const uint8_t* p, uint8_t bytes) {
+    uint32_t value = 0;
+    while (bytes--) {
+        value = (value << 8) | *p++;
+    }
+    return value;
+}
+
+// Variable-length quantity (at most 4 bytes); false if it runs past end
+static bool read_vlq(const uint8_t** pos, const uint8_t* end, uint32_t* value) {
+    uint32_t v = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+        if (*pos >= end) {
+            return false;
+        }
+        const uint8_t b = *(*pos)++;
+        v = (v << 7) | (b & 0x7F);
+        if (!(b & 0x80)) {
+            *value = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+SmfPlayer::SmfPlayer()
+    : num_tracks_(0),
+      division_(0),
+      heap_size_(0),
+      tempo_tick_(0),
+      tempo_us_(0),
+      us_per_quarter_(kDefaultUsPerQuarter),
+      position_us_(0),
+      position_tick_(0) {
+    memset(tracks_, 0, sizeof(tracks_));
+}
+
+bool SmfPlayer::Open(const uint8_t* data, uint32_t size) {
+    num_tracks_ = 0;
+    heap_size_ = 0;
+    if (!data || size < 14 || memcmp(data, "MThd", 4) != 0) {
+        return false;
+    }
+    const uint32_t header_len = read_be(data + 4, 4);
+    const uint16_t format = read_be(data + 8, 2);
+    division_ = read_be(data + 12, 2);
+    if (header_len < 6 || header_len > size - 8 || format > 1 ||
+        division_ == 0 || (division_ & 0x8000)) {
+        return false;  // SMPTE time code division is not supported
+    }
+
+    // Collect track chunks, skipping unknown chunk types
+    const uint8_t* pos = data + 8 + header_len;
+    const uint8_t* end = data + size;
+    while (end - pos >= 8 && num_tracks_ < SMF_MAX_TRACKS) {
+        const uint32_t len = read_be(pos + 4, 4);
+        if (len > static_cast<uint32_t>(end - pos - 8)) {
+            break;  // truncated chunk
+        }
+        if (memcmp(pos, "MTrk", 4) == 0) {
+            Track& track = tracks_[num_tracks_++];
+            track.start = pos + 8;
+            track.end = pos + 8 + len;
+        }
+        pos += 8 + len;
+    }
+    if (!num_tracks_) {
+        return false;
+    }
+    Rewind();
+    return true;
+}
+
+void SmfPlayer::Rewind() {
+    tempo_tick_ = 0;
+    tempo_us_ = 0;
+    us_per_quarter_ = kDefaultUsPerQuarter;
+    position_us_ = 0;
+    position_tick_ = 0;
+    heap_size_ = 0;
+    for (uint8_t i = 0; i < num_tracks_; ++i) {
+        Track& track = tracks_[i];
+        track.pos = track.start;
+        track.tick = 0;
+        track.running_status = 0;
+        if (ReadDelta(track)) {
+            HeapPush(i);
+        }
+    }
+}
+
+uint64_t SmfPlayer::TickToUs(uint32_t tick) const {
+    return tempo_us_ + static_cast<uint64_t>(tick - tempo_tick_) * us_per_quarter_ / division_;
+}
+
+bool SmfPlayer::ReadDelta(Track& track) {
+    uint32_t delta;
+    if (!read_vlq(&track.pos, track.end, &delta)) {
+        return false;
+    }
+    track.tick += delta;
+    return true;
+}
+
+bool SmfPlayer::Poll(uint64_t elapsed_us, SmfNote* note) {
+    while (heap_size_) {
+        const uint8_t index = heap_[0];
+        Track& track = tracks_[index];
+        const uint64_t event_us = TickToUs(track.tick);
+        if (event_us > elapsed_us) {
+            return false;
+        }
+        position_us_ = event_us;
+        position_tick_ = track.tick;
+
+        bool is_note = false;
+        ReadEvent(track, note, &is_note);
+        if (track.pos && ReadDelta(track)) {
+            HeapSiftDown(0);
+        } else {
+            HeapPop();  // end of track or malformed data
+        }
+        if (is_note) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reads the event at track.pos. Sets track.pos to nullptr when the track
+// ends (End of Track or anything that can't be decoded).
+void SmfPlayer::ReadEvent(Track& track, SmfNote* note, bool* is_note) {
+    const uint8_t* p = track.pos;
+    if (p >= track.end) {
+        track.pos = nullptr;
+        return;
+    }
+
+    uint8_t status = *p;
+    if (status & 0x80) {
+        p++;
+    } else {
+        status = track.running_status;  // data byte: running status
+    }
+
+    if (status == 0xFF) {
+        // Meta event: type, length, data
+        uint32_t len;
+        if (p >= track.end) {
+            track.pos = nullptr;
+            return;
+        }
+        const uint8_t type = *p++;
+        if (!read_vlq(&p, track.end, &len) || len > static_cast<uint32_t>(track.end - p) ||
+            type == 0x2F) {
+            track.pos = nullptr;
+            return;
+        }
+        if (type == 0x51 && len == 3) {
+            // Set Tempo: later ticks are timed from here
+            tempo_us_ = TickToUs(track.tick);
+            tempo_tick_ = track.tick;
+            us_per_quarter_ = read_be(p, 3);
+        }
+        track.pos = p + len;
+        return;
+    }
+
+    if (status == 0xF0 || status == 0xF7) {
+        // SysEx or escape: length-prefixed, skipped
+        uint32_t len;
+        if (!read_vlq(&p, track.end, &len) || len > static_cast<uint32_t>(track.end - p)) {
+            track.pos = nullptr;
+            return;
+        }
+        track.pos = p + len;
+        return;
+    }
+
+    if (status < 0x80 || status > 0xEF) {
+        track.pos = nullptr;  // no running status to apply
+        return;
+    }
+    track.running_status = status;
+
+    const uint8_t msg_type = status & 0xF0;
+    const uint8_t data_len = (msg_type == 0xC0 || msg_type == 0xD0) ? 1 : 2;
+    if (track.end - p < data_len || (p[0] & 0x80) || (data_len == 2 && (p[1] & 0x80))) {
+        track.pos = nullptr;
+        return;
+    }
+    if (msg_type == 0x90 && p[1] != 0) {
+        note->channel = (status & 0x0F) + 1;
+        note->note = p[0];
+        note->velocity = p[1];
+        *is_note = true;
+    }
+    track.pos = p + data_len;
+}
+
+// Earlier tick first; equal ticks in track order, so merging is deterministic
+bool SmfPlayer::HeapLess(uint8_t a, uint8_t b) const {
+    const uint32_t ta = tracks_[a].tick;
+    const uint32_t tb = tracks_[b].tick;
+    return ta != tb ? ta < tb : a < b;
+}
+
+void SmfPlayer::HeapPush(uint8_t track) {
+    uint8_t i = heap_size_++;
+    heap_[i] = track;
+    while (i && HeapLess(heap_[i], heap_[(i - 1) / 2])) {
+        const uint8_t parent = (i - 1) / 2;
+        const uint8_t tmp = heap_[i];
+        heap_[i] = heap_[parent];
+        heap_[parent] = tmp;
+        i = parent;
+    }
+}
+
+void SmfPlayer::HeapPop() {
+    heap_[0] = heap_[--heap_size_];
+    HeapSiftDown(0);
+}
+
+void SmfPlayer::HeapSiftDown(uint8_t i) {
+    for (;;) {
+        uint8_t smallest = i;
+        const uint8_t left = 2 * i + 1;
+        const uint8_t right = left + 1;
+        if (left < heap_size_ && HeapLess(heap_[left], heap_[smallest])) smallest = left;
+        if (right < heap_size_ && HeapLess(heap_[right], heap_[smallest])) smallest = right;
+        if (smallest == i) {
+            return;
+        }
+        const uint8_t tmp = heap_[i];
+        heap_[i] = heap_[smallest];
+        heap_[smallest] = tmp;
+        i = smallest;
+    }
+}
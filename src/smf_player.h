@@ -0,0 +1,86 @@
+/**
+ * Standard MIDI File playback, read in place
+ *
+ * The file is walked where it lies (on the RP2040, the flash storage
+ * partition mapped through XIP), so nothing is copied into RAM: each track
+ * keeps a read pointer, running status and the tick of its next event, and a
+ * small binary heap of track indices yields the events of all tracks merged
+ * in time order. Tempo meta events are honoured; note-ons are returned to the
+ * caller, everything else is skipped.
+ *
+ * Every read is bounds-checked, so a corrupt file at worst ends a track early.
+ */
+
+#ifndef SMF_PLAYER_H_
+#define SMF_PLAYER_H_
+
+#include <stdint.h>
+
+static const uint8_t SMF_MAX_TRACKS = 16;
+
+struct SmfNote {
+    uint8_t channel;   // 1-16
+    uint8_t note;
+    uint8_t velocity;  // > 0
+};
+
+class SmfPlayer {
+public:
+    SmfPlayer();
+
+    // Check the header (format 0 or 1, ticks-per-quarter division) and find
+    // the track chunks. data must stay mapped while the player is in use.
+    bool Open(const uint8_t* data, uint32_t size);
+
+    // Back to the start of all tracks, at elapsed time 0
+    void Rewind();
+
+    // Next note-on due at or before elapsed_us (since Rewind()). Call until
+    // it returns false to get every note due.
+    bool Poll(uint64_t elapsed_us, SmfNote* note);
+
+    // True once every track has ended
+    bool finished() const { return heap_size_ == 0; }
+
+    // Time of the last event read, i.e. the length of the file once finished
+    uint64_t position_us() const { return position_us_; }
+
+    // The same position in ticks, and the ticks per quarter note
+    uint32_t position_tick() const { return position_tick_; }
+    uint16_t division() const { return division_; }
+
+    uint8_t num_tracks() const { return num_tracks_; }
+
+private:
+    struct Track {
+        const uint8_t* start;
+        const uint8_t* end;
+        const uint8_t* pos;
+        uint32_t tick;           // absolute tick of the event at pos
+        uint8_t running_status;
+    };
+
+    uint64_t TickToUs(uint32_t tick) const;
+    bool ReadDelta(Track& track);
+    void ReadEvent(Track& track, SmfNote* note, bool* is_note);
+    void HeapPop();
+    void HeapSiftDown(uint8_t i);
+    void HeapPush(uint8_t track);
+    bool HeapLess(uint8_t a, uint8_t b) const;
+
+    Track tracks_[SMF_MAX_TRACKS];
+    uint8_t num_tracks_;
+    uint16_t division_;          // ticks per quarter note
+
+    uint8_t heap_[SMF_MAX_TRACKS];
+    uint8_t heap_size_;
+
+    // Tempo map: tick/time of the last tempo change and the tempo since then
+    uint32_t tempo_tick_;
+    uint64_t tempo_us_;
+    uint32_t us_per_quarter_;
+    uint64_t position_us_;
+    uint32_t position_tick_;
+};
+
+#endif  // SMF_PLAYER_H_
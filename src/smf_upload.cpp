@@ -0,0 +1,174 @@
+#include "smf_upload.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hal.h"
+#include "scheduler.h"
+
+static const uint32_t HEADER_MAGIC = 0x31464D53;  // "SMF1"
+static const uint32_t FILE_OFFSET = HAL_STORAGE_PAGE_SIZE;
+
+struct StorageHeader {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t checksum;
+    uint32_t size_inverted;  // guards against a half-programmed header
+};
+
+// Upload in progress
+static bool upload_active = false;
+static uint32_t upload_size = 0;
+static uint32_t upload_offset = 0;       // file bytes received so far
+static uint32_t upload_sum = 0;
+static uint32_t erased_end = 0;          // storage erased up to here
+static uint8_t page_buf[HAL_STORAGE_PAGE_SIZE];
+
+// The stored file, checked against its checksum once (at the first
+// smf_stored_file() after boot, or when an upload commits it)
+enum StoredState { STORED_UNCHECKED, STORED_NONE, STORED_VALID };
+static uint8_t stored_state = STORED_UNCHECKED;
+static uint32_t stored_size = 0;
+
+// A sector erase stalls the CPU with interrupts off (about 45 ms on the
+// RP2040), so the scheduler alarm cannot end a pulse in the meantime:
+// switch every output off first rather than hold a solenoid on
+static void erase_sector(uint32_t offset) {
+    scheduler_all_off();
+    hal_storage_erase_sector(offset);
+}
+
+// Program the page holding file bytes up to upload_offset (storage address
+// FILE_OFFSET + file offset), erasing each sector on first use
+static void flush_page() {
+    const uint32_t page_addr = (FILE_OFFSET + upload_offset - 1) & ~(HAL_STORAGE_PAGE_SIZE - 1);
+    while (page_addr >= erased_end) {
+        erase_sector(erased_end);
+        erased_end += HAL_STORAGE_SECTOR_SIZE;
+    }
+    hal_storage_program_page(page_addr, page_buf);
+    memset(page_buf, 0xFF, sizeof(page_buf));
+}
+
+static void begin(uint32_t size) {
+    upload_active = false;
+    if (size == 0 || size > hal_storage_size() - FILE_OFFSET) {
+        printf("[SMF] upload rejected: %lu bytes\n", static_cast<unsigned long>(size));
+        return;
+    }
+    // Sector 0 holds the header: erasing it drops the old file at once
+    erase_sector(0);
+    stored_state = STORED_NONE;
+    erased_end = HAL_STORAGE_SECTOR_SIZE;
+    upload_active = true;
+    upload_size = size;
+    upload_offset = 0;
+    upload_sum = 0;
+    memset(page_buf, 0xFF, sizeof(page_buf));
+    printf("[SMF] upload begin: %lu bytes\n", static_cast<unsigned long>(size));
+}
+
+static void data(uint32_t offset, const uint8_t* p, uint32_t len) {
+    if (!upload_active || offset != upload_offset) {
+        if (upload_active) {
+            printf("[SMF] upload aborted: chunk at %lu, expected %lu\n",
+                   static_cast<unsigned long>(offset), static_cast<unsigned long>(upload_offset));
+        }
+        upload_active = false;
+        return;
+    }
+    // 7-bit groups: an MSB byte, then up to 7 bytes
+    for (uint32_t i = 0; i < len; i += 8) {
+        const uint8_t msbs = p[i];
+        for (uint32_t j = 1; j < 8 && i + j < len; ++j) {
+            if (upload_offset >= upload_size) {
+                upload_active = false;
+                printf("[SMF] upload aborted: more than %lu bytes\n",
+                       static_cast<unsigned long>(upload_size));
+                return;
+            }
+            const uint8_t b = p[i + j] | (((msbs >> (j - 1)) & 1) << 7);
+            page_buf[(FILE_OFFSET + upload_offset) % HAL_STORAGE_PAGE_SIZE] = b;
+            upload_sum += b;
+            upload_offset++;
+            if ((FILE_OFFSET + upload_offset) % HAL_STORAGE_PAGE_SIZE == 0) {
+                flush_page();
+            }
+        }
+    }
+}
+
+static void end(uint32_t checksum) {
+    if (!upload_active) {
+        return;
+    }
+    upload_active = false;
+    if ((FILE_OFFSET + upload_offset) % HAL_STORAGE_PAGE_SIZE != 0) {
+        flush_page();
+    }
+
+    // Verify what actually landed in flash, then commit the header
+    const uint8_t* stored = hal_storage_data() + FILE_OFFSET;
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < upload_offset; ++i) {
+        sum += stored[i];
+    }
+    checksum &= 0x0FFFFFFF;
+    if (upload_offset != upload_size || (sum & 0x0FFFFFFF) != checksum ||
+        (upload_sum & 0x0FFFFFFF) != checksum) {
+        printf("[SMF] upload failed: %lu of %lu bytes, checksum %07lx, expected %07lx\n",
+               static_cast<unsigned long>(upload_offset), static_cast<unsigned long>(upload_size),
+               static_cast<unsigned long>(sum & 0x0FFFFFFF), static_cast<unsigned long>(checksum));
+        return;
+    }
+    StorageHeader header = {HEADER_MAGIC, upload_size, checksum, ~upload_size};
+    memset(page_buf, 0xFF, sizeof(page_buf));
+    memcpy(page_buf, &header, sizeof(header));
+    hal_storage_program_page(0, page_buf);
+    memset(page_buf, 0xFF, sizeof(page_buf));
+    stored_state = STORED_VALID;
+    stored_size = upload_size;
+    printf("[SMF] upload done: %lu bytes\n", static_cast<unsigned long>(upload_size));
+}
+
+void smf_upload_message(const SysexMessage& message) {
+    const uint8_t* body = message.body;
+    if (message.cmd == SYSEX_CMD_UPLOAD_BEGIN && message.length == 4) {
+        begin(sysex_read_u28(body));
+    } else if (message.cmd == SYSEX_CMD_UPLOAD_DATA && message.length > 4) {
+        data(sysex_read_u28(body), body + 4, message.length - 4);
+    } else if (message.cmd == SYSEX_CMD_UPLOAD_END && message.length == 4) {
+        end(sysex_read_u28(body));
+    }
+}
+
+// Whether the partition holds a complete file: header and checksum
+static bool check_stored_file() {
+    const uint8_t* storage = hal_storage_data();
+    StorageHeader header;
+    memcpy(&header, storage, sizeof(header));
+    if (header.magic != HEADER_MAGIC || header.size != ~header.size_inverted ||
+        header.size == 0 || header.size > hal_storage_size() - FILE_OFFSET) {
+        return false;
+    }
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < header.size; ++i) {
+        sum += storage[FILE_OFFSET + i];
+    }
+    if ((sum & 0x0FFFFFFF) != header.checksum) {
+        return false;
+    }
+    stored_size = header.size;
+    return true;
+}
+
+const uint8_t* smf_stored_file(uint32_t* size) {
+    if (stored_state == STORED_UNCHECKED) {
+        stored_state = check_stored_file() ? STORED_VALID : STORED_NONE;
+    }
+    if (stored_state != STORED_VALID) {
+        return nullptr;
+    }
+    *size = stored_size;
+    return hal_storage_data() + FILE_OFFSET;
+}
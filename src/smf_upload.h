@@ -0,0 +1,34 @@
+/**
+ * Standard MIDI File upload over SysEx into the flash storage partition
+ *
+ * Commands 0x01-0x03 of the device SysEx messages (sysex.h); numbers are
+ * 28-bit, sent as four 7-bit groups, LSB first:
+ *
+ *   F0 7D 4D 01 <size> F7             begin: invalidates the stored file
+ *   F0 7D 4D 02 <offset> <data> F7    next chunk, in order from offset 0;
+ *                                     <data> is up to 63 bytes in 7-bit
+ *                                     groups (an MSB byte, then up to 7 bytes)
+ *   F0 7D 4D 03 <checksum> F7         end: checksum is the byte sum mod 2^28
+ *
+ * The partition holds a one-page header (magic, size, checksum) followed by
+ * the file. The header is written last, so an interrupted upload leaves no
+ * file rather than a broken one. Erasing flash switches every solenoid and
+ * logic output off first (scheduler_all_off()). host/smf_sysex.cpp produces
+ * the messages.
+ */
+
+#ifndef SMF_UPLOAD_H_
+#define SMF_UPLOAD_H_
+
+#include <stdint.h>
+
+#include "sysex.h"
+
+// Handle an upload message (SYSEX_CMD_UPLOAD_*); others are ignored
+void smf_upload_message(const SysexMessage& message);
+
+// The stored file, read in place, or nullptr if there is none. Its checksum
+// is verified on the first call only; an upload keeps the result up to date.
+const uint8_t* smf_stored_file(uint32_t* size);
+
+#endif  // SMF_UPLOAD_H_
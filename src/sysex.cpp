@@ -0,0 +1,61 @@
+#include "sysex.h"
+
+#include "midi_parser.h"
+
+static const uint8_t SYSEX_ID = 0x7D;
+static const uint8_t SYSEX_DEVICE = 0x4D;
+
+// Reassembly of the current message (longest valid one is 81 bytes)
+static uint8_t sysex_buf[96];
+static uint8_t sysex_len = 0;
+static bool sysex_overflow = false;
+
+uint32_t sysex_read_u28(const uint8_t* p) {
+    return p[0] | (p[1] << 7) | (p[2] << 14) | (static_cast<uint32_t>(p[3]) << 21);
+}
+
+bool sysex_packet(const uint8_t packet[4], SysexMessage* message) {
+    message->cmd = SYSEX_CMD_NONE;
+    message->body = nullptr;
+    message->length = 0;
+
+    uint8_t bytes[3];
+    bool end_of_message = false;
+    const uint8_t n = midi_parse_sysex(packet, bytes, &end_of_message);
+    if (!n) {
+        const uint8_t cin = packet[0] & 0x0F;
+        if (cin < 0x4 || cin > 0x7) {
+            return false;
+        }
+        sysex_len = 0;  // malformed SysEx packet: drop the message
+        return true;
+    }
+
+    if (bytes[0] == 0xF0) {
+        sysex_len = 0;  // a new message starts, whatever came before
+        sysex_overflow = false;
+    } else if (sysex_len == 0) {
+        return true;  // continuation without a start: ignore until the next F0
+    }
+    for (uint8_t i = 0; i < n; ++i) {
+        if (sysex_len < sizeof(sysex_buf)) {
+            sysex_buf[sysex_len++] = bytes[i];
+        } else {
+            sysex_overflow = true;
+        }
+    }
+    if (!end_of_message) {
+        return true;
+    }
+
+    // F0 7D 4D <cmd> ... F7
+    const uint8_t len = sysex_len;
+    sysex_len = 0;
+    if (!sysex_overflow && len >= 5 && sysex_buf[1] == SYSEX_ID &&
+        sysex_buf[2] == SYSEX_DEVICE && sysex_buf[3] != SYSEX_CMD_NONE) {
+        message->cmd = sysex_buf[3];
+        message->body = sysex_buf + 4;
+        message->length = len - 5;
+    }
+    return true;
+}
@@ -0,0 +1,40 @@
+/**
+ * SysEx messages to the controller
+ *
+ * All use the non-commercial manufacturer ID 0x7D and device byte 0x4D ('M'):
+ *
+ *   F0 7D 4D <cmd> <body> F7
+ *
+ * Numbers in a body are 28-bit, sent as four 7-bit groups, LSB first.
+ *   0x01-0x03  MIDI file upload (smf_upload.h)
+ *   0x10       timestamped channel message (jitter_buffer.h)
+ */
+
+#ifndef SYSEX_H_
+#define SYSEX_H_
+
+#include <stdint.h>
+
+enum SysexCmd {
+    SYSEX_CMD_NONE = 0x00,
+    SYSEX_CMD_UPLOAD_BEGIN = 0x01,
+    SYSEX_CMD_UPLOAD_DATA = 0x02,
+    SYSEX_CMD_UPLOAD_END = 0x03,
+    SYSEX_CMD_TIMESTAMPED = 0x10
+};
+
+struct SysexMessage {
+    uint8_t cmd;          // SysexCmd, SYSEX_CMD_NONE until a message completes
+    const uint8_t* body;  // between <cmd> and F7, valid until the next packet
+    uint8_t length;
+};
+
+// Feed a USB-MIDI packet. Returns false if it is not a SysEx packet, so the
+// caller can handle it as a channel message instead. When the packet ends a
+// well-formed message for this device, *message describes it.
+bool sysex_packet(const uint8_t packet[4], SysexMessage* message);
+
+// 28-bit number at p (four 7-bit groups, LSB first)
+uint32_t sysex_read_u28(const uint8_t* p);
+
+#endif  // SYSEX_H_
@@ -0,0 +1,102 @@
+#include "usb_clock.h"
+
+#include "hal.h"
+
+static const uint16_t FRAME_MASK = 0x7FF;        // 11-bit frame numbers
+static const uint64_t FRAME_GAP_US = 1000000;    // longer: start over
+static const uint64_t SAMPLE_PERIOD_US = 1000000;
+static const uint8_t SAMPLE_COUNT = 32;
+static const uint64_t MIN_SPAN_FRAMES = 4000;
+
+// Written by the SOF interrupt
+static volatile uint16_t last_frame = 0;
+static volatile uint64_t last_frame_us = 0;
+static volatile uint64_t frame_count = 0;        // frames since the epoch began
+static volatile uint64_t sample_frame = 0;       // latest timely frame
+static volatile uint64_t sample_frame_us = 0;
+static volatile uint32_t epoch = 0;
+
+// Foreground: one sample per second
+struct Sample {
+    uint64_t frame;
+    uint64_t at_us;
+};
+static Sample samples[SAMPLE_COUNT];
+static uint8_t sample_head = 0;                  // next slot
+static uint8_t sample_fill = 0;
+static uint32_t sample_epoch = 0;
+static uint64_t next_sample_us = 0;
+static bool locked = false;
+static int32_t drift_ppb = 0;
+
+static void sof_irq(uint16_t frame, uint64_t at_us) {
+    frame &= FRAME_MASK;
+    const uint64_t gap_us = at_us - last_frame_us;
+    if (last_frame_us == 0 || gap_us > FRAME_GAP_US) {
+        epoch = epoch + 1;
+        frame_count = 0;
+        sample_frame_us = 0;
+    } else {
+        const uint16_t delta = (frame - last_frame) & FRAME_MASK;
+        frame_count = frame_count + delta;
+        // Timely only if it follows the previous SOF by one frame
+        if (delta == 1 && gap_us < 1500) {
+            sample_frame = frame_count;
+            sample_frame_us = at_us;
+        }
+    }
+    last_frame = frame;
+    last_frame_us = at_us;
+}
+
+void usb_clock_init() {
+    hal_usb_sof_init(sof_irq);
+}
+
+bool usb_clock_update(uint64_t now_us) {
+    if (now_us < next_sample_us) {
+        return false;
+    }
+    next_sample_us = now_us + SAMPLE_PERIOD_US;
+
+    const uint32_t irq = hal_irq_save();
+    const Sample sample = {sample_frame, sample_frame_us};
+    const uint32_t sample_epoch_now = epoch;
+    hal_irq_restore(irq);
+
+    const bool was_locked = locked;
+    if (sample_epoch_now != sample_epoch) {
+        sample_epoch = sample_epoch_now;
+        sample_fill = 0;
+        locked = false;
+        drift_ppb = 0;
+    }
+    if (!sample.at_us) {
+        return was_locked;
+    }
+
+    samples[sample_head] = sample;
+    sample_head = (sample_head + 1) % SAMPLE_COUNT;
+    if (sample_fill < SAMPLE_COUNT) {
+        sample_fill++;
+    }
+    const Sample& oldest = samples[(sample_head + SAMPLE_COUNT - sample_fill) % SAMPLE_COUNT];
+    const uint64_t frames = sample.frame - oldest.frame;
+    if (frames < MIN_SPAN_FRAMES) {
+        return was_locked;
+    }
+
+    const int64_t host_us = static_cast<int64_t>(frames) * 1000;
+    const int64_t error_us = static_cast<int64_t>(sample.at_us - oldest.at_us) - host_us;
+    locked = true;
+    drift_ppb = static_cast<int32_t>(error_us * 1000000000 / host_us);
+    return true;
+}
+
+bool usb_clock_locked() {
+    return locked;
+}
+
+int32_t usb_clock_drift_ppb() {
+    return drift_ppb;
+}
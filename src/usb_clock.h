@@ -0,0 +1,35 @@
+/**
+ * Host clock tracking from USB start-of-frame packets
+ *
+ * A USB host sends a start-of-frame (SOF) packet every 1 ms of its own clock.
+ * Timestamping them against the RP2040 timer gives the drift between the two
+ * clocks: the device time elapsed over many frames, compared with 1000 us per
+ * frame. Samples are taken once per second and the estimate spans up to the
+ * last 32 s, so interrupt latency of a few us amounts to well under 1 ppm.
+ *
+ * Only consecutive frames are sampled, so SOFs held back while interrupts
+ * are off (flash writes) do not count. A gap of over a second (unplugged,
+ * suspended) starts over.
+ */
+
+#ifndef USB_CLOCK_H_
+#define USB_CLOCK_H_
+
+#include <stdint.h>
+
+// Start timestamping SOFs; call once USB is up
+void usb_clock_init();
+
+// Take a sample if one is due. Returns true when the estimate was updated
+// or lost.
+bool usb_clock_update(uint64_t now_us);
+
+// An estimate is available (at least 4 s of frames)
+bool usb_clock_locked();
+
+// RP2040 timer rate relative to the host clock in parts per billion:
+// positive when the timer runs fast, i.e. a host second lasts longer than
+// 1000000 timer us. 0 while not locked.
+int32_t usb_clock_drift_ppb();
+
+#endif  // USB_CLOCK_H_